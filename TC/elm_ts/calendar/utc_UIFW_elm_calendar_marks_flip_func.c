@@ -0,0 +1,406 @@
+#include <tet_api.h>
+#include <Elementary.h>
+#include <stdio.h>
+#include <string.h>
+
+// Definitions
+// For checking the result of the positive test case.
+#define TET_CHECK_PASS(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err == (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_PASS]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+// For checking the result of the negative test case.
+#define TET_CHECK_FAIL(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err != (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_FAIL]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+#define MARKS 10000
+#define MONTHS 120
+#define CHECKED_MARKS 500
+#define CHECKED_MONTHS 30
+#define CELLS_MAX 8192
+
+Evas_Object *main_win = NULL;
+
+typedef struct
+{
+   struct tm time;
+   Elm_Calendar_Mark_Repeat_Type repeat;
+   const char *type;
+} Checked_Mark;
+
+typedef struct
+{
+   int cit;
+   const char *type;
+} Marked_Cell;
+
+static Checked_Mark checked_marks[CHECKED_MARKS];
+static Marked_Cell got[CELLS_MAX], expected[CELLS_MAX];
+static int got_count, expected_count;
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_calendar_marks_flip_func_01(void);
+static void utc_UIFW_elm_calendar_marks_flip_func_02(void);
+static void utc_UIFW_elm_calendar_marks_flip_func_03(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_calendar_marks_flip_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_calendar_marks_flip_func_02, NEGATIVE_TC_IDX },
+	{ utc_UIFW_elm_calendar_marks_flip_func_03, POSITIVE_TC_IDX },
+    { NULL, 0 }
+};
+
+static void startup(void)
+{
+   tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+
+   elm_init(0, NULL);
+   main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+   evas_object_show(main_win);
+}
+
+static void cleanup(void)
+{
+   if (NULL != main_win)
+     {
+        evas_object_del(main_win);
+        main_win = NULL;
+     }
+
+   elm_shutdown();
+   tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+// Flips through the months and returns the time spent per month.
+static double _flip(Evas_Object *cal, struct tm *start, int months)
+{
+   struct tm t = *start;
+   double t0;
+   int i;
+
+   t0 = ecore_time_get();
+   for (i = 0; i < months; i++)
+     {
+        t.tm_mday = 1;
+        t.tm_mon = (start->tm_mon + i) % 12;
+        t.tm_year = start->tm_year + (start->tm_mon + i) / 12;
+        elm_calendar_selected_time_set(cal, &t);
+     }
+   return (ecore_time_get() - t0) / months;
+}
+
+/**
+ * @brief Positive test case of month flips with many marks
+ */
+static void utc_UIFW_elm_calendar_marks_flip_func_01(void)
+{
+   static const char *types[] = { "holiday", "checked" };
+   Evas_Object *test_eo = NULL;
+   struct tm start, t;
+   double per_month, per_month_cached;
+   int i;
+
+   test_eo = elm_calendar_add(main_win);
+   TET_CHECK_PASS(NULL, test_eo);
+   elm_calendar_min_max_year_set(test_eo, 2000, 2030);
+
+   memset(&start, 0, sizeof(start));
+   start.tm_year = 110;
+   start.tm_mday = 1;
+
+   srand(44);
+   for (i = 0; i < MARKS; i++)
+     {
+        Elm_Calendar_Mark_Repeat_Type repeat;
+        int r = rand() % 100;
+
+        // Mostly one-off events, some recurring ones.
+        if (r < 80) repeat = ELM_CALENDAR_UNIQUE;
+        else if (r < 85) repeat = ELM_CALENDAR_DAILY;
+        else if (r < 90) repeat = ELM_CALENDAR_WEEKLY;
+        else if (r < 95) repeat = ELM_CALENDAR_MONTHLY;
+        else repeat = ELM_CALENDAR_ANNUALLY;
+
+        t = start;
+        t.tm_mon = rand() % (MONTHS + 12);
+        t.tm_mday = 1 + rand() % 28;
+        mktime(&t);
+        if (!elm_calendar_mark_add(test_eo, types[i & 1], &t, repeat))
+          {
+             tet_infoline("elm_calendar_mark_add() failed in positive test case");
+             tet_result(TET_FAIL);
+             return;
+          }
+     }
+
+   per_month = _flip(test_eo, &start, MONTHS);
+   // The last displayed months are still materialized.
+   t = start;
+   t.tm_mon += MONTHS - 3;
+   mktime(&t);
+   per_month_cached = _flip(test_eo, &t, 3);
+   tet_printf("%d marks: %.3f ms per month, %.3f ms per cached month",
+              MARKS, per_month * 1000.0, per_month_cached * 1000.0);
+
+   if (eina_list_count(elm_calendar_marks_get(test_eo)) != MARKS)
+     {
+        tet_infoline("elm_calendar_marks_get() failed in positive test case");
+        tet_result(TET_FAIL);
+        return;
+     }
+   elm_calendar_marks_clear(test_eo);
+   elm_calendar_marks_draw(test_eo);
+
+   tet_result(TET_PASS);
+   tet_infoline("month flips passed in positive test case");
+   evas_object_del(test_eo);
+   test_eo = NULL;
+}
+
+/**
+ * @brief Negative test case of month flips with many marks
+ */
+static void utc_UIFW_elm_calendar_marks_flip_func_02(void)
+{
+   struct tm t;
+
+   memset(&t, 0, sizeof(t));
+   t.tm_year = 110;
+   t.tm_mday = 1;
+   if (elm_calendar_mark_add(NULL, "checked", &t, ELM_CALENDAR_DAILY))
+     {
+        tet_infoline("elm_calendar_mark_add() failed in negative test case");
+        tet_result(TET_FAIL);
+        return;
+     }
+   elm_calendar_marks_draw(NULL);
+   tet_infoline("month flips passed in negative test case");
+   tet_result(TET_PASS);
+}
+
+static const char *mark_types[] = { "holiday", "checked" };
+
+// Records the cells marked by the last month drawn, in drawing order.
+static void _cit_signal(void *data, Evas_Object *obj, const char *emission, const char *source)
+{
+   char type[16];
+   int cit, i;
+
+   if (sscanf(emission, "cit_%d,%15s", &cit, type) != 2) return;
+   if ((cit == 0) && (!strcmp(type, "clear")))
+     {
+        got_count = 0;
+        return;
+     }
+   for (i = 0; i < 2; i++)
+     {
+        if (strcmp(type, mark_types[i])) continue;
+        if (got_count < CELLS_MAX)
+          {
+             got[got_count].cit = cit;
+             got[got_count].type = mark_types[i];
+          }
+        got_count++;
+     }
+}
+
+static void _expected_add(int cit, const char *type)
+{
+   if (expected_count < CELLS_MAX)
+     {
+        expected[expected_count].cit = cit;
+        expected[expected_count].type = type;
+     }
+   expected_count++;
+}
+
+// The cells marked in a month, walking every mark like the calendar did
+// before the marks were indexed.
+static void _expected_walk(int year, int month, int first_week_day)
+{
+   struct tm first, last;
+   int first_day_it, maxdays, i, day;
+
+   memset(&first, 0, sizeof(first));
+   first.tm_year = year;
+   first.tm_mon = month;
+   first.tm_mday = 1;
+   first.tm_hour = 12;
+   last = first;
+   last.tm_mon++;
+   last.tm_mday = 0;
+   mktime(&first);
+   mktime(&last);
+   maxdays = last.tm_mday;
+   first_day_it = (first.tm_wday - first_week_day + 7) % 7;
+
+   expected_count = 0;
+   for (i = 0; i < CHECKED_MARKS; i++)
+     {
+        struct tm *mtime = &checked_marks[i].time;
+        const char *type = checked_marks[i].type;
+        int mday_it = mtime->tm_mday + first_day_it - 1;
+
+        switch (checked_marks[i].repeat)
+          {
+           case ELM_CALENDAR_UNIQUE:
+              if ((mtime->tm_mon == month) && (mtime->tm_year == year))
+                _expected_add(mday_it, type);
+              break;
+           case ELM_CALENDAR_DAILY:
+           case ELM_CALENDAR_WEEKLY:
+              if (((mtime->tm_year == year) && (mtime->tm_mon < month)) ||
+                  (mtime->tm_year < year))
+                day = 1;
+              else if ((mtime->tm_year == year) && (mtime->tm_mon == month))
+                day = mtime->tm_mday;
+              else
+                break;
+              for (; day <= maxdays; day++)
+                if ((checked_marks[i].repeat == ELM_CALENDAR_DAILY) ||
+                    (mtime->tm_wday == (day + first_day_it - 1) % 7))
+                  _expected_add(day + first_day_it - 1, type);
+              break;
+           case ELM_CALENDAR_MONTHLY:
+              if (((mtime->tm_year < year) ||
+                   ((mtime->tm_year == year) && (mtime->tm_mon <= month))) &&
+                  (mtime->tm_mday <= maxdays))
+                _expected_add(mday_it, type);
+              break;
+           case ELM_CALENDAR_ANNUALLY:
+              if ((mtime->tm_year <= year) && (mtime->tm_mon == month) &&
+                  (mtime->tm_mday <= maxdays))
+                _expected_add(mday_it, type);
+              break;
+           default:
+              break;
+          }
+     }
+}
+
+// Shows a month and compares its marked cells with a walk of all marks.
+static Eina_Bool _month_check(Evas_Object *cal, int year, int month)
+{
+   struct tm t;
+   int i;
+
+   memset(&t, 0, sizeof(t));
+   t.tm_year = year;
+   t.tm_mon = month;
+   t.tm_mday = 1;
+   t.tm_hour = 12;
+   mktime(&t);
+   got_count = 0;
+   elm_calendar_selected_time_set(cal, &t);
+   edje_message_signal_process();
+
+   _expected_walk(year, month, elm_calendar_first_day_of_week_get(cal));
+   if ((got_count != expected_count) || (got_count > CELLS_MAX))
+     {
+        tet_printf("%d/%d: %d marked cells, expected %d",
+                   month + 1, year + 1900, got_count, expected_count);
+        return EINA_FALSE;
+     }
+   for (i = 0; i < got_count; i++)
+     if ((got[i].cit != expected[i].cit) || (got[i].type != expected[i].type))
+       {
+          tet_printf("%d/%d: cell %d marked %s, expected cell %d marked %s",
+                     month + 1, year + 1900, got[i].cit, got[i].type,
+                     expected[i].cit, expected[i].type);
+          return EINA_FALSE;
+       }
+   return EINA_TRUE;
+}
+
+/**
+ * @brief Positive test case of month flips, indexed marks against a walk
+ * of all marks
+ */
+static void utc_UIFW_elm_calendar_marks_flip_func_03(void)
+{
+   static const Elm_Calendar_Weekday days[] = {
+      ELM_DAY_SUNDAY, ELM_DAY_MONDAY, ELM_DAY_SATURDAY
+   };
+   Evas_Object *test_eo = NULL, *edje = NULL, *o;
+   Eina_List *members;
+   int i, d, m;
+
+   test_eo = elm_calendar_add(main_win);
+   TET_CHECK_PASS(NULL, test_eo);
+   elm_calendar_min_max_year_set(test_eo, 2000, 2030);
+   members = evas_object_smart_members_get(test_eo);
+   EINA_LIST_FREE(members, o)
+     if ((!edje) && (!strcmp(evas_object_type_get(o), "edje"))) edje = o;
+   TET_CHECK_PASS(NULL, edje);
+   edje_object_signal_callback_add(edje, "cit_*", "elm", _cit_signal, NULL);
+
+   srand(4403);
+   for (i = 0; i < CHECKED_MARKS; i++)
+     {
+        Checked_Mark *mark = &checked_marks[i];
+
+        memset(&mark->time, 0, sizeof(mark->time));
+        mark->time.tm_year = 110;
+        mark->time.tm_mon = rand() % (CHECKED_MONTHS + 12);
+        mark->time.tm_mday = 1 + rand() % 31;
+        mark->time.tm_hour = 12;
+        mktime(&mark->time);
+        mark->repeat = rand() % (ELM_CALENDAR_ANNUALLY + 1);
+        mark->type = mark_types[rand() % 2];
+        if (!elm_calendar_mark_add(test_eo, mark->type, &mark->time,
+                                   mark->repeat))
+          {
+             tet_infoline("elm_calendar_mark_add() failed in positive test case");
+             tet_result(TET_FAIL);
+             return;
+          }
+     }
+
+   for (d = 0; d < (int)(sizeof(days) / sizeof(days[0])); d++)
+     {
+        elm_calendar_first_day_of_week_set(test_eo, days[d]);
+        for (m = 0; m < CHECKED_MONTHS; m++)
+          if (!_month_check(test_eo, 110 + m / 12, m % 12))
+            {
+               tet_infoline("month flips failed in positive test case");
+               tet_result(TET_FAIL);
+               return;
+            }
+        // Back to the months kept materialized.
+        for (m = CHECKED_MONTHS - 1; m >= CHECKED_MONTHS - 3; m--)
+          if (!_month_check(test_eo, 110 + m / 12, m % 12))
+            {
+               tet_infoline("month flips failed in positive test case");
+               tet_result(TET_FAIL);
+               return;
+            }
+     }
+
+   evas_object_del(test_eo);
+   tet_result(TET_PASS);
+}
@@ -27,6 +27,8 @@
 }
 
 
+#define ITEMS 10
+
 Evas_Object *main_win;
 
 static void startup(void);
@@ -36,6 +38,7 @@ void (*tet_startup)(void) = startup;
 void (*tet_cleanup)(void) = cleanup;
 
 static void utc_UIFW_elm_ctxpopup_item_del_func_01(void);
+static void utc_UIFW_elm_ctxpopup_item_del_func_02(void);
 
 enum {
 	POSITIVE_TC_IDX = 0x01,
@@ -44,6 +47,7 @@ enum {
 
 struct tet_testlist tet_testlist[] = {
 	{ utc_UIFW_elm_ctxpopup_item_del_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_ctxpopup_item_del_func_02, POSITIVE_TC_IDX },
 	{ NULL, 0 }
 };
 
@@ -66,6 +70,18 @@ static void cleanup(void)
 	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
 }
 
+static int _objects_count(const Evas_Object *obj)
+{
+	Eina_List *members;
+	Evas_Object *o;
+	int count = 1;
+
+	members = evas_object_smart_members_get(obj);
+	EINA_LIST_FREE(members, o)
+		count += _objects_count(o);
+	return count;
+}
+
 /**
  * @brief Positive test case of elm_object_item_del()
  */
@@ -79,4 +95,36 @@ static void utc_UIFW_elm_ctxpopup_item_del_func_01(void)
 	tet_result(TET_PASS);
 }
 
+/**
+ * @brief Positive test case of elm_object_item_del(), item views reused
+ * by another ctxpopup
+ */
+static void utc_UIFW_elm_ctxpopup_item_del_func_02(void)
+{
+	Evas_Object *ctx1, *ctx2;
+	Elm_Object_Item *items[ITEMS];
+	int i, count;
+
+	ctx1 = elm_ctxpopup_add(main_win);
+	for (i = 0; i < ITEMS; i++)
+		items[i] = elm_ctxpopup_item_append(ctx1, "TEST", NULL, NULL, NULL);
+	for (i = 0; i < ITEMS; i++)
+		elm_object_item_del(items[i]);
 
+	// The second ctxpopup takes the views the first one gave back, they
+	// must not go away with the first one.
+	ctx2 = elm_ctxpopup_add(main_win);
+	for (i = 0; i < ITEMS; i++)
+		items[i] = elm_ctxpopup_item_append(ctx2, "TEST", NULL, NULL, NULL);
+	count = _objects_count(ctx2);
+	evas_object_del(ctx1);
+	if (_objects_count(ctx2) != count) {
+		tet_infoline("elm_object_item_del() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	for (i = 0; i < ITEMS; i++)
+		elm_object_item_del(items[i]);
+	evas_object_del(ctx2);
+	tet_result(TET_PASS);
+}
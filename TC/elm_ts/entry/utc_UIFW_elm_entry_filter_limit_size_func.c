@@ -0,0 +1,256 @@
+#include <tet_api.h>
+#include <Elementary.h>
+
+// Definitions
+// For checking the result of the positive test case.
+#define TET_CHECK_PASS(x1, y...) \
+{ \
+	char *err = y; \
+	if (strcmp(err,x1) == 0) \
+		{ \
+			tet_printf("[TET_CHECK_PASS]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+// For checking the result of the negative test case.
+#define TET_CHECK_FAIL(x1, y...) \
+{ \
+	char *err = y; \
+	if (strcmp(err,x1) != 0) \
+		{ \
+			tet_printf("[TET_CHECK_FAIL]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+#define RUNS 2000
+
+Evas_Object *main_win, *main_bg;
+Evas_Object *test_win, *test_bg;
+Evas_Object *test_eo = NULL;
+
+void _elm_precondition(void);
+static void _win_del(void *data, Evas_Object *obj, void *event_info);
+
+static void _win_del(void *data, Evas_Object *obj, void *event_info)
+{
+	elm_exit();
+}
+
+void _elm_precondition(void)
+{
+	elm_init(0, NULL);
+
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	elm_win_title_set(main_win, "Elementary Unit Test Suite");
+	evas_object_smart_callback_add(main_win, "delete,request", _win_del, NULL);
+	main_bg = elm_bg_add(main_win);
+	evas_object_size_hint_weight_set(main_bg, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+
+	evas_object_resize(main_win, 320, 480);
+	evas_object_show(main_win);
+}
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_entry_filter_limit_size_func_01(void);
+static void utc_UIFW_elm_entry_filter_limit_size_func_02(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_entry_filter_limit_size_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_entry_filter_limit_size_func_02, NEGATIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static void startup(void)
+{
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+
+	_elm_precondition();
+
+	test_win = elm_win_add(NULL, "Entry", ELM_WIN_BASIC);
+	elm_win_title_set(test_win, "Entry");
+	elm_win_autodel_set(test_win, 1);
+
+	test_bg = elm_bg_add(test_win);
+	elm_win_resize_object_add(test_win, test_bg);
+	evas_object_size_hint_weight_set(test_bg, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+	evas_object_show(test_bg);
+
+	evas_object_resize(test_win, 480, 800);
+	evas_object_show(test_win);
+
+	tet_infoline("[[ TET_MSG ]]:: Completing startup");
+}
+
+static void cleanup(void)
+{
+	if ( NULL != main_win ) {
+		main_win = NULL;
+	}
+
+	if ( NULL != main_bg ) {
+		main_bg = NULL;
+	}
+
+	if ( NULL != test_win ) {
+		test_win = NULL;
+	}
+
+	if ( NULL != test_bg ) {
+		test_bg = NULL;
+	}
+
+	if ( NULL != test_eo ) {
+		test_eo = NULL;
+	}
+
+	elm_exit();
+
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+// The limiter as it was before it became a single pass: one markup to
+// utf8 conversion per fragment. The filter must still trim like this.
+static void _reference_limit(char **text, int can_add, int bytes)
+{
+	int i = 0, current_len = 0;
+	char *new_text;
+
+	new_text = *text;
+	current_len = strlen(*text);
+	while (*new_text) {
+		int idx = 0, unit_size = 0;
+		char *markup, *utfstr;
+
+		if (*new_text == '<') {
+			while (*(new_text + idx) != '>') {
+				idx++;
+				if (!*(new_text + idx)) break;
+			}
+		}
+		else if (*new_text == '&') {
+			while (*(new_text + idx) != ';') {
+				idx++;
+				if (!*(new_text + idx)) break;
+			}
+		}
+		idx = evas_string_char_next_get(new_text, idx, NULL);
+		markup = strndup(new_text, idx);
+		utfstr = elm_entry_markup_to_utf8(markup);
+		unit_size = bytes ? strlen(utfstr) : evas_string_char_len_get(utfstr);
+		free(utfstr);
+		free(markup);
+		if (can_add < unit_size) {
+			if (!i) {
+				free(*text);
+				*text = NULL;
+				return;
+			}
+			can_add = 0;
+			memmove(new_text, new_text + idx, current_len - ((new_text + idx) - *text) + 1);
+			current_len -= idx;
+		}
+		else {
+			new_text += idx;
+			can_add -= unit_size;
+		}
+		i++;
+	}
+}
+
+static char *_random_markup(void)
+{
+	static const char *pieces[] = {
+		"a", "Z", "7", " ", "\xea\xb0\x80", "\xc3\xa9",
+		"<br>", "<br/>", "<br />", "<tab>", "<tab />", "<ps>", "<ps />",
+		"<b>", "</b>", "<font_size=20>", "</font_size>",
+		"<item size=10x10 vsize=full href=a></item>",
+		"&amp;", "&lt;", "&gt;", "&nbsp;", "&quot;", "&unknown;",
+		"&#65;", "&#x263a;", "&#x1F600;"
+	};
+	static const char *tails[] = { "", "<b", "&amp", "<", "&" };
+	int n = rand() % 24, i;
+	char *s;
+
+	s = calloc(1, 24 * 64 + 8);
+	for (i = 0; i < n; i++)
+		strcat(s, pieces[rand() % (sizeof(pieces) / sizeof(pieces[0]))]);
+	strcat(s, tails[rand() % (sizeof(tails) / sizeof(tails[0]))]);
+	return s;
+}
+
+/**
+ * @brief Positive test case of elm_entry_filter_limit_size()
+ */
+static void utc_UIFW_elm_entry_filter_limit_size_func_01(void)
+{
+	Elm_Entry_Filter_Limit_Size lim;
+	int run;
+
+	test_eo = elm_entry_add(test_win);
+	srand(43);
+	for (run = 0; run < RUNS; run++) {
+		char *text, *expected, *utf;
+		int bytes = run & 1, max, newlen;
+
+		text = _random_markup();
+		expected = strdup(text);
+		max = rand() % 16 + 1;
+		lim.max_char_count = bytes ? 0 : max;
+		lim.max_byte_count = bytes ? max : 0;
+
+		utf = elm_entry_markup_to_utf8(expected);
+		newlen = bytes ? strlen(utf) : evas_string_char_len_get(utf);
+		free(utf);
+		if (newlen > max) _reference_limit(&expected, max, bytes);
+
+		elm_entry_filter_limit_size(&lim, test_eo, &text);
+		if ((!text != !expected) ||
+		    (text && strcmp(text, expected))) {
+			tet_printf("limit %d %s: got \"%s\", expected \"%s\"", max,
+				   bytes ? "bytes" : "chars",
+				   text ? text : "(null)",
+				   expected ? expected : "(null)");
+			tet_infoline("elm_entry_filter_limit_size() failed in positive test case");
+			tet_result(TET_FAIL);
+			return;
+		}
+		free(text);
+		free(expected);
+	}
+	evas_object_del(test_eo);
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of ug_init elm_entry_filter_limit_size()
+ */
+static void utc_UIFW_elm_entry_filter_limit_size_func_02(void)
+{
+	Elm_Entry_Filter_Limit_Size lim = { 4, 0 };
+	char *text = NULL;
+
+	test_eo = elm_entry_add(test_win);
+	elm_entry_filter_limit_size(&lim, test_eo, &text);
+	elm_entry_filter_limit_size(NULL, test_eo, &text);
+	if (text) {
+		tet_infoline("elm_entry_filter_limit_size() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	evas_object_del(test_eo);
+	tet_result(TET_PASS);
+}
@@ -0,0 +1,123 @@
+#include <tet_api.h>
+#include <Elementary.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+Evas_Object *main_win;
+Evas_Object *target;
+char recording[] = "/tmp/utc_gesture_layer_XXXXXX";
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_gesture_layer_profile_get_func_01(void);
+static void utc_UIFW_elm_gesture_layer_profile_get_func_02(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_gesture_layer_profile_get_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_gesture_layer_profile_get_func_02, NEGATIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static Evas_Event_Flags
+_gesture_cb(void *data, void *event_info)
+{
+	return EVAS_EVENT_FLAG_NONE;
+}
+
+static void startup(void)
+{
+	FILE *f;
+	int fd, i;
+
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+	elm_init(0, NULL);
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	evas_object_resize(main_win, 400, 400);
+	evas_object_show(main_win);
+
+	target = evas_object_rectangle_add(evas_object_evas_get(main_win));
+	evas_object_color_set(target, 0, 0, 0, 0);
+	evas_object_resize(target, 400, 400);
+	evas_object_show(target);
+
+	/* Two finger pinch: second finger moves away from first one */
+	fd = mkstemp(recording);
+	f = fdopen(fd, "w");
+	fprintf(f, "1000 down 0 100 200\n");
+	fprintf(f, "1008 down 1 150 200\n");
+	for (i = 1; i <= 200; i++)
+		fprintf(f, "%d move 1 %d 200\n", 1008 + (i * 8), 150 + i);
+	fprintf(f, "2610 up 1 350 200\n");
+	fprintf(f, "2612 up 0 100 200\n");
+	fclose(f);
+}
+
+static void cleanup(void)
+{
+	unlink(recording);
+	if ( NULL != main_win ) {
+		evas_object_del(main_win);
+	       	main_win = NULL;
+	}
+	elm_shutdown();
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+/**
+ * @brief Positive test case of elm_gesture_layer_profile_get()
+ */
+static void utc_UIFW_elm_gesture_layer_profile_get_func_01(void)
+{
+	Elm_Gesture_Profile_Info info;
+	Elm_Gesture_Type types[] = { ELM_GESTURE_MOMENTUM, ELM_GESTURE_N_LINES,
+		ELM_GESTURE_ZOOM, ELM_GESTURE_ROTATE };
+	Evas_Object *glayer = elm_gesture_layer_add(main_win);
+	unsigned int i;
+
+	elm_gesture_layer_attach(glayer, target);
+	for (i = 0; i < sizeof(types) / sizeof(types[0]); i++)
+		elm_gesture_layer_cb_set(glayer, types[i],
+				ELM_GESTURE_STATE_MOVE, _gesture_cb, NULL);
+	elm_gesture_layer_profile_enabled_set(glayer, EINA_TRUE);
+	elm_gesture_layer_replay_file(glayer, recording);
+
+	for (i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+		if (!elm_gesture_layer_profile_get(glayer, types[i], &info) ||
+				(!info.calls)) {
+			tet_infoline("elm_gesture_layer_profile_get() failed in positive test case");
+			tet_result(TET_FAIL);
+			return;
+		}
+		tet_printf("gesture %d: %u events, %f us/event\n", types[i],
+				info.calls, (info.time * 1000000.0) / info.calls);
+	}
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of ug_init elm_gesture_layer_profile_get()
+ */
+static void utc_UIFW_elm_gesture_layer_profile_get_func_02(void)
+{
+	Elm_Gesture_Profile_Info info;
+	Evas_Object *glayer = elm_gesture_layer_add(main_win);
+
+	/* No callbacks set for taps, so nothing is profiled */
+	if (elm_gesture_layer_profile_get(glayer, ELM_GESTURE_N_TAPS, &info) ||
+			elm_gesture_layer_profile_get(NULL, ELM_GESTURE_N_TAPS, &info)) {
+		tet_infoline("elm_gesture_layer_profile_get() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
@@ -0,0 +1,117 @@
+#include <tet_api.h>
+#include <Elementary.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+Evas_Object *main_win;
+Evas_Object *target;
+char recording[] = "/tmp/utc_gesture_layer_XXXXXX";
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_gesture_layer_replay_file_func_01(void);
+static void utc_UIFW_elm_gesture_layer_replay_file_func_02(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_gesture_layer_replay_file_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_gesture_layer_replay_file_func_02, NEGATIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static Evas_Event_Flags
+_momentum_cb(void *data, void *event_info)
+{
+	return EVAS_EVENT_FLAG_NONE;
+}
+
+static void startup(void)
+{
+	FILE *f;
+	int fd, i;
+
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+	elm_init(0, NULL);
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	evas_object_resize(main_win, 400, 400);
+	evas_object_show(main_win);
+
+	target = evas_object_rectangle_add(evas_object_evas_get(main_win));
+	evas_object_color_set(target, 0, 0, 0, 0);
+	evas_object_resize(target, 400, 400);
+	evas_object_show(target);
+
+	/* A single finger drag: down, 20 moves 16ms apart, up */
+	fd = mkstemp(recording);
+	f = fdopen(fd, "w");
+	fprintf(f, "# timestamp event device x y\n");
+	fprintf(f, "1000 down 0 20 200\n");
+	for (i = 1; i <= 20; i++)
+		fprintf(f, "%d move 0 %d 200\n", 1000 + (i * 16), 20 + (i * 15));
+	fprintf(f, "1336 up 0 320 200\n");
+	fclose(f);
+}
+
+static void cleanup(void)
+{
+	unlink(recording);
+	if ( NULL != main_win ) {
+		evas_object_del(main_win);
+	       	main_win = NULL;
+	}
+	elm_shutdown();
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+/**
+ * @brief Positive test case of elm_gesture_layer_replay_file()
+ */
+static void utc_UIFW_elm_gesture_layer_replay_file_func_01(void)
+{
+	Elm_Gesture_Profile_Info info;
+	Evas_Object *glayer = elm_gesture_layer_add(main_win);
+
+	elm_gesture_layer_attach(glayer, target);
+	elm_gesture_layer_cb_set(glayer, ELM_GESTURE_MOMENTUM,
+			ELM_GESTURE_STATE_END, _momentum_cb, NULL);
+
+	if (!elm_gesture_layer_replay_file(glayer, recording)) {
+		tet_infoline("elm_gesture_layer_replay_file() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	elm_gesture_layer_profile_get(glayer, ELM_GESTURE_MOMENTUM, &info);
+	if ((info.transitions[ELM_GESTURE_STATE_START] != 1) ||
+			(info.transitions[ELM_GESTURE_STATE_END] != 1)) {
+		tet_infoline("elm_gesture_layer_replay_file() did not report momentum in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of ug_init elm_gesture_layer_replay_file()
+ */
+static void utc_UIFW_elm_gesture_layer_replay_file_func_02(void)
+{
+	Evas_Object *glayer = elm_gesture_layer_add(main_win);
+
+	/* Not attached to any target */
+	if (elm_gesture_layer_replay_file(glayer, recording)) {
+		tet_infoline("elm_gesture_layer_replay_file() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
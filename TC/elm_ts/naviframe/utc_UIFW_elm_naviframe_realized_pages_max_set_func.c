@@ -0,0 +1,244 @@
+#include <tet_api.h>
+#include <Elementary.h>
+
+// Definitions
+// For checking the result of the positive test case.
+#define TET_CHECK_PASS(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err == (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_PASS]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+// For checking the result of the negative test case.
+#define TET_CHECK_FAIL(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err != (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_FAIL]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+#define PAGES 500
+#define REALIZED 3
+
+Evas_Object *main_win;
+
+static int deleted;
+static Evas_Object *saved;
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_01(void);
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_02(void);
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_03(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_naviframe_realized_pages_max_set_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_naviframe_realized_pages_max_set_func_02, NEGATIVE_TC_IDX },
+	{ utc_UIFW_elm_naviframe_realized_pages_max_set_func_03, POSITIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static void startup(void)
+{
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+	elm_init(0, NULL);
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	evas_object_show(main_win);
+}
+
+static void cleanup(void)
+{
+	if ( NULL != main_win ) {
+		evas_object_del(main_win);
+	       	main_win = NULL;
+	}
+	elm_shutdown();
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+static int _objects_count(const Evas_Object *obj)
+{
+	Eina_List *members;
+	Evas_Object *o;
+	int count = 1;
+
+	members = evas_object_smart_members_get(obj);
+	EINA_LIST_FREE(members, o)
+		count += _objects_count(o);
+	return count;
+}
+
+// Every live object of the canvas layer holding obj, smart members
+// included.
+static int _canvas_objects_count(Evas_Object *obj)
+{
+	Evas_Object *o, *below;
+	int count = 0;
+
+	for (o = obj; (below = evas_object_below_get(o)); o = below);
+	for (; o; o = evas_object_above_get(o))
+		count += _objects_count(o);
+	return count;
+}
+
+static Evas_Object *_page_new(Evas_Object *parent)
+{
+	Evas_Object *box, *btn;
+	int i;
+
+	box = elm_box_add(parent);
+	for (i = 0; i < 10; i++) {
+		btn = elm_button_add(box);
+		elm_object_text_set(btn, "button");
+		elm_box_pack_end(box, btn);
+		evas_object_show(btn);
+	}
+	return box;
+}
+
+static Evas_Object *_page_restore(void *data, Elm_Object_Item *it)
+{
+	return _page_new(data);
+}
+
+static void _page_save(void *data, Elm_Object_Item *it, Evas_Object *content)
+{
+	saved = content;
+}
+
+static void _page_del(void *data, Evas *e, Evas_Object *obj, void *event_info)
+{
+	deleted++;
+}
+
+/**
+ * @brief Positive test case of elm_naviframe_realized_pages_max_set()
+ */
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_01(void)
+{
+	Evas_Object *nf, *content;
+	Elm_Object_Item *it;
+	int i, page_objects = 0, item_objects = 0, base, objects = 0, max;
+
+	nf = elm_naviframe_add(main_win);
+	evas_object_resize(nf, 480, 800);
+	evas_object_show(nf);
+	elm_naviframe_realized_pages_max_set(nf, REALIZED);
+	base = _canvas_objects_count(nf);
+
+	for (i = 0; i < PAGES; i++) {
+		content = _page_new(nf);
+		if (!i) page_objects = _objects_count(content);
+		it = elm_naviframe_item_push(nf, "page", NULL, NULL, content, NULL);
+		elm_naviframe_item_unrealize_cb_set(it, NULL, _page_restore, nf);
+		// What an item costs besides its page, back button included.
+		if (i == 1) item_objects = _canvas_objects_count(nf) - objects - page_objects;
+		objects = _canvas_objects_count(nf);
+	}
+
+	// Only the top pages keep their contents alive, the live objects of
+	// the whole canvas stay bounded.
+	objects -= base;
+	max = PAGES * item_objects + (REALIZED + 1) * page_objects;
+	if (objects > max) {
+		tet_printf("%d live canvas objects for %d pages, expected at most %d",
+			   objects, PAGES, max);
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	// A page is recreated when it comes back on top.
+	it = elm_naviframe_bottom_item_get(nf);
+	if (elm_naviframe_item_realized_get(it)) {
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	elm_naviframe_item_promote(it);
+	if ((!elm_naviframe_item_realized_get(it)) ||
+	    (!elm_object_item_content_get(it))) {
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	evas_object_del(nf);
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of elm_naviframe_realized_pages_max_set()
+ */
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_02(void)
+{
+	elm_naviframe_realized_pages_max_set(NULL, REALIZED);
+	if (elm_naviframe_realized_pages_max_get(NULL) != 0) {
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Positive test case of elm_naviframe_realized_pages_max_set(),
+ * with content preserve on pop
+ */
+static void utc_UIFW_elm_naviframe_realized_pages_max_set_func_03(void)
+{
+	Evas_Object *nf, *content;
+	Elm_Object_Item *it;
+
+	nf = elm_naviframe_add(main_win);
+	evas_object_resize(nf, 480, 800);
+	evas_object_show(nf);
+	elm_naviframe_content_preserve_on_pop_set(nf, EINA_TRUE);
+	elm_naviframe_realized_pages_max_set(nf, 1);
+	deleted = 0;
+	saved = NULL;
+
+	// Nobody takes the content without a save callback, it is deleted.
+	content = _page_new(nf);
+	evas_object_event_callback_add(content, EVAS_CALLBACK_DEL, _page_del, NULL);
+	it = elm_naviframe_item_push(nf, "page", NULL, NULL, content, NULL);
+	elm_naviframe_item_unrealize_cb_set(it, NULL, _page_restore, nf);
+	elm_naviframe_item_push(nf, "page", NULL, NULL, _page_new(nf), NULL);
+	if ((elm_naviframe_item_realized_get(it)) || (deleted != 1)) {
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	// The save callback gets it hidden and keeps it.
+	it = elm_naviframe_top_item_get(nf);
+	content = elm_object_item_content_get(it);
+	elm_naviframe_item_unrealize_cb_set(it, _page_save, _page_restore, nf);
+	elm_naviframe_item_push(nf, "page", NULL, NULL, _page_new(nf), NULL);
+	if ((elm_naviframe_item_realized_get(it)) || (saved != content) ||
+	    (evas_object_visible_get(content))) {
+		tet_infoline("elm_naviframe_realized_pages_max_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	evas_object_del(content);
+	evas_object_del(nf);
+	tet_result(TET_PASS);
+}
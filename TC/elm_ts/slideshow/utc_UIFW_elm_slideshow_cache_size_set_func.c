@@ -0,0 +1,195 @@
+#include <tet_api.h>
+#include <Elementary.h>
+#include <string.h>
+#include <unistd.h>
+
+// Definitions
+// For checking the result of the positive test case.
+#define TET_CHECK_PASS(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err == (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_PASS]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+// For checking the result of the negative test case.
+#define TET_CHECK_FAIL(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err != (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_FAIL]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+#define ITEMS 10
+#define IMAGE_SIZE 512 // decoded in 1 MB
+#define CACHE_SIZE 3 // in MB, three images
+
+Evas_Object *main_win;
+
+static const char *image_file = "/tmp/utc_UIFW_elm_slideshow_cache_size_set.png";
+static Elm_Slideshow_Item_Class itc;
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_slideshow_cache_size_set_func_01(void);
+static void utc_UIFW_elm_slideshow_cache_size_set_func_02(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_slideshow_cache_size_set_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_slideshow_cache_size_set_func_02, NEGATIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static void startup(void)
+{
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+	elm_init(0, NULL);
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	evas_object_show(main_win);
+}
+
+static void cleanup(void)
+{
+	if ( NULL != main_win ) {
+		evas_object_del(main_win);
+	       	main_win = NULL;
+	}
+	unlink(image_file);
+	elm_shutdown();
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+static Eina_Bool _image_file_make(void)
+{
+	Evas_Object *img;
+	void *data;
+	Eina_Bool ret;
+
+	img = evas_object_image_add(evas_object_evas_get(main_win));
+	evas_object_image_size_set(img, IMAGE_SIZE, IMAGE_SIZE);
+	data = evas_object_image_data_get(img, EINA_TRUE);
+	if (data) memset(data, 0xff, IMAGE_SIZE * IMAGE_SIZE * 4);
+	evas_object_image_data_set(img, data);
+	ret = evas_object_image_save(img, image_file, NULL, NULL);
+	evas_object_del(img);
+	return ret;
+}
+
+static Evas_Object *_item_get(void *data, Evas_Object *obj)
+{
+	Evas_Object *img;
+
+	img = evas_object_image_filled_add(evas_object_evas_get(obj));
+	evas_object_image_file_set(img, image_file, NULL);
+	return img;
+}
+
+// Lets the pending decodes finish.
+static void _preload_wait(Evas_Object *obj)
+{
+	Elm_Object_Item *it;
+	Eina_Bool loading = EINA_TRUE;
+	int i, n;
+
+	for (i = 0; (i < 500) && (loading); i++) {
+		ecore_main_loop_iterate();
+		loading = EINA_FALSE;
+		for (n = 0; (it = elm_slideshow_item_nth_get(obj, n)); n++)
+			if ((elm_slideshow_item_object_get(it)) &&
+			    (!elm_slideshow_item_ready_get(it)))
+				loading = EINA_TRUE;
+		if (loading) usleep(10000);
+	}
+}
+
+// Decoded images kept by the cache, in MB.
+static int _cached_size_get(Evas_Object *obj)
+{
+	Elm_Object_Item *it;
+	int n, size = 0;
+
+	for (n = 0; (it = elm_slideshow_item_nth_get(obj, n)); n++)
+		if ((elm_slideshow_item_object_get(it)) &&
+		    (elm_slideshow_item_ready_get(it)))
+			size++;
+	return size;
+}
+
+/**
+ * @brief Positive test case of elm_slideshow_cache_size_set()
+ */
+static void utc_UIFW_elm_slideshow_cache_size_set_func_01(void)
+{
+	Evas_Object *slideshow;
+	int i, size;
+
+	if (!_image_file_make()) {
+		tet_infoline("elm_slideshow_cache_size_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	itc.func.get = _item_get;
+	itc.func.del = NULL;
+
+	slideshow = elm_slideshow_add(main_win);
+	TET_CHECK_PASS(NULL, slideshow);
+	elm_slideshow_cache_before_set(slideshow, 3);
+	elm_slideshow_cache_after_set(slideshow, 3);
+	elm_slideshow_cache_size_set(slideshow, CACHE_SIZE);
+	for (i = 0; i < ITEMS; i++)
+		elm_slideshow_item_add(slideshow, &itc, NULL);
+	evas_object_show(slideshow);
+
+	// Seven items fall in the cache window, only three fit in its size.
+	for (i = 0; i < ITEMS; i++) {
+		if (i) elm_slideshow_next(slideshow);
+		_preload_wait(slideshow);
+		size = _cached_size_get(slideshow);
+		if ((size > CACHE_SIZE) ||
+		    (!elm_slideshow_item_object_get(elm_slideshow_item_current_get(slideshow)))) {
+			tet_printf("%d MB cached, expected at most %d MB", size, CACHE_SIZE);
+			tet_infoline("elm_slideshow_cache_size_set() failed in positive test case");
+			tet_result(TET_FAIL);
+			return;
+		}
+	}
+
+	if (elm_slideshow_cache_size_get(slideshow) != CACHE_SIZE) {
+		tet_infoline("elm_slideshow_cache_size_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	evas_object_del(slideshow);
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of elm_slideshow_cache_size_set()
+ */
+static void utc_UIFW_elm_slideshow_cache_size_set_func_02(void)
+{
+	elm_slideshow_cache_size_set(NULL, CACHE_SIZE);
+	if (elm_slideshow_cache_size_get(NULL) != -1) {
+		tet_infoline("elm_slideshow_cache_size_set() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
@@ -0,0 +1,175 @@
+#include <tet_api.h>
+#include <Elementary.h>
+
+// Definitions
+// For checking the result of the positive test case.
+#define TET_CHECK_PASS(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err == (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_PASS]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+// For checking the result of the negative test case.
+#define TET_CHECK_FAIL(x1, y...) \
+{ \
+	Evas_Object *err = y; \
+	if (err != (x1)) \
+		{ \
+			tet_printf("[TET_CHECK_FAIL]:: %s[%d] : Test has failed..", __FILE__,__LINE__); \
+			tet_result(TET_FAIL); \
+			return; \
+		} \
+}
+
+#define ITEMS 5
+
+Evas_Object *main_win;
+
+static void startup(void);
+static void cleanup(void);
+
+void (*tet_startup)(void) = startup;
+void (*tet_cleanup)(void) = cleanup;
+
+static void utc_UIFW_elm_toolbar_shrink_mode_set_func_01(void);
+static void utc_UIFW_elm_toolbar_shrink_mode_set_func_02(void);
+
+enum {
+	POSITIVE_TC_IDX = 0x01,
+	NEGATIVE_TC_IDX,
+};
+
+struct tet_testlist tet_testlist[] = {
+	{ utc_UIFW_elm_toolbar_shrink_mode_set_func_01, POSITIVE_TC_IDX },
+	{ utc_UIFW_elm_toolbar_shrink_mode_set_func_02, NEGATIVE_TC_IDX },
+	{ NULL, 0 }
+};
+
+static void startup(void)
+{
+	tet_infoline("[[ TET_MSG ]]:: ============ Startup ============ ");
+	elm_init(0, NULL);
+	main_win = elm_win_add(NULL, "main", ELM_WIN_BASIC);
+	evas_object_show(main_win);
+}
+
+static void cleanup(void)
+{
+	if ( NULL != main_win ) {
+		evas_object_del(main_win);
+	       	main_win = NULL;
+	}
+	elm_shutdown();
+	tet_infoline("[[ TET_MSG ]]:: ============ Cleanup ============ ");
+}
+
+// Runs the pending sizing and the resize job of the toolbar.
+static void _layout_flush(Evas_Object *obj)
+{
+	int i;
+
+	for (i = 0; i < 5; i++) {
+		evas_smart_objects_calculate(evas_object_evas_get(obj));
+		ecore_main_loop_iterate();
+	}
+}
+
+// Items whose view is packed and shown.
+static int _items_shown_count(Evas_Object *obj)
+{
+	Elm_Object_Item *it;
+	Evas_Object *view;
+	int count = 0;
+
+	for (it = elm_toolbar_first_item_get(obj); it;
+	     it = elm_toolbar_item_next_get(it)) {
+		view = elm_toolbar_item_object_get(it);
+		if ((evas_object_visible_get(view)) &&
+		    (evas_object_smart_parent_get(view)))
+			count++;
+	}
+	return count;
+}
+
+/**
+ * @brief Positive test case of elm_toolbar_shrink_mode_set()
+ */
+static void utc_UIFW_elm_toolbar_shrink_mode_set_func_01(void)
+{
+	Evas_Object *tb;
+	Elm_Object_Item *it;
+	int i;
+
+	tb = elm_toolbar_add(main_win);
+	TET_CHECK_PASS(NULL, tb);
+	elm_toolbar_shrink_mode_set(tb, ELM_TOOLBAR_SHRINK_EXPAND);
+	for (i = 0; i < ITEMS; i++)
+		elm_toolbar_item_append(tb, NULL, "item", NULL, NULL);
+	evas_object_resize(tb, 480, 100);
+	evas_object_show(tb);
+	_layout_flush(tb);
+
+	// A toolbar created in expand mode lays out all of its items.
+	if (_items_shown_count(tb) != ITEMS) {
+		tet_infoline("elm_toolbar_shrink_mode_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	// Items deleted in another mode are not walked once back in expand
+	// mode.
+	elm_toolbar_shrink_mode_set(tb, ELM_TOOLBAR_SHRINK_MENU);
+	_layout_flush(tb);
+	it = elm_toolbar_first_item_get(tb);
+	elm_object_item_del(elm_toolbar_item_next_get(it));
+	elm_object_item_del(it);
+	elm_toolbar_shrink_mode_set(tb, ELM_TOOLBAR_SHRINK_EXPAND);
+	_layout_flush(tb);
+	if ((elm_toolbar_items_count(tb) != ITEMS - 2) ||
+	    (_items_shown_count(tb) != ITEMS - 2)) {
+		tet_infoline("elm_toolbar_shrink_mode_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	// Same for items added in hide mode.
+	elm_toolbar_shrink_mode_set(tb, ELM_TOOLBAR_SHRINK_HIDE);
+	_layout_flush(tb);
+	elm_toolbar_item_append(tb, NULL, "item", NULL, NULL);
+	elm_object_item_del(elm_toolbar_last_item_get(tb));
+	elm_toolbar_item_append(tb, NULL, "item", NULL, NULL);
+	elm_toolbar_shrink_mode_set(tb, ELM_TOOLBAR_SHRINK_EXPAND);
+	_layout_flush(tb);
+	if (_items_shown_count(tb) != ITEMS - 1) {
+		tet_infoline("elm_toolbar_shrink_mode_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+
+	if (elm_toolbar_shrink_mode_get(tb) != ELM_TOOLBAR_SHRINK_EXPAND) {
+		tet_infoline("elm_toolbar_shrink_mode_set() failed in positive test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	evas_object_del(tb);
+	tet_result(TET_PASS);
+}
+
+/**
+ * @brief Negative test case of elm_toolbar_shrink_mode_set()
+ */
+static void utc_UIFW_elm_toolbar_shrink_mode_set_func_02(void)
+{
+	elm_toolbar_shrink_mode_set(NULL, ELM_TOOLBAR_SHRINK_EXPAND);
+	if (elm_toolbar_shrink_mode_get(NULL) != ELM_TOOLBAR_SHRINK_NONE) {
+		tet_infoline("elm_toolbar_shrink_mode_set() failed in negative test case");
+		tet_result(TET_FAIL);
+		return;
+	}
+	tet_result(TET_PASS);
+}
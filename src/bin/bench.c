@@ -0,0 +1,987 @@
+#ifdef HAVE_CONFIG_H
+# include "elementary_config.h"
+#endif
+#include <Elementary.h>
+#include "elm_widget.h"
+#include <stdint.h>
+#include <time.h>
+
+/* Headless widget benchmarks.
+ *
+ * Every scenario builds a widget in a window of the "shot:manual"
+ * engine and goes through the fill, scroll, resize and theme phases,
+ * a fixed number of frames each. A frame is the scripted step (adding
+ * items, synthetic input, ...), the main loop iteration and the
+ * animator tick it triggers, and the render of the window. One line is
+ * written per frame and one per phase summary, tab separated:
+ *
+ *   frame    <scenario> <phase> <frame> <ms> <allocations>
+ *   summary  <scenario> <phase> <frames> <avg ms> <max ms> <avg allocations>
+ *   pool     <scenario> <phase> <item hits> <item misses> <view hits>
+ *            <view misses> <dropped>
+ *
+ * A thresholds file holds
+ * "<scenario>[.<phase>] <avg ms> [<avg allocs> [<max ms>]]" lines;
+ * exceeding one of them makes the run fail. No display nor GPU are
+ * needed. */
+
+#define BENCH_FRAMES 60
+#define BENCH_ITEMS  2000
+#define BENCH_FILES  50000
+#define BENCH_BOX_ITEMS 5000
+#define BENCH_STARTUP_RUNS 10
+#define BENCH_RESCALE_WIDGETS 10000
+#define BENCH_RESCALE_FRAMES_MAX 100000
+#define BENCH_TOOLBAR_ITEMS 200
+#define BENCH_TOOLBAR_REBUILDS 1000
+#define BENCH_TOOLBAR_RESIZE_ITEMS 1000
+#define BENCH_TOOLBAR_RESIZE_FRAMES 500
+
+typedef struct _Bench           Bench;
+typedef struct _Bench_Scenario  Bench_Scenario;
+typedef struct _Bench_Stats     Bench_Stats;
+typedef struct _Bench_Threshold Bench_Threshold;
+
+typedef enum
+{
+   PHASE_FILL,
+   PHASE_SCROLL,
+   PHASE_RESIZE,
+   PHASE_THEME,
+   PHASE_LAST
+} Bench_Phase;
+
+static const char *_phase_names[PHASE_LAST] =
+{
+   "fill", "scroll", "resize", "theme"
+};
+
+struct _Bench
+{
+   Evas_Object *win;
+   FILE        *out;
+   const char  *argv0;
+   const char  *shot_dir;
+   Eina_List   *thresholds;
+   int          frames, items, files;
+   int          failures;
+};
+
+struct _Bench_Scenario
+{
+   const char  *name;
+   Evas_Object *(*add)(Bench *b, Evas_Object *win);
+   /* adds a batch of the content, frame goes from 0 to frames - 1 */
+   void         (*fill)(Bench *b, Evas_Object *obj, int frame);
+   /* NULL for a vertical drag over the object */
+   void         (*scroll)(Bench *b, Evas_Object *obj, int frame);
+   void         (*del)(Bench *b, Evas_Object *obj);
+};
+
+struct _Bench_Stats
+{
+   double       total, max;
+   unsigned int allocs;
+   int          frames;
+};
+
+struct _Bench_Threshold
+{
+   char  *name;
+   double max_ms;
+   double max_allocs;
+   double max_frame_ms;
+};
+
+/* Allocation counting. With glibc every malloc of the process goes
+ * through here, elsewhere the counts stay at 0. */
+static unsigned int _allocs = 0;
+
+#ifdef __GLIBC__
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+void *
+malloc(size_t size)
+{
+   __sync_add_and_fetch(&_allocs, 1);
+   return __libc_malloc(size);
+}
+
+void *
+calloc(size_t nmemb, size_t size)
+{
+   __sync_add_and_fetch(&_allocs, 1);
+   return __libc_calloc(nmemb, size);
+}
+
+void *
+realloc(void *ptr, size_t size)
+{
+   __sync_add_and_fetch(&_allocs, 1);
+   return __libc_realloc(ptr, size);
+}
+#endif
+
+static double
+_now(void)
+{
+   struct timespec t;
+
+   clock_gettime(CLOCK_MONOTONIC, &t);
+   return t.tv_sec + (t.tv_nsec / 1000000000.0);
+}
+
+static unsigned int
+_timestamp(void)
+{
+   return (unsigned int)(_now() * 1000.0);
+}
+
+static char *
+_item_text_get(void *data, Evas_Object *obj __UNUSED__, const char *part __UNUSED__)
+{
+   char buf[64];
+
+   snprintf(buf, sizeof(buf), "Item # %i", (int)(uintptr_t)data);
+   return strdup(buf);
+}
+
+static int
+_batch_get(Bench *b, int total, int frame)
+{
+   return (total * (frame + 1)) / b->frames - (total * frame) / b->frames;
+}
+
+/* genlist */
+static Elm_Genlist_Item_Class *_genlist_itc = NULL;
+
+static Evas_Object *
+_genlist_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   _genlist_itc = elm_genlist_item_class_new();
+   _genlist_itc->item_style = "default";
+   _genlist_itc->func.text_get = _item_text_get;
+   return elm_genlist_add(win);
+}
+
+static void
+_genlist_fill(Bench *b, Evas_Object *obj, int frame)
+{
+   int i, n = _batch_get(b, b->items, frame);
+   int base = (b->items * frame) / b->frames;
+
+   for (i = 0; i < n; i++)
+     elm_genlist_item_append(obj, _genlist_itc, (void *)(uintptr_t)(base + i),
+                             NULL, ELM_GENLIST_ITEM_NONE, NULL, NULL);
+}
+
+static void
+_genlist_del(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__)
+{
+   elm_genlist_item_class_free(_genlist_itc);
+   _genlist_itc = NULL;
+}
+
+/* gengrid */
+static Elm_Gengrid_Item_Class *_gengrid_itc = NULL;
+
+static Evas_Object *
+_gengrid_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   Evas_Object *obj;
+
+   _gengrid_itc = elm_gengrid_item_class_new();
+   _gengrid_itc->item_style = "default";
+   _gengrid_itc->func.text_get = _item_text_get;
+   obj = elm_gengrid_add(win);
+   elm_gengrid_item_size_set(obj, 96, 96);
+   return obj;
+}
+
+static void
+_gengrid_fill(Bench *b, Evas_Object *obj, int frame)
+{
+   int i, n = _batch_get(b, b->items, frame);
+   int base = (b->items * frame) / b->frames;
+
+   for (i = 0; i < n; i++)
+     elm_gengrid_item_append(obj, _gengrid_itc, (void *)(uintptr_t)(base + i),
+                             NULL, NULL);
+}
+
+static void
+_gengrid_del(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__)
+{
+   elm_gengrid_item_class_free(_gengrid_itc);
+   _gengrid_itc = NULL;
+}
+
+/* entry */
+static Evas_Object *
+_entry_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   Evas_Object *obj = elm_entry_add(win);
+
+   elm_entry_scrollable_set(obj, EINA_TRUE);
+   elm_object_focus_set(obj, EINA_TRUE);
+   return obj;
+}
+
+static void
+_entry_fill(Bench *b, Evas_Object *obj, int frame)
+{
+   int i, n = _batch_get(b, b->items / 10, frame);
+
+   for (i = 0; i < n; i++)
+     elm_entry_entry_append(obj, "Lorem ipsum <b>dolor</b> sit amet, "
+                            "consectetur &amp; adipiscing elit.<br>");
+}
+
+static void
+_entry_scroll(Bench *b __UNUSED__, Evas_Object *obj, int frame)
+{
+   Evas *e = evas_object_evas_get(obj);
+   const char *key = ((frame / 20) & 1) ? "Up" : "Down";
+   int i;
+
+   for (i = 0; i < 5; i++)
+     {
+        evas_event_feed_key_down(e, key, key, NULL, NULL, _timestamp(), NULL);
+        evas_event_feed_key_up(e, key, key, NULL, NULL, _timestamp(), NULL);
+     }
+}
+
+/* map */
+static Evas_Object *
+_map_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   return elm_map_add(win);
+}
+
+static void
+_map_fill(Bench *b __UNUSED__, Evas_Object *obj, int frame)
+{
+   elm_map_zoom_set(obj, frame % 18);
+   elm_map_region_show(obj, 2.352 + frame * 0.01, 48.857);
+}
+
+/* transit */
+static Eina_List *_transit_rects = NULL;
+
+static Evas_Object *
+_transit_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   return elm_box_add(win);
+}
+
+static void
+_transit_fill(Bench *b, Evas_Object *obj, int frame)
+{
+   Evas *e = evas_object_evas_get(obj);
+   int i, n = _batch_get(b, b->items / 10, frame);
+
+   for (i = 0; i < n; i++)
+     {
+        Evas_Object *rect = evas_object_rectangle_add(e);
+        Elm_Transit *transit;
+
+        evas_object_color_set(rect, 255, 128, (i * 8) & 0xff, 255);
+        evas_object_resize(rect, 32, 32);
+        evas_object_move(rect, (i * 37) % 440, (frame * 13) % 760);
+        evas_object_show(rect);
+        _transit_rects = eina_list_append(_transit_rects, rect);
+
+        transit = elm_transit_add();
+        elm_transit_object_add(transit, rect);
+        elm_transit_effect_translation_add(transit, 0, 0, 40, 80);
+        elm_transit_effect_rotation_add(transit, 0.0, 360.0);
+        elm_transit_duration_set(transit, 1.0);
+        elm_transit_repeat_times_set(transit, -1);
+        elm_transit_go(transit);
+     }
+}
+
+static void
+_transit_scroll(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__, int frame __UNUSED__)
+{
+   /* nothing but the running transits */
+}
+
+static void
+_transit_del(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__)
+{
+   Evas_Object *rect;
+
+   /* transits go away with their last object */
+   EINA_LIST_FREE(_transit_rects, rect)
+     evas_object_del(rect);
+}
+
+/* box, the incremental layout with BENCH_BOX_ITEMS children. They are
+ * kept aside so that picking one is not part of a frame. */
+static Evas_Object **_box_rects = NULL;
+static int _box_count = 0;
+
+static Evas_Object *
+_box_add(Bench *b __UNUSED__, Evas_Object *win)
+{
+   Evas_Object *scroller = elm_scroller_add(win);
+   Evas_Object *box = elm_box_add(scroller);
+
+   _box_rects = calloc(BENCH_BOX_ITEMS, sizeof(Evas_Object *));
+   _box_count = 0;
+   elm_object_content_set(scroller, box);
+   evas_object_show(box);
+   return scroller;
+}
+
+static void
+_box_fill(Bench *b, Evas_Object *obj, int frame)
+{
+   Evas_Object *box = elm_object_content_get(obj);
+   Evas *e = evas_object_evas_get(obj);
+   int i, n = _batch_get(b, BENCH_BOX_ITEMS, frame);
+
+   for (i = 0; (i < n) && (_box_rects); i++)
+     {
+        Evas_Object *rect = evas_object_rectangle_add(e);
+
+        evas_object_size_hint_min_set(rect, 100 + (i % 50), 20);
+        evas_object_show(rect);
+        elm_box_pack_end(box, rect);
+        _box_rects[_box_count++] = rect;
+     }
+}
+
+static void _drag(Bench *b, Evas_Object *obj, int frame);
+
+static void
+_box_scroll(Bench *b, Evas_Object *obj, int frame)
+{
+   Evas_Object *child;
+
+   /* one child changing its hints every frame */
+   if (_box_count)
+     {
+        child = _box_rects[(frame * 97) % _box_count];
+        evas_object_size_hint_min_set(child, 100 + frame % 50, 20 + frame % 7);
+     }
+   _drag(b, obj, frame);
+}
+
+static void
+_box_del(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__)
+{
+   free(_box_rects);
+   _box_rects = NULL;
+   _box_count = 0;
+}
+
+/* fileselector, listing a large directory */
+static char _fs_dir[PATH_MAX];
+
+static Evas_Object *
+_fileselector_add(Bench *b, Evas_Object *win)
+{
+   Evas_Object *obj;
+   char buf[PATH_MAX];
+   int i;
+
+   snprintf(_fs_dir, sizeof(_fs_dir), "%s/elm_bench_XXXXXX",
+            getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp");
+   if (!mkdtemp(_fs_dir)) _fs_dir[0] = 0;
+   for (i = 0; (_fs_dir[0]) && (i < b->files); i++)
+     {
+        FILE *f;
+
+        snprintf(buf, sizeof(buf), "%s/file_%06i.txt", _fs_dir, (i * 7919) % b->files);
+        f = fopen(buf, "w");
+        if (f) fclose(f);
+     }
+
+   obj = elm_fileselector_add(win);
+   elm_fileselector_expandable_set(obj, EINA_FALSE);
+   return obj;
+}
+
+static void
+_fileselector_fill(Bench *b __UNUSED__, Evas_Object *obj, int frame)
+{
+   if ((!frame) && (_fs_dir[0])) elm_fileselector_path_set(obj, _fs_dir);
+}
+
+static void
+_fileselector_del(Bench *b __UNUSED__, Evas_Object *obj __UNUSED__)
+{
+   if (_fs_dir[0]) ecore_file_recursive_rm(_fs_dir);
+   _fs_dir[0] = 0;
+}
+
+static const Bench_Scenario _scenarios[] =
+{
+   { "genlist", _genlist_add, _genlist_fill, NULL, _genlist_del },
+   { "gengrid", _gengrid_add, _gengrid_fill, NULL, _gengrid_del },
+   { "entry", _entry_add, _entry_fill, _entry_scroll, NULL },
+   { "map", _map_add, _map_fill, NULL, NULL },
+   { "transit", _transit_add, _transit_fill, _transit_scroll, _transit_del },
+   { "box", _box_add, _box_fill, _box_scroll, _box_del },
+   { "fileselector", _fileselector_add, _fileselector_fill, NULL, _fileselector_del },
+   { NULL, NULL, NULL, NULL, NULL }
+};
+
+/* A vertical drag over the middle of the object, restarting every 20
+ * frames. */
+static void
+_drag(Bench *b, Evas_Object *obj, int frame)
+{
+   Evas *e = evas_object_evas_get(obj);
+   Evas_Coord x, y, w, h, cx, cy;
+   int step = frame % 20;
+
+   evas_object_geometry_get(obj, &x, &y, &w, &h);
+   cx = x + (w / 2);
+   cy = y + ((h * 3) / 4) - ((step * (h / 2)) / 19);
+   evas_event_feed_mouse_move(e, cx, cy, _timestamp(), NULL);
+   if (!step)
+     evas_event_feed_mouse_down(e, 1, EVAS_BUTTON_NONE, _timestamp(), NULL);
+   if ((step == 19) || (frame == b->frames - 1))
+     evas_event_feed_mouse_up(e, 1, EVAS_BUTTON_NONE, _timestamp(), NULL);
+}
+
+static void
+_resize(Bench *b, int frame)
+{
+   static const Evas_Coord sizes[][2] =
+   {
+      { 480, 800 }, { 800, 480 }, { 320, 480 }, { 720, 1280 }
+   };
+
+   evas_object_resize(b->win, sizes[frame % 4][0], sizes[frame % 4][1]);
+}
+
+static void
+_frame_render(Bench *b)
+{
+   ecore_main_loop_iterate();
+   ecore_animator_custom_tick();
+   elm_win_shot_render(b->win, NULL);
+}
+
+static void
+_frame_report(Bench *b, const char *scenario, const char *phase, int frame, double ms, unsigned int allocs, Bench_Stats *st)
+{
+   fprintf(b->out, "frame\t%s\t%s\t%i\t%.3f\t%u\n",
+           scenario, phase, frame, ms, allocs);
+   st->total += ms;
+   if (ms > st->max) st->max = ms;
+   st->allocs += allocs;
+   st->frames++;
+}
+
+static const Bench_Threshold *
+_threshold_find(Bench *b, const char *scenario, const char *phase)
+{
+   const Bench_Threshold *th, *found = NULL;
+   Eina_List *l;
+   size_t len = strlen(scenario);
+
+   EINA_LIST_FOREACH(b->thresholds, l, th)
+     {
+        if (strncmp(th->name, scenario, len)) continue;
+        if ((th->name[len] == '.') && (!strcmp(th->name + len + 1, phase)))
+          return th;
+        if (!th->name[len]) found = th;
+     }
+   return found;
+}
+
+static void
+_summary_report(Bench *b, const char *scenario, const char *phase, const Bench_Stats *st)
+{
+   const Bench_Threshold *th;
+   double avg, allocs;
+
+   if (!st->frames) return;
+   avg = st->total / st->frames;
+   allocs = (double)st->allocs / st->frames;
+   fprintf(b->out, "summary\t%s\t%s\t%i\t%.3f\t%.3f\t%.1f\n",
+           scenario, phase, st->frames, avg, st->max, allocs);
+
+   th = _threshold_find(b, scenario, phase);
+   if (!th) return;
+   if ((th->max_ms > 0.0) && (avg > th->max_ms))
+     {
+        fprintf(stderr, "FAIL\t%s\t%s\tavg %.3f ms > %.3f ms\n",
+                scenario, phase, avg, th->max_ms);
+        b->failures++;
+     }
+   if ((th->max_allocs > 0.0) && (allocs > th->max_allocs))
+     {
+        fprintf(stderr, "FAIL\t%s\t%s\tavg %.1f allocations > %.1f\n",
+                scenario, phase, allocs, th->max_allocs);
+        b->failures++;
+     }
+   if ((th->max_frame_ms > 0.0) && (st->max > th->max_frame_ms))
+     {
+        fprintf(stderr, "FAIL\t%s\t%s\tmax %.3f ms > %.3f ms\n",
+                scenario, phase, st->max, th->max_frame_ms);
+        b->failures++;
+     }
+}
+
+static void
+_scenario_run(Bench *b, const Bench_Scenario *sc)
+{
+   Evas_Object *obj;
+   int phase, i;
+
+   evas_object_resize(b->win, 480, 800);
+   obj = sc->add(b, b->win);
+   evas_object_size_hint_weight_set(obj, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(b->win, obj);
+   evas_object_show(obj);
+   _frame_render(b);
+
+   for (phase = 0; phase < PHASE_LAST; phase++)
+     {
+        Bench_Stats st;
+
+        memset(&st, 0, sizeof(st));
+        for (i = 0; i < b->frames; i++)
+          {
+             unsigned int a0 = _allocs;
+             double t0 = _now();
+
+             switch (phase)
+               {
+                case PHASE_FILL:
+                   sc->fill(b, obj, i);
+                   break;
+                case PHASE_SCROLL:
+                   if (sc->scroll) sc->scroll(b, obj, i);
+                   else _drag(b, obj, i);
+                   break;
+                case PHASE_RESIZE:
+                   _resize(b, i);
+                   break;
+                case PHASE_THEME:
+                   elm_theme_flush(NULL);
+                   break;
+               }
+             _frame_render(b);
+             _frame_report(b, sc->name, _phase_names[phase], i,
+                           (_now() - t0) * 1000.0, _allocs - a0, &st);
+          }
+        if (b->shot_dir)
+          {
+             char buf[PATH_MAX];
+
+             snprintf(buf, sizeof(buf), "%s/%s-%s.png", b->shot_dir,
+                      sc->name, _phase_names[phase]);
+             elm_win_shot_render(b->win, buf);
+          }
+        _summary_report(b, sc->name, _phase_names[phase], &st);
+     }
+
+   evas_object_del(obj);
+   if (sc->del) sc->del(b, obj);
+   _frame_render(b);
+}
+
+/* Startup, with the eet config and with the mapped config image. Each
+ * run is a child process timing its own elm_init(), with HOME in a
+ * temporary directory so the config it writes doesn't touch the user's
+ * one. */
+static void
+_startup_run(Bench *b)
+{
+   static const char *modes[] = { "eet", "image" };
+   char cmd[PATH_MAX + 64], home[PATH_MAX];
+   char *old_home = NULL;
+   int m, i, runs = b->frames;
+
+   if (runs > BENCH_STARTUP_RUNS) runs = BENCH_STARTUP_RUNS;
+   snprintf(home, sizeof(home), "%s/elm_bench_home_XXXXXX",
+            getenv("TMPDIR") ? getenv("TMPDIR") : "/tmp");
+   if (!mkdtemp(home))
+     {
+        fprintf(stderr, "startup: cannot create a temporary HOME\n");
+        return;
+     }
+   if (getenv("HOME")) old_home = strdup(getenv("HOME"));
+   setenv("HOME", home, 1);
+   snprintf(cmd, sizeof(cmd), "'%s' --startup-child", b->argv0);
+   for (m = 0; m < 2; m++)
+     {
+        Bench_Stats st;
+
+        memset(&st, 0, sizeof(st));
+        setenv("ELM_CONFIG_IMAGE", m ? "1" : "0", 1);
+        /* the first run leaves the image behind for the next ones */
+        for (i = -1; i < runs; i++)
+          {
+             unsigned int allocs = 0;
+             double ms = 0.0;
+             FILE *p = popen(cmd, "r");
+
+             if (!p) break;
+             if (fscanf(p, "%lf %u", &ms, &allocs) != 2) ms = -1.0;
+             pclose(p);
+             if (ms < 0.0) break;
+             if (i >= 0)
+               _frame_report(b, "startup", modes[m], i, ms, allocs, &st);
+          }
+        _summary_report(b, "startup", modes[m], &st);
+     }
+   unsetenv("ELM_CONFIG_IMAGE");
+   if (old_home) setenv("HOME", old_home, 1);
+   else unsetenv("HOME");
+   free(old_home);
+   ecore_file_recursive_rm(home);
+}
+
+/* A scale change over a tree of BENCH_RESCALE_WIDGETS widgets, applied
+ * at once and staged over frames. The max frame time of a phase is the
+ * longest main loop stall the change caused. */
+static void
+_rescale_run(Bench *b)
+{
+   static const char *modes[] = { "sync", "staged" };
+   static const double scales[] = { 1.5, 1.0 };
+   Evas_Object *sc, *bx, *bt;
+   int m, i;
+
+   evas_object_resize(b->win, 480, 800);
+   sc = elm_scroller_add(b->win);
+   evas_object_size_hint_weight_set(sc, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(b->win, sc);
+   bx = elm_box_add(sc);
+   evas_object_size_hint_weight_set(bx, EVAS_HINT_EXPAND, 0.0);
+   for (i = 0; i < BENCH_RESCALE_WIDGETS; i++)
+     {
+        bt = elm_button_add(bx);
+        elm_object_text_set(bt, "Button");
+        elm_box_pack_end(bx, bt);
+        evas_object_show(bt);
+     }
+   elm_object_content_set(sc, bx);
+   evas_object_show(bx);
+   evas_object_show(sc);
+   _frame_render(b);
+
+   for (m = 0; m < 2; m++)
+     {
+        Bench_Stats st;
+
+        memset(&st, 0, sizeof(st));
+        for (i = 0; i < BENCH_RESCALE_FRAMES_MAX; i++)
+          {
+             unsigned int a0 = _allocs;
+             double t0 = _now();
+
+             if (!i)
+               {
+                  elm_config_scale_set(scales[m]);
+                  if (!m) elm_theme_job_finish();
+               }
+             _frame_render(b);
+             _frame_report(b, "rescale", modes[m], i,
+                           (_now() - t0) * 1000.0, _allocs - a0, &st);
+             if (elm_theme_job_progress_get() >= 1.0) break;
+          }
+        _summary_report(b, "rescale", modes[m], &st);
+     }
+
+   evas_object_del(sc);
+   _frame_render(b);
+}
+
+/* Rebuilds of a BENCH_TOOLBAR_ITEMS items toolbar, with the widget item
+ * pool of toolbars disabled and enabled. */
+static void
+_toolbar_run(Bench *b)
+{
+   static const char *modes[] = { "unpooled", "pooled" };
+   unsigned int max = elm_widget_item_pool_max_get("toolbar");
+   Elm_Widget_Item_Pool_Stats ps0, ps;
+   Evas_Object *tb;
+   int m, i, j;
+
+   evas_object_resize(b->win, 480, 800);
+   for (m = 0; m < 2; m++)
+     {
+        Bench_Stats st;
+
+        memset(&st, 0, sizeof(st));
+        elm_widget_item_pool_max_set("toolbar", m ? max : 0);
+        elm_widget_item_pool_stats_get("toolbar", &ps0);
+        for (i = 0; i < BENCH_TOOLBAR_REBUILDS; i++)
+          {
+             unsigned int a0 = _allocs;
+             double t0 = _now();
+
+             tb = elm_toolbar_add(b->win);
+             evas_object_size_hint_weight_set(tb, EVAS_HINT_EXPAND, 0.0);
+             elm_win_resize_object_add(b->win, tb);
+             for (j = 0; j < BENCH_TOOLBAR_ITEMS; j++)
+               elm_toolbar_item_append(tb, NULL, "Item", NULL, NULL);
+             evas_object_show(tb);
+             _frame_render(b);
+             evas_object_del(tb);
+             _frame_report(b, "toolbar", modes[m], i,
+                           (_now() - t0) * 1000.0, _allocs - a0, &st);
+          }
+        _summary_report(b, "toolbar", modes[m], &st);
+        elm_widget_item_pool_stats_get("toolbar", &ps);
+        fprintf(b->out, "pool\ttoolbar\t%s\t%u\t%u\t%u\t%u\t%u\n", modes[m],
+                ps.item_hits - ps0.item_hits,
+                ps.item_misses - ps0.item_misses,
+                ps.view_hits - ps0.view_hits,
+                ps.view_misses - ps0.view_misses,
+                ps.dropped - ps0.dropped);
+     }
+   elm_widget_item_pool_max_set("toolbar", max);
+   _frame_render(b);
+}
+
+/* A BENCH_TOOLBAR_RESIZE_ITEMS items toolbar of mixed priorities, its
+ * window dragged narrower and wider a few pixels every frame, with the
+ * "More" menu and with hidden items. */
+static void
+_toolbar_resize_run(Bench *b)
+{
+   static const char *modes[] = { "menu", "hide" };
+   static const Elm_Toolbar_Shrink_Mode shrink[] =
+     { ELM_TOOLBAR_SHRINK_MENU, ELM_TOOLBAR_SHRINK_HIDE };
+   Elm_Object_Item *it;
+   Evas_Object *tb;
+   int m, i, w;
+
+   for (m = 0; m < 2; m++)
+     {
+        Bench_Stats st;
+
+        memset(&st, 0, sizeof(st));
+        evas_object_resize(b->win, 480, 800);
+        tb = elm_toolbar_add(b->win);
+        elm_toolbar_shrink_mode_set(tb, shrink[m]);
+        evas_object_size_hint_weight_set(tb, EVAS_HINT_EXPAND, 0.0);
+        elm_win_resize_object_add(b->win, tb);
+        for (i = 0; i < BENCH_TOOLBAR_RESIZE_ITEMS; i++)
+          {
+             it = elm_toolbar_item_append(tb, NULL, "Item", NULL, NULL);
+             elm_toolbar_item_priority_set(it, (i * 37) % 10);
+          }
+        evas_object_show(tb);
+        _frame_render(b);
+        for (i = 0; i < BENCH_TOOLBAR_RESIZE_FRAMES; i++)
+          {
+             unsigned int a0 = _allocs;
+             double t0 = _now();
+
+             /* 200 to 1200 pixels wide and back */
+             w = (i * 7) % 2000;
+             if (w > 1000) w = 2000 - w;
+             evas_object_resize(b->win, 200 + w, 800);
+             _frame_render(b);
+             _frame_report(b, "toolbar_resize", modes[m], i,
+                           (_now() - t0) * 1000.0, _allocs - a0, &st);
+          }
+        _summary_report(b, "toolbar_resize", modes[m], &st);
+        evas_object_del(tb);
+     }
+   evas_object_resize(b->win, 480, 800);
+   _frame_render(b);
+}
+
+static int
+_startup_child(int argc, char **argv)
+{
+   unsigned int a0 = _allocs;
+   double t0 = _now();
+
+   elm_init(argc, argv);
+   printf("%.3f %u\n", (_now() - t0) * 1000.0, _allocs - a0);
+   elm_shutdown();
+   return 0;
+}
+
+static Eina_Bool
+_thresholds_load(Bench *b, const char *file)
+{
+   char line[256], name[128];
+   FILE *f = fopen(file, "r");
+
+   if (!f) return EINA_FALSE;
+   while (fgets(line, sizeof(line), f))
+     {
+        Bench_Threshold *th;
+        double ms = 0.0, allocs = 0.0, frame_ms = 0.0;
+
+        if ((line[0] == '#') ||
+            (sscanf(line, "%127s %lf %lf %lf", name, &ms, &allocs,
+                    &frame_ms) < 2))
+          continue;
+        th = calloc(1, sizeof(Bench_Threshold));
+        if (!th) break;
+        th->name = strdup(name);
+        th->max_ms = ms;
+        th->max_allocs = allocs;
+        th->max_frame_ms = frame_ms;
+        b->thresholds = eina_list_append(b->thresholds, th);
+     }
+   fclose(f);
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_selected(const char *list, const char *name)
+{
+   size_t len = strlen(name);
+   const char *p;
+
+   if (!list) return EINA_TRUE;
+   for (p = list; (p = strstr(p, name)); p += len)
+     {
+        if (((p == list) || (p[-1] == ',')) &&
+            ((!p[len]) || (p[len] == ',')))
+          return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
+static void
+_usage(const char *argv0)
+{
+   int i;
+
+   printf("Usage: %s [options]\n"
+          "  -s NAME[,NAME...]  scenarios to run (default: all)\n"
+          "  -f FRAMES          frames per phase (default: %i)\n"
+          "  -n ITEMS           items per scenario (default: %i)\n"
+          "  -F FILES           files listed by the fileselector (default: %i)\n"
+          "  -t FILE            regression thresholds\n"
+          "  -o FILE            output file (default: stdout)\n"
+          "  -d DIR             save the last frame of every phase in DIR\n"
+          "  -p FILE            write the per widget performance counters to\n"
+          "                     FILE (needs --enable-perf-counters)\n"
+          "Scenarios: startup rescale toolbar toolbar_resize", argv0, BENCH_FRAMES, BENCH_ITEMS, BENCH_FILES);
+   for (i = 0; _scenarios[i].name; i++)
+     printf(" %s", _scenarios[i].name);
+   printf("\n");
+}
+
+int
+main(int argc, char **argv)
+{
+   Bench_Threshold *th;
+   Evas_Object *bg;
+   const char *list = NULL, *out = NULL, *perf = NULL;
+   Bench b;
+   int i;
+
+   if ((argc > 1) && (!strcmp(argv[1], "--startup-child")))
+     return _startup_child(argc, argv);
+
+   eina_init();
+   memset(&b, 0, sizeof(b));
+   b.argv0 = argv[0];
+   b.frames = BENCH_FRAMES;
+   b.items = BENCH_ITEMS;
+   b.files = BENCH_FILES;
+   b.out = stdout;
+
+   for (i = 1; i < argc; i++)
+     {
+        if ((!strcmp(argv[i], "-s")) && (i < argc - 1))
+          list = argv[++i];
+        else if ((!strcmp(argv[i], "-f")) && (i < argc - 1))
+          b.frames = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-n")) && (i < argc - 1))
+          b.items = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-F")) && (i < argc - 1))
+          b.files = atoi(argv[++i]);
+        else if ((!strcmp(argv[i], "-t")) && (i < argc - 1))
+          {
+             if (!_thresholds_load(&b, argv[++i]))
+               {
+                  fprintf(stderr, "Cannot read thresholds '%s'\n", argv[i]);
+                  return 2;
+               }
+          }
+        else if ((!strcmp(argv[i], "-o")) && (i < argc - 1))
+          out = argv[++i];
+        else if ((!strcmp(argv[i], "-d")) && (i < argc - 1))
+          b.shot_dir = argv[++i];
+        else if ((!strcmp(argv[i], "-p")) && (i < argc - 1))
+          perf = argv[++i];
+        else
+          {
+             _usage(argv[0]);
+             return (!strcmp(argv[i], "-h")) ? 0 : 2;
+          }
+     }
+   if ((b.frames < 1) || (b.items < 1) || (b.files < 1))
+     {
+        _usage(argv[0]);
+        return 2;
+     }
+   if (out)
+     {
+        b.out = fopen(out, "w");
+        if (!b.out)
+          {
+             fprintf(stderr, "Cannot write to '%s'\n", out);
+             return 2;
+          }
+     }
+
+   /* no display needed: windows render to memory on request only */
+   setenv("ELM_ENGINE", "shot:manual", 1);
+
+   if (_selected(list, "startup")) _startup_run(&b);
+
+   elm_init(argc, argv);
+   if (!elm_widget_api_check(ELM_INTERNAL_API_VERSION)) return 2;
+   ecore_animator_source_set(ECORE_ANIMATOR_SOURCE_CUSTOM);
+   if (perf)
+     {
+        if (!elm_perf_available_get())
+          fprintf(stderr, "Performance counters not built in\n");
+        elm_perf_enabled_set(EINA_TRUE);
+     }
+
+   b.win = elm_win_add(NULL, "bench", ELM_WIN_BASIC);
+   bg = elm_bg_add(b.win);
+   evas_object_size_hint_weight_set(bg, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(b.win, bg);
+   evas_object_show(bg);
+   evas_object_resize(b.win, 480, 800);
+   evas_object_show(b.win);
+
+   for (i = 0; _scenarios[i].name; i++)
+     {
+        if (!_selected(list, _scenarios[i].name)) continue;
+        _scenario_run(&b, &_scenarios[i]);
+        fflush(b.out);
+     }
+   if (_selected(list, "rescale")) _rescale_run(&b);
+   if (_selected(list, "toolbar")) _toolbar_run(&b);
+   if (_selected(list, "toolbar_resize")) _toolbar_resize_run(&b);
+
+   evas_object_del(b.win);
+   if ((perf) && (elm_perf_available_get()) && (!elm_perf_dump(perf)))
+     fprintf(stderr, "Cannot write to '%s'\n", perf);
+   elm_shutdown();
+
+   EINA_LIST_FREE(b.thresholds, th)
+     {
+        free(th->name);
+        free(th);
+     }
+   if (b.out != stdout) fclose(b.out);
+   eina_shutdown();
+   return b.failures ? 1 : 0;
+}
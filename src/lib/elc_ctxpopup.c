@@ -1267,16 +1267,27 @@ _item_new(Elm_Ctxpopup_Item *item, char *group_name)
    wd = elm_widget_data_get(WIDGET(item));
    if (!wd) return;
 
-   VIEW(item) = edje_object_add(evas_object_evas_get(wd->base));
-   edje_object_mirrored_set(VIEW(item), elm_widget_mirrored_get(WIDGET(item)));
-   _elm_theme_object_set(WIDGET(item), VIEW(item), "ctxpopup", group_name,
-                         elm_widget_style_get(WIDGET(item)));
+   elm_widget_item_view_get(item, "ctxpopup", group_name);
    edje_object_signal_callback_add(VIEW(item), "elm,action,click", "",
                                    _item_select_cb, item);
    evas_object_size_hint_align_set(VIEW(item), EVAS_HINT_FILL, EVAS_HINT_FILL);
    evas_object_show(VIEW(item));
 }
 
+/* the view may go back to the item pool, leave it as _item_new() found it */
+static void
+_item_view_reset(Elm_Ctxpopup_Item *item)
+{
+   Evas_Object *box;
+
+   edje_object_signal_callback_del_full(VIEW(item), "elm,action,click", "",
+                                        _item_select_cb, item);
+   if (elm_widget_item_disabled_get(item))
+     edje_object_signal_emit(VIEW(item), "elm,state,enabled", "elm");
+   box = evas_object_smart_parent_get(VIEW(item));
+   if (box) evas_object_box_remove(box, VIEW(item));
+}
+
 static void
 _content_del(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__,
              void *event_info __UNUSED__)
@@ -1333,6 +1344,7 @@ _remove_items(Widget_Data *wd)
           eina_stringshare_del(item->label);
         if (item->icon)
           evas_object_del(item->icon);
+        _item_view_reset(item);
         wd->items = eina_list_remove(wd->items, item);
         elm_widget_item_free(item);
      }
@@ -1351,8 +1363,7 @@ _item_del_pre_hook(Elm_Object_Item *it)
 
    if (ctxpopup_it->icon)
      evas_object_del(ctxpopup_it->icon);
-   if (VIEW(ctxpopup_it))
-     evas_object_del(VIEW(ctxpopup_it));
+   _item_view_reset(ctxpopup_it);
 
    eina_stringshare_del(ctxpopup_it->label);
 
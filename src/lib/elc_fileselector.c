@@ -22,6 +22,7 @@
 #include "elm_priv.h"
 
 typedef struct _Widget_Data Widget_Data;
+typedef struct _Widget_Request Widget_Request;
 
 struct _Widget_Data
 {
@@ -46,6 +47,7 @@ struct _Widget_Data
 
 #ifdef HAVE_EIO
    Eio_File    *current;
+   Widget_Request *request;
 #endif
 
    Elm_Fileselector_Mode mode;
@@ -60,7 +62,37 @@ struct sel_data
    const char  *path;
 };
 
-typedef struct _Widget_Request Widget_Request;
+typedef enum {
+  ELM_DIRECTORY = 0,
+  ELM_FILE_IMAGE = 1,
+  ELM_FILE_UNKNOW = 2,
+  ELM_FILE_LAST
+} Elm_Fileselector_Type;
+
+#ifdef HAVE_EIO
+typedef struct _Fs_Entry Fs_Entry;
+typedef struct _Fs_Slot Fs_Slot;
+
+/* a listed file, classified and given its collation key in the eio
+ * thread, so that sorting on the main loop only needs strcmp() */
+struct _Fs_Entry
+{
+   const char *filename;
+   Elm_Fileselector_Type type;
+   int ref;
+   char key[1];
+};
+
+struct _Fs_Slot
+{
+   Elm_Object_Item *item;
+   Fs_Entry *entry;
+};
+
+/* files inserted in the view per frame at most */
+#define FS_BATCH_MAX 1024
+#endif
+
 struct _Widget_Request
 {
    Widget_Data *wd;
@@ -68,16 +100,17 @@ struct _Widget_Request
 
    Evas_Object *obj;
    const char *path;
+#ifdef HAVE_EIO
+   Eina_List *pending; /* listed, not in the view yet */
+   Fs_Slot *slots; /* in the view, in sorted order */
+   unsigned int slots_count;
+   Ecore_Animator *animator;
+   Eina_Bool listing : 1;
+   Eina_Bool stopped : 1;
+#endif
    Eina_Bool first : 1;
 };
 
-typedef enum {
-  ELM_DIRECTORY = 0,
-  ELM_FILE_IMAGE = 1,
-  ELM_FILE_UNKNOW = 2,
-  ELM_FILE_LAST
-} Elm_Fileselector_Type;
-
 static Elm_Genlist_Item_Class *list_itc[ELM_FILE_LAST];
 static Elm_Gengrid_Item_Class *grid_itc[ELM_FILE_LAST];
 
@@ -98,6 +131,9 @@ static void _populate(Evas_Object      *obj,
                       Elm_Object_Item  *parent);
 static void _do_anchors(Evas_Object *obj,
                         const char  *path);
+#ifdef HAVE_EIO
+static void _request_stop(Widget_Request *wr);
+#endif
 
 /***  ELEMENTARY WIDGET  ***/
 static void
@@ -131,8 +167,8 @@ _del_hook(Evas_Object *obj)
      }
 
 #ifdef HAVE_EIO
-   if (wd->current)
-     eio_file_cancel(wd->current);
+   if (wd->request)
+     _request_stop(wd->request);
 #endif
 
    wd->files_list = NULL;
@@ -331,11 +367,29 @@ _expand_done(void            *data,
 }
 
 static void
-_contract_done(void *data       __UNUSED__,
+_contract_done(void *data,
                Evas_Object *obj __UNUSED__,
                void            *event_info)
 {
    Elm_Object_Item *it = event_info;
+#ifdef HAVE_EIO
+   Widget_Data *wd = elm_widget_data_get(data);
+   Elm_Object_Item *parent;
+
+   /* a directory still being filled in goes away with its parent */
+   if ((wd) && (wd->request))
+     {
+        for (parent = wd->request->parent; parent;
+             parent = elm_genlist_item_parent_get(parent))
+          if (parent == it)
+            {
+               _request_stop(wd->request);
+               break;
+            }
+     }
+#else
+   (void)data;
+#endif
    elm_genlist_item_subitems_clear(it);
 }
 
@@ -559,79 +613,64 @@ _do_anchors(Evas_Object *obj,
 }
 
 #ifdef HAVE_EIO
+static void
+_entry_unref(Fs_Entry *e)
+{
+   if (--e->ref) return;
+   eina_stringshare_del(e->filename);
+   free(e);
+}
+
 static Eina_Bool
 _filter_cb(void *data __UNUSED__, Eio_File *handler, const Eina_File_Direct_Info *info)
 {
-   const char *filename;
+   const char *name;
+   Fs_Entry *e;
+   size_t len;
 
    if (info->path[info->name_start] == '.')
      return EINA_FALSE;
 
-   filename = eina_stringshare_add(info->path);
-   eio_file_associate_direct_add(handler, "filename", filename, EINA_FREE_CB(eina_stringshare_del));
+   name = info->path + info->name_start;
+   len = strxfrm(NULL, name, 0);
+   e = malloc(sizeof(Fs_Entry) + len);
+   if (!e) return EINA_FALSE;
+   strxfrm(e->key, name, len + 1);
+   e->ref = 1;
+   e->filename = eina_stringshare_add(info->path);
 
    if (info->type == EINA_FILE_DIR)
-     {
-        eio_file_associate_direct_add(handler, "type/grid", grid_itc[ELM_DIRECTORY], NULL);
-        eio_file_associate_direct_add(handler, "type/list", list_itc[ELM_DIRECTORY], NULL);
-     }
+     e->type = ELM_DIRECTORY;
+   else if (evas_object_image_extension_can_load_get(name))
+     e->type = ELM_FILE_IMAGE;
    else
-     {
-        if (evas_object_image_extension_can_load_get(info->path + info->name_start))
-          {
-             eio_file_associate_direct_add(handler, "type/grid", grid_itc[ELM_FILE_IMAGE], NULL);
-             eio_file_associate_direct_add(handler, "type/list", list_itc[ELM_FILE_IMAGE], NULL);
-          }
-        else
-          {
-             eio_file_associate_direct_add(handler, "type/grid", grid_itc[ELM_FILE_UNKNOW], NULL);
-             eio_file_associate_direct_add(handler, "type/list", list_itc[ELM_FILE_UNKNOW], NULL);
-          }
-     }
+     e->type = ELM_FILE_UNKNOW;
+
+   eio_file_associate_direct_add(handler, "entry", e, EINA_FREE_CB(_entry_unref));
 
    return EINA_TRUE;
 }
 
 static int
-_file_grid_cmp(const void *a, const void *b)
+_entry_cmp(const Fs_Entry *a, const Fs_Entry *b)
 {
-   const Elm_Object_Item *ga = a;
-   const Elm_Object_Item *gb = b;
-   const Elm_Gengrid_Item_Class *ca = elm_gengrid_item_item_class_get(ga);
-   const Elm_Gengrid_Item_Class *cb = elm_gengrid_item_item_class_get(gb);
-
-   if (ca == grid_itc[ELM_DIRECTORY])
+   if (a->type == ELM_DIRECTORY)
      {
-        if (cb != grid_itc[ELM_DIRECTORY])
+        if (b->type != ELM_DIRECTORY)
           return -1;
      }
-   else if (cb == grid_itc[ELM_DIRECTORY])
+   else if (b->type == ELM_DIRECTORY)
      {
         return 1;
      }
 
-   return strcoll(elm_object_item_data_get(ga), elm_object_item_data_get(gb));
+   return strcmp(a->key, b->key);
 }
 
 static int
-_file_list_cmp(const void *a, const void *b)
+_entry_ptr_cmp(const void *a, const void *b)
 {
-   const Elm_Object_Item *la = a;
-   const Elm_Object_Item *lb = b;
-   const Elm_Genlist_Item_Class *ca = elm_genlist_item_item_class_get(la);
-   const Elm_Genlist_Item_Class *cb = elm_genlist_item_item_class_get(lb);
-
-   if (ca == list_itc[ELM_DIRECTORY])
-     {
-        if (cb != list_itc[ELM_DIRECTORY])
-          return -1;
-     }
-   else if (cb == list_itc[ELM_DIRECTORY])
-     {
-        return 1;
-     }
-
-   return strcoll(elm_object_item_data_get(la), elm_object_item_data_get(lb));
+   return _entry_cmp(*(Fs_Entry * const *)a, *(Fs_Entry * const *)b);
 }
 
 static void
@@ -652,34 +691,95 @@ _signal_first(Widget_Request *wr)
    wr->first = EINA_FALSE;
 }
 
-static void
-_main_cb(void *data, Eio_File *handler, const Eina_File_Direct_Info *info __UNUSED__)
+static Elm_Object_Item *
+_item_insert(Widget_Request *wr, Fs_Entry *e, Elm_Object_Item *before)
 {
-   Widget_Request *wr = data;
+   Widget_Data *wd = wr->wd;
+   Elm_Object_Item *it;
 
-   if (eio_file_check(handler))
-     return ;
-   if (!wr->wd->files_list || !wr->wd->files_grid || wr->wd->current != handler)
+   if (wd->mode == ELM_FILESELECTOR_LIST)
      {
-        eio_file_cancel(handler);
-        return ;
+        Elm_Genlist_Item_Type type = wd->expand && (e->type == ELM_DIRECTORY) ?
+          ELM_GENLIST_ITEM_TREE : ELM_GENLIST_ITEM_NONE;
+
+        if (before)
+          it = elm_genlist_item_insert_before(wd->files_list, list_itc[e->type],
+                                              eina_stringshare_ref(e->filename),
+                                              wr->parent, before, type,
+                                              NULL, NULL);
+        else
+          it = elm_genlist_item_append(wd->files_list, list_itc[e->type],
+                                       eina_stringshare_ref(e->filename),
+                                       wr->parent, type, NULL, NULL);
      }
+   else
+     {
+        if (before)
+          it = elm_gengrid_item_insert_before(wd->files_grid, grid_itc[e->type],
+                                              eina_stringshare_ref(e->filename),
+                                              before, NULL, NULL);
+        else
+          it = elm_gengrid_item_append(wd->files_grid, grid_itc[e->type],
+                                       eina_stringshare_ref(e->filename),
+                                       NULL, NULL);
+     }
+   if (!it) eina_stringshare_del(e->filename);
+   return it;
+}
 
-   _signal_first(wr);
+/* sort a batch of the pending files and merge it with the ones already
+ * in the view, in a single pass over both */
+static Eina_Bool
+_request_flush(Widget_Request *wr)
+{
+   Fs_Entry **batch, *e;
+   Fs_Slot *slots;
+   unsigned int count, i, j, k;
+
+   count = eina_list_count(wr->pending);
+   if (count > FS_BATCH_MAX) count = FS_BATCH_MAX;
+   if (!count) return EINA_FALSE;
+
+   batch = malloc(count * sizeof(Fs_Entry *));
+   slots = malloc((wr->slots_count + count) * sizeof(Fs_Slot));
+   if ((!batch) || (!slots))
+     {
+        free(batch);
+        free(slots);
+        return EINA_FALSE;
+     }
+   for (i = 0; i < count; i++)
+     {
+        batch[i] = eina_list_data_get(wr->pending);
+        wr->pending = eina_list_remove_list(wr->pending, wr->pending);
+     }
+   qsort(batch, count, sizeof(Fs_Entry *), _entry_ptr_cmp);
 
-   if (wr->wd->mode == ELM_FILESELECTOR_LIST)
+   for (i = 0, j = 0, k = 0; i < count; i++)
      {
-        Eina_Bool is_dir = (eio_file_associate_find(handler, "type/list") == list_itc[ELM_DIRECTORY]);
+        Elm_Object_Item *it;
 
-        elm_genlist_item_sorted_insert(wr->wd->files_list, eio_file_associate_find(handler, "type/list"),
-                                       eina_stringshare_ref(eio_file_associate_find(handler, "filename")),
-                                       wr->parent, wr->wd->expand && is_dir ? ELM_GENLIST_ITEM_TREE : ELM_GENLIST_ITEM_NONE,
-                                       _file_list_cmp, NULL, NULL);
+        e = batch[i];
+        while ((j < wr->slots_count) && (_entry_cmp(wr->slots[j].entry, e) <= 0))
+          slots[k++] = wr->slots[j++];
+        it = _item_insert(wr, e, (j < wr->slots_count) ? wr->slots[j].item : NULL);
+        if (!it)
+          {
+             _entry_unref(e);
+             continue;
+          }
+        slots[k].item = it;
+        slots[k].entry = e;
+        k++;
      }
-   else if (wr->wd->mode == ELM_FILESELECTOR_GRID)
-     elm_gengrid_item_sorted_insert(wr->wd->files_grid, eio_file_associate_find(handler, "type/grid"),
-                                           eina_stringshare_ref(eio_file_associate_find(handler, "filename")),
-                                           _file_grid_cmp, NULL, NULL);
+   while (j < wr->slots_count)
+     slots[k++] = wr->slots[j++];
+
+   free(batch);
+   free(wr->slots);
+   wr->slots = slots;
+   wr->slots_count = k;
+   return EINA_TRUE;
 }
 
 static void
@@ -692,6 +792,81 @@ _widget_request_cleanup(Widget_Request *wr)
    free(wr);
 }
 
+/* the request lives until eio is done with it and its last batch is in
+ * the view (or it was stopped) */
+static void
+_request_free_try(Widget_Request *wr)
+{
+   Fs_Entry *e;
+   unsigned int i;
+
+   if ((wr->listing) || (wr->animator)) return;
+   if (wr->wd->request == wr) wr->wd->request = NULL;
+
+   EINA_LIST_FREE(wr->pending, e)
+     _entry_unref(e);
+   for (i = 0; i < wr->slots_count; i++)
+     _entry_unref(wr->slots[i].entry);
+   free(wr->slots);
+   _widget_request_cleanup(wr);
+}
+
+static void
+_request_stop(Widget_Request *wr)
+{
+   wr->stopped = EINA_TRUE;
+   if (wr->wd->request == wr) wr->wd->request = NULL;
+   if (wr->animator)
+     {
+        ecore_animator_del(wr->animator);
+        wr->animator = NULL;
+     }
+   /* the cancel callback may run right away and free wr */
+   if ((wr->listing) && (wr->wd->current))
+     eio_file_cancel(wr->wd->current);
+   else
+     _request_free_try(wr);
+}
+
+static Eina_Bool
+_request_flush_cb(void *data)
+{
+   Widget_Request *wr = data;
+
+   if ((!wr->stopped) && (wr->wd->files_list) && (wr->wd->files_grid))
+     {
+        _request_flush(wr);
+        if (wr->pending) return ECORE_CALLBACK_RENEW;
+     }
+   wr->animator = NULL;
+   _request_free_try(wr);
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_main_cb(void *data, Eio_File *handler, const Eina_File_Direct_Info *info __UNUSED__)
+{
+   Widget_Request *wr = data;
+   Fs_Entry *e;
+
+   if (eio_file_check(handler))
+     return ;
+   if (!wr->wd->files_list || !wr->wd->files_grid || wr->wd->current != handler)
+     {
+        eio_file_cancel(handler);
+        return ;
+     }
+
+   _signal_first(wr);
+
+   e = eio_file_associate_find(handler, "entry");
+   if (!e) return;
+   e->ref++;
+   wr->pending = eina_list_append(wr->pending, e);
+   if (!wr->animator)
+     wr->animator = ecore_animator_add(_request_flush_cb, wr);
+}
+
 static void
 _done_cb(void *data, Eio_File *handler __UNUSED__)
 {
@@ -700,7 +875,8 @@ _done_cb(void *data, Eio_File *handler __UNUSED__)
    _signal_first(wr);
 
    wr->wd->current = NULL;
-   _widget_request_cleanup(wr);
+   wr->listing = EINA_FALSE;
+   _request_free_try(wr);
 }
 
 static void
@@ -710,7 +886,8 @@ _error_cb(void *data, Eio_File *handler, int error __UNUSED__)
 
    if (wr->wd->current == handler)
      wr->wd->current = NULL;
-   _widget_request_cleanup(wr);
+   wr->listing = EINA_FALSE;
+   _request_free_try(wr);
 }
 
 #endif
@@ -794,10 +971,17 @@ _populate(Evas_Object      *obj,
                                   NULL, NULL);
      }
 #else
-   if (wd->expand && wd->current) return ;
-   if (wd->current)
-     eio_file_cancel(wd->current);
-   wr = malloc(sizeof (Widget_Request));
+   if ((wd->expand) && (wd->request))
+     {
+        /* one directory is listed at a time in the tree, and the one
+         * already listed gets the rest of its files in before it goes */
+        if (wd->request->listing) return ;
+        if ((wd->files_list) && (wd->files_grid))
+          while (_request_flush(wd->request)) ;
+     }
+   if (wd->request)
+     _request_stop(wd->request);
+   wr = calloc(1, sizeof (Widget_Request));
    if (!wr) return ;
    wr->wd = wd;
    EINA_REFCOUNT_REF(wr->wd);
@@ -805,6 +989,8 @@ _populate(Evas_Object      *obj,
    wr->obj = obj;
    wr->path = eina_stringshare_add(path);
    wr->first = EINA_TRUE;
+   wr->listing = EINA_TRUE;
+   wd->request = wr;
 
    wd->current = eio_file_stat_ls(path,
                                   _filter_cb,
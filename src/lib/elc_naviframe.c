@@ -10,6 +10,8 @@ struct _Widget_Data
 {
    Eina_Inlist  *stack;
    Evas_Object  *base;
+   int           realized_pages_max;
+   int           realized_objects_max;
    Eina_Bool     preserve: 1;
    Eina_Bool     auto_pushed: 1;
    Eina_Bool     freeze_events: 1;
@@ -39,11 +41,16 @@ struct _Elm_Naviframe_Item
    Evas_Object       *title_next_btn;
    Evas_Object       *title_icon;
    const char        *style;
+   Elm_Naviframe_Item_Save_Cb save_cb;
+   Elm_Naviframe_Item_Restore_Cb restore_cb;
+   const void        *unrealize_data;
    Evas_Coord         minw;
    Evas_Coord         minh;
    Eina_Bool          back_btn: 1;
    Eina_Bool          title_visible: 1;
    Eina_Bool          content_unfocusable : 1;
+   Eina_Bool          unrealized : 1;
+   Eina_Bool          back_btn_unrealized : 1;
 };
 
 static const char *widtype = NULL;
@@ -158,6 +165,8 @@ static void _item_content_set(Elm_Naviframe_Item *navi_it,
                               Evas_Object *content);
 static void _item_style_set(Elm_Naviframe_Item *navi_it,
                             const char *item_style);
+static void _item_realize(Elm_Naviframe_Item *it);
+static void _items_unrealize(Widget_Data *wd);
 static Elm_Naviframe_Item * _item_new(Evas_Object *obj,
                                       const char *title_label,
                                       Evas_Object *prev_btn,
@@ -844,6 +853,7 @@ _item_del_pre_hook(Elm_Object_Item *it)
         if (!wd->stack) return EINA_TRUE;
         navi_it = EINA_INLIST_CONTAINER_GET(wd->stack->last,
                                             Elm_Naviframe_Item);
+        _item_realize(navi_it);
         evas_object_show(VIEW(navi_it));
         evas_object_raise(VIEW(navi_it));
         elm_object_signal_emit(VIEW(navi_it), "elm,state,visible", "elm");
@@ -877,6 +887,8 @@ _pushed_finished(void *data,
 
    if (wd->freeze_events)
      evas_object_freeze_events_set(VIEW(it), EINA_FALSE);
+
+   _items_unrealize(wd);
 }
 
 static void
@@ -932,6 +944,94 @@ _changed_size_hints(void *data,
    _sizing_eval(data);
 }
 
+static int
+_objects_count(const Evas_Object *obj)
+{
+   Eina_List *members;
+   Evas_Object *o;
+   int count = 1;
+
+   members = evas_object_smart_members_get(obj);
+   EINA_LIST_FREE(members, o)
+     count += _objects_count(o);
+   return count;
+}
+
+static void
+_item_unrealize(Elm_Naviframe_Item *it)
+{
+   Widget_Data *wd;
+   Evas_Object *content;
+
+   if ((it->unrealized) || (!it->restore_cb)) return;
+   wd = elm_widget_data_get(WIDGET(it));
+   if (!wd) return;
+
+   content = _item_content_unset(it);
+   //with preserve on pop, the content is handed over hidden like on a
+   //pop, if there is a save callback to take it
+   if ((content) && (wd->preserve) && (it->save_cb))
+     evas_object_hide(content);
+   if (it->save_cb)
+     it->save_cb((void *)it->unrealize_data, (Elm_Object_Item *)it, content);
+   if ((content) && ((!wd->preserve) || (!it->save_cb)))
+     evas_object_del(content);
+
+   if ((it->back_btn) && (it->title_prev_btn))
+     {
+        evas_object_del(it->title_prev_btn);
+        it->back_btn_unrealized = EINA_TRUE;
+     }
+   it->unrealized = EINA_TRUE;
+}
+
+static void
+_item_realize(Elm_Naviframe_Item *it)
+{
+   Evas_Object *content;
+
+   if (!it->unrealized) return;
+   it->unrealized = EINA_FALSE;
+
+   if (it->back_btn_unrealized)
+     {
+        _title_prev_btn_set(it, _back_btn_new(WIDGET(it)), EINA_TRUE);
+        it->back_btn_unrealized = EINA_FALSE;
+     }
+   content = it->restore_cb((void *)it->unrealize_data, (Elm_Object_Item *)it);
+   if (content) _item_content_set(it, content);
+}
+
+//unrealize the pages below the top realized_pages_max ones, or once the
+//hidden ones hold more than realized_objects_max objects
+static void
+_items_unrealize(Widget_Data *wd)
+{
+   Elm_Naviframe_Item *it;
+   Eina_Inlist *l;
+   int depth = 0, objects = 0;
+
+   if ((!wd->realized_pages_max) && (!wd->realized_objects_max)) return;
+   if (!wd->stack) return;
+
+   for (l = wd->stack->last; l; l = l->prev, depth++)
+     {
+        it = EINA_INLIST_CONTAINER_GET(l, Elm_Naviframe_Item);
+        if ((!depth) || (it->unrealized)) continue;
+        //the page right below the top may still be animating out
+        if ((depth == 1) && (evas_object_visible_get(VIEW(it)))) continue;
+        if ((wd->realized_pages_max) && (depth >= wd->realized_pages_max))
+          {
+             _item_unrealize(it);
+             continue;
+          }
+        if (!wd->realized_objects_max) continue;
+        if (it->content) objects += _objects_count(it->content);
+        if (objects > wd->realized_objects_max)
+          _item_unrealize(it);
+     }
+}
+
 static void
 _item_content_set(Elm_Naviframe_Item *navi_it, Evas_Object *content)
 {
@@ -1188,6 +1288,7 @@ elm_naviframe_item_push(Evas_Object *obj,
         edje_object_message_signal_process(elm_layout_edje_get(VIEW(it)));
      }
    wd->stack = eina_inlist_append(wd->stack, EINA_INLIST_GET(it));
+   _items_unrealize(wd);
    _sizing_eval(obj);
    return (Elm_Object_Item *)it;
 }
@@ -1251,6 +1352,7 @@ elm_naviframe_item_insert_after(Evas_Object *obj,
      {
         evas_object_show(VIEW(it));
         evas_object_hide(VIEW(after));
+        _items_unrealize(wd);
      }
 
    _sizing_eval(obj);
@@ -1292,6 +1394,7 @@ elm_naviframe_item_pop(Evas_Object *obj)
              evas_object_freeze_events_set(VIEW(prev_it), EINA_TRUE);
           }
         elm_object_signal_emit(VIEW(it), "elm,state,cur,popped", "elm");
+        _item_realize(prev_it);
         evas_object_show(VIEW(prev_it));
         elm_object_signal_emit(VIEW(prev_it),
                                "elm,state,prev,popped",
@@ -1368,6 +1471,7 @@ elm_naviframe_item_promote(Elm_Object_Item *it)
    elm_object_signal_emit(VIEW(prev_it),
                           "elm,state,cur,pushed",
                           "elm");
+   _item_realize(navi_it);
    evas_object_show(VIEW(navi_it));
    evas_object_raise(VIEW(navi_it));
    elm_object_signal_emit(VIEW(navi_it),
@@ -1528,3 +1632,71 @@ elm_naviframe_event_enabled_get(const Evas_Object *obj)
    if (!wd) return EINA_FALSE;
    return !wd->freeze_events;
 }
+
+EAPI void
+elm_naviframe_realized_pages_max_set(Evas_Object *obj, int max)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (max < 0) max = 0;
+   wd->realized_pages_max = max;
+   _items_unrealize(wd);
+}
+
+EAPI int
+elm_naviframe_realized_pages_max_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) 0;
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return 0;
+   return wd->realized_pages_max;
+}
+
+EAPI void
+elm_naviframe_realized_objects_max_set(Evas_Object *obj, int max)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (max < 0) max = 0;
+   wd->realized_objects_max = max;
+   _items_unrealize(wd);
+}
+
+EAPI int
+elm_naviframe_realized_objects_max_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) 0;
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return 0;
+   return wd->realized_objects_max;
+}
+
+EAPI void
+elm_naviframe_item_unrealize_cb_set(Elm_Object_Item *it,
+                                    Elm_Naviframe_Item_Save_Cb save,
+                                    Elm_Naviframe_Item_Restore_Cb restore,
+                                    const void *data)
+{
+   ELM_OBJ_ITEM_CHECK_OR_RETURN(it);
+   Elm_Naviframe_Item *navi_it = (Elm_Naviframe_Item *)it;
+   Widget_Data *wd;
+
+   //an unrealized page must be brought back with the old callbacks
+   if (navi_it->unrealized) _item_realize(navi_it);
+   navi_it->save_cb = save;
+   navi_it->restore_cb = restore;
+   navi_it->unrealize_data = data;
+
+   wd = elm_widget_data_get(WIDGET(navi_it));
+   if (wd) _items_unrealize(wd);
+}
+
+EAPI Eina_Bool
+elm_naviframe_item_realized_get(const Elm_Object_Item *it)
+{
+   ELM_OBJ_ITEM_CHECK_OR_RETURN(it, EINA_FALSE);
+   Elm_Naviframe_Item *navi_it = (Elm_Naviframe_Item *)it;
+   return !navi_it->unrealized;
+}
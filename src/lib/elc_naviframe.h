@@ -64,6 +64,30 @@
  * @{
  */
 
+/**
+ * Called before the content of a naviframe item is unrealized.
+ *
+ * @param data The data given to elm_naviframe_item_unrealize_cb_set()
+ * @param it The item
+ * @param content The content of the item, or @c NULL. It is deleted
+ * right after, unless content preserve on pop is enabled, in which case
+ * it is hidden and the caller owns it from now on.
+ *
+ * @see elm_naviframe_item_unrealize_cb_set()
+ */
+typedef void (*Elm_Naviframe_Item_Save_Cb)(void *data, Elm_Object_Item *it, Evas_Object *content);
+
+/**
+ * Called to recreate the content of an unrealized naviframe item.
+ *
+ * @param data The data given to elm_naviframe_item_unrealize_cb_set()
+ * @param it The item
+ * @return The new content of the item, or @c NULL
+ *
+ * @see elm_naviframe_item_unrealize_cb_set()
+ */
+typedef Evas_Object *(*Elm_Naviframe_Item_Restore_Cb)(void *data, Elm_Object_Item *it);
+
 /**
  * @brief Add a new Naviframe object to the parent.
  *
@@ -401,6 +425,92 @@ elm_naviframe_item_simple_push(Evas_Object *obj, Evas_Object *content)
  */
 EAPI void             elm_naviframe_item_simple_promote(Evas_Object *obj, Evas_Object *content);
 
+/**
+ * @brief Set how many pages are kept realized from the top of the stack
+ *
+ * @param obj The naviframe object
+ * @param max The number of pages, counting the top one, whose contents
+ * stay alive. 0 (the default) means no limit.
+ *
+ * Pages further down the stack are unrealized: their content is saved and
+ * deleted through the callbacks given with
+ * elm_naviframe_item_unrealize_cb_set(), and their automatic back button
+ * is deleted. They are recreated when they are shown again, by a pop or
+ * a promote. Pages without a restore callback are never unrealized.
+ *
+ * @see elm_naviframe_realized_objects_max_set()
+ *
+ * @ingroup Naviframe
+ */
+EAPI void             elm_naviframe_realized_pages_max_set(Evas_Object *obj, int max);
+
+/**
+ * @brief Get how many pages are kept realized from the top of the stack
+ *
+ * @param obj The naviframe object
+ * @return The number of pages, or 0 if there is no limit
+ *
+ * @see elm_naviframe_realized_pages_max_set()
+ *
+ * @ingroup Naviframe
+ */
+EAPI int              elm_naviframe_realized_pages_max_get(const Evas_Object *obj);
+
+/**
+ * @brief Set the object budget of the hidden pages
+ *
+ * @param obj The naviframe object
+ * @param max The number of Evas objects the contents of the hidden pages
+ * may hold. 0 (the default) means no limit.
+ *
+ * Walking down from the top, once the contents of the hidden pages hold
+ * more than @p max objects, the remaining pages are unrealized like with
+ * elm_naviframe_realized_pages_max_set().
+ *
+ * @ingroup Naviframe
+ */
+EAPI void             elm_naviframe_realized_objects_max_set(Evas_Object *obj, int max);
+
+/**
+ * @brief Get the object budget of the hidden pages
+ *
+ * @param obj The naviframe object
+ * @return The number of objects, or 0 if there is no limit
+ *
+ * @see elm_naviframe_realized_objects_max_set()
+ *
+ * @ingroup Naviframe
+ */
+EAPI int              elm_naviframe_realized_objects_max_get(const Evas_Object *obj);
+
+/**
+ * @brief Set the callbacks to unrealize and recreate the item content
+ *
+ * @param it The naviframe item
+ * @param save Called before the content is deleted, may be @c NULL. The
+ * content is deleted without it, even with content preserve on pop.
+ * @param restore Called to create the content again. If @c NULL, the
+ * item is never unrealized.
+ * @param data The data passed to the callbacks
+ *
+ * While the item is unrealized, its content is @c NULL.
+ *
+ * @see elm_naviframe_realized_pages_max_set()
+ *
+ * @ingroup Naviframe
+ */
+EAPI void             elm_naviframe_item_unrealize_cb_set(Elm_Object_Item *it, Elm_Naviframe_Item_Save_Cb save, Elm_Naviframe_Item_Restore_Cb restore, const void *data);
+
+/**
+ * @brief Get whether the item content is realized
+ *
+ * @param it The naviframe item
+ * @return @c EINA_FALSE if the item was unrealized, @c EINA_TRUE otherwise
+ *
+ * @ingroup Naviframe
+ */
+EAPI Eina_Bool        elm_naviframe_item_realized_get(const Elm_Object_Item *it);
+
 /**
  * @}
  */
@@ -16,12 +16,47 @@ typedef enum _Day_Color // EINA_DEPRECATED
    DAY_SUNDAY = 2
 } Day_Color;
 
+/* Bucket 0..3 hold unique, daily, weekly and monthly marks, the
+ * remaining twelve hold annual marks by month. */
+#define MARK_BUCKETS (ELM_CALENDAR_ANNUALLY + 12)
+#define MONTHS_CACHE_MAX 4
+
 typedef struct _Widget_Data Widget_Data;
+typedef struct _Mark_Bucket Mark_Bucket;
+typedef struct _Mark_Cell Mark_Cell;
+typedef struct _Month_Marks Month_Marks;
+
+/* Marks sorted by first month they may show up in, so a month only
+ * looks at the marks that can hit it. */
+struct _Mark_Bucket
+{
+   Elm_Calendar_Mark **marks;
+   unsigned int count, size;
+   Eina_Bool sorted : 1;
+};
+
+struct _Mark_Cell
+{
+   const char *mark_type;
+   unsigned int seq;
+   int cit;
+};
+
+/* Marks of a displayed month, in the order they were added */
+struct _Month_Marks
+{
+   int key, first_day_it;
+   unsigned int count, size;
+   Mark_Cell *cells;
+};
 
 struct _Widget_Data
 {
    Evas_Object *calendar;
    Eina_List *marks;
+   Mark_Bucket buckets[MARK_BUCKETS];
+   Eina_List *months;
+   unsigned int mark_seq;
    double interval, first_interval;
    int year_min, year_max, spin_speed;
    int today_it, selected_it, first_day_it;
@@ -39,9 +74,12 @@ struct _Elm_Calendar_Mark
 {
    Evas_Object *obj;
    Eina_List *node;
+   Mark_Bucket *bucket;
    struct tm mark_time;
    const char *mark_type;
    Elm_Calendar_Mark_Repeat_Type repeat;
+   unsigned int seq;
+   int key;
 };
 
 static const char *widtype = NULL;
@@ -70,6 +108,124 @@ static int _days_in_month[2][12] =
      {31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31}
 };
 
+static inline int
+_month_key(int year, int mon)
+{
+   return year * 12 + mon;
+}
+
+static int
+_mark_cmp(const void *a, const void *b)
+{
+   const Elm_Calendar_Mark *m1 = *(const Elm_Calendar_Mark **)a;
+   const Elm_Calendar_Mark *m2 = *(const Elm_Calendar_Mark **)b;
+
+   if (m1->key != m2->key) return (m1->key < m2->key) ? -1 : 1;
+   if (m1->seq != m2->seq) return (m1->seq < m2->seq) ? -1 : 1;
+   return 0;
+}
+
+static void
+_bucket_sort(Mark_Bucket *bucket)
+{
+   if (bucket->sorted) return;
+   if (bucket->count > 1)
+     qsort(bucket->marks, bucket->count, sizeof(Elm_Calendar_Mark *),
+           _mark_cmp);
+   bucket->sorted = EINA_TRUE;
+}
+
+/* First position in the bucket whose key is not lower than key */
+static unsigned int
+_bucket_lower_bound(Mark_Bucket *bucket, int key)
+{
+   unsigned int lo = 0, hi = bucket->count;
+
+   while (lo < hi)
+     {
+        unsigned int mid = (lo + hi) / 2;
+        if (bucket->marks[mid]->key < key) lo = mid + 1;
+        else hi = mid;
+     }
+   return lo;
+}
+
+static Eina_Bool
+_bucket_append(Mark_Bucket *bucket, Elm_Calendar_Mark *mark)
+{
+   if (bucket->count == bucket->size)
+     {
+        Elm_Calendar_Mark **marks;
+        unsigned int size = bucket->size ? bucket->size * 2 : 16;
+
+        marks = realloc(bucket->marks, size * sizeof(Elm_Calendar_Mark *));
+        if (!marks) return EINA_FALSE;
+        bucket->marks = marks;
+        bucket->size = size;
+     }
+   if ((bucket->count) &&
+       (_mark_cmp(&bucket->marks[bucket->count - 1], &mark) > 0))
+     bucket->sorted = EINA_FALSE;
+   bucket->marks[bucket->count++] = mark;
+   return EINA_TRUE;
+}
+
+static void
+_bucket_remove(Mark_Bucket *bucket, Elm_Calendar_Mark *mark)
+{
+   unsigned int i;
+
+   _bucket_sort(bucket);
+   for (i = _bucket_lower_bound(bucket, mark->key); i < bucket->count; i++)
+     if (bucket->marks[i] == mark) break;
+   if (i == bucket->count) return;
+   bucket->count--;
+   memmove(bucket->marks + i, bucket->marks + i + 1,
+           (bucket->count - i) * sizeof(Elm_Calendar_Mark *));
+}
+
+static void
+_bucket_clear(Mark_Bucket *bucket)
+{
+   free(bucket->marks);
+   bucket->marks = NULL;
+   bucket->count = 0;
+   bucket->size = 0;
+   bucket->sorted = EINA_TRUE;
+}
+
+static void
+_months_clear(Widget_Data *wd)
+{
+   Month_Marks *mm;
+
+   EINA_LIST_FREE(wd->months, mm)
+     {
+        free(mm->cells);
+        free(mm);
+     }
+}
+
+static void
+_mark_index(Widget_Data *wd, Elm_Calendar_Mark *mark)
+{
+   int mon = mark->mark_time.tm_mon;
+
+   /* Out of range months never match the displayed one, but they
+    * still have to be indexed no later than the rule may hit. */
+   if (mon < 0) mon = 0;
+   else if (mon > 11) mon = 11;
+   mark->key = _month_key(mark->mark_time.tm_year, mon);
+
+   if (mark->repeat == ELM_CALENDAR_ANNUALLY)
+     mark->bucket = &wd->buckets[ELM_CALENDAR_ANNUALLY + mon];
+   else if (mark->repeat < ELM_CALENDAR_ANNUALLY)
+     mark->bucket = &wd->buckets[mark->repeat];
+   else
+     return;
+   if (!_bucket_append(mark->bucket, mark)) mark->bucket = NULL;
+}
+
 static Elm_Calendar_Mark *
 _mark_new(Evas_Object *obj, const char *mark_type, struct tm *mark_time, Elm_Calendar_Mark_Repeat_Type repeat)
 {
@@ -83,6 +239,7 @@ _mark_new(Evas_Object *obj, const char *mark_type, struct tm *mark_time, Elm_Cal
    mark->mark_type = eina_stringshare_add(mark_type);
    mark->mark_time = *mark_time;
    mark->repeat = repeat;
+   mark->seq = wd->mark_seq++;
    return mark;
 }
 
@@ -216,14 +373,168 @@ _set_month_year(Widget_Data *wd)
      edje_object_part_text_escaped_set(wd->calendar, "month_text", "");
 }
 
+static Eina_Bool
+_month_cell_add(Month_Marks *mm, Elm_Calendar_Mark *mark, int cit)
+{
+   Mark_Cell *cell;
+
+   if (mm->count == mm->size)
+     {
+        unsigned int size = mm->size ? mm->size * 2 : 64;
+
+        cell = realloc(mm->cells, size * sizeof(Mark_Cell));
+        if (!cell) return EINA_FALSE;
+        mm->cells = cell;
+        mm->size = size;
+     }
+   cell = mm->cells + mm->count++;
+   cell->mark_type = mark->mark_type;
+   cell->seq = mark->seq;
+   cell->cit = cit;
+   return EINA_TRUE;
+}
+
+/* Evaluates the repeat rule of a candidate mark against the month */
+static Eina_Bool
+_month_mark_eval(Widget_Data *wd, Month_Marks *mm, Elm_Calendar_Mark *mark, int maxdays)
+{
+   struct tm *mtime = &mark->mark_time;
+   int month = wd->showed_time.tm_mon;
+   int year = wd->showed_time.tm_year;
+   int mday_it = mtime->tm_mday + wd->first_day_it - 1;
+   int day;
+
+   switch (mark->repeat)
+     {
+      case ELM_CALENDAR_UNIQUE:
+         if ((mtime->tm_mon == month) && (mtime->tm_year == year))
+           return _month_cell_add(mm, mark, mday_it);
+         break;
+      case ELM_CALENDAR_DAILY:
+         if (((mtime->tm_year == year) && (mtime->tm_mon < month)) ||
+             (mtime->tm_year < year))
+           day = 1;
+         else if ((mtime->tm_year == year) && (mtime->tm_mon == month))
+           day = mtime->tm_mday;
+         else
+           break;
+         for (; day <= maxdays; day++)
+           if (!_month_cell_add(mm, mark, day + wd->first_day_it - 1))
+             return EINA_FALSE;
+         break;
+      case ELM_CALENDAR_WEEKLY:
+         if (((mtime->tm_year == year) && (mtime->tm_mon < month)) ||
+             (mtime->tm_year < year))
+           day = 1;
+         else if ((mtime->tm_year == year) && (mtime->tm_mon == month))
+           day = mtime->tm_mday;
+         else
+           break;
+         for (; day <= maxdays; day++)
+           if (mtime->tm_wday == _weekday_get(wd->first_day_it, day))
+             {
+                if (!_month_cell_add(mm, mark, day + wd->first_day_it - 1))
+                  return EINA_FALSE;
+             }
+         break;
+      case ELM_CALENDAR_MONTHLY:
+         if (((mtime->tm_year < year) ||
+              ((mtime->tm_year == year) && (mtime->tm_mon <= month))) &&
+             (mtime->tm_mday <= maxdays))
+           return _month_cell_add(mm, mark, mday_it);
+         break;
+      case ELM_CALENDAR_ANNUALLY:
+         if ((mtime->tm_year <= year) && (mtime->tm_mon == month) &&
+             (mtime->tm_mday <= maxdays))
+           return _month_cell_add(mm, mark, mday_it);
+         break;
+     }
+   return EINA_TRUE;
+}
+
+static int
+_mark_cell_cmp(const void *a, const void *b)
+{
+   const Mark_Cell *c1 = a;
+   const Mark_Cell *c2 = b;
+
+   if (c1->seq != c2->seq) return (c1->seq < c2->seq) ? -1 : 1;
+   return c1->cit - c2->cit;
+}
+
+/* Marks hitting the displayed month. Unique marks are looked up by
+ * month, recurring ones by the prefix of marks started up to it. The
+ * last few months are kept until the marks change. */
+static Month_Marks *
+_month_marks_get(Widget_Data *wd, int maxdays)
+{
+   int key = _month_key(wd->showed_time.tm_year, wd->showed_time.tm_mon);
+   Mark_Bucket *bucket;
+   Month_Marks *mm;
+   Eina_List *l;
+   unsigned int i;
+   int b;
+
+   EINA_LIST_FOREACH(wd->months, l, mm)
+     {
+        if ((mm->key != key) || (mm->first_day_it != wd->first_day_it))
+          continue;
+        wd->months = eina_list_promote_list(wd->months, l);
+        return mm;
+     }
+
+   mm = calloc(1, sizeof(Month_Marks));
+   if (!mm) return NULL;
+   mm->key = key;
+   mm->first_day_it = wd->first_day_it;
+
+   bucket = &wd->buckets[ELM_CALENDAR_UNIQUE];
+   _bucket_sort(bucket);
+   for (i = _bucket_lower_bound(bucket, key);
+        (i < bucket->count) && (bucket->marks[i]->key == key); i++)
+     if (!_month_mark_eval(wd, mm, bucket->marks[i], maxdays)) goto error;
+
+   for (b = ELM_CALENDAR_DAILY; b <= ELM_CALENDAR_ANNUALLY; b++)
+     {
+        if (b == ELM_CALENDAR_ANNUALLY)
+          bucket = &wd->buckets[b + wd->showed_time.tm_mon];
+        else
+          bucket = &wd->buckets[b];
+        _bucket_sort(bucket);
+        for (i = 0; (i < bucket->count) && (bucket->marks[i]->key <= key); i++)
+          if (!_month_mark_eval(wd, mm, bucket->marks[i], maxdays))
+            goto error;
+     }
+
+   if (mm->count > 1)
+     qsort(mm->cells, mm->count, sizeof(Mark_Cell), _mark_cell_cmp);
+
+   wd->months = eina_list_prepend(wd->months, mm);
+   if (eina_list_count(wd->months) > MONTHS_CACHE_MAX)
+     {
+        Eina_List *last = eina_list_last(wd->months);
+        Month_Marks *old = eina_list_data_get(last);
+
+        wd->months = eina_list_remove_list(wd->months, last);
+        free(old->cells);
+        free(old);
+     }
+   return mm;
+
+error:
+   free(mm->cells);
+   free(mm);
+   return NULL;
+}
+
 static void
 _populate(Evas_Object *obj)
 {
    int maxdays, day, mon, yr, i;
-   Elm_Calendar_Mark *mark;
+   Month_Marks *mm;
+   unsigned int c;
    char part[12], day_s[3];
    struct tm first_day;
-   Eina_List *l;
    Eina_Bool last_row = EINA_TRUE;
    Widget_Data *wd = elm_widget_data_get(obj);
 
@@ -330,57 +641,10 @@ _populate(Evas_Object *obj)
      }
 
    /* Set marks */
-   EINA_LIST_FOREACH(wd->marks, l, mark)
-     {
-        struct tm *mtime = &mark->mark_time;
-        int month = wd->showed_time.tm_mon;
-        int year = wd->showed_time.tm_year;
-        int mday_it = mtime->tm_mday + wd->first_day_it - 1;
-
-        switch (mark->repeat)
-          {
-           case ELM_CALENDAR_UNIQUE:
-              if ((mtime->tm_mon == month) && (mtime->tm_year == year))
-                _cit_mark(wd->calendar, mday_it, mark->mark_type);
-              break;
-           case ELM_CALENDAR_DAILY:
-              if (((mtime->tm_year == year) && (mtime->tm_mon < month)) ||
-                  (mtime->tm_year < year))
-                day = 1;
-              else if ((mtime->tm_year == year) && (mtime->tm_mon == month))
-                day = mtime->tm_mday;
-              else
-                break;
-              for (; day <= maxdays; day++)
-                _cit_mark(wd->calendar, day + wd->first_day_it - 1,
-                          mark->mark_type);
-              break;
-           case ELM_CALENDAR_WEEKLY:
-              if (((mtime->tm_year == year) && (mtime->tm_mon < month)) ||
-                  (mtime->tm_year < year))
-                day = 1;
-              else if ((mtime->tm_year == year) && (mtime->tm_mon == month))
-                day = mtime->tm_mday;
-              else
-                break;
-              for (; day <= maxdays; day++)
-                if (mtime->tm_wday == _weekday_get(wd->first_day_it, day))
-                  _cit_mark(wd->calendar, day + wd->first_day_it - 1,
-                            mark->mark_type);
-              break;
-           case ELM_CALENDAR_MONTHLY:
-              if (((mtime->tm_year < year) ||
-                   ((mtime->tm_year == year) && (mtime->tm_mon <= month))) &&
-                  (mtime->tm_mday <= maxdays))
-                _cit_mark(wd->calendar, mday_it, mark->mark_type);
-              break;
-           case ELM_CALENDAR_ANNUALLY:
-              if ((mtime->tm_year <= year) && (mtime->tm_mon == month) &&
-                  (mtime->tm_mday <= maxdays))
-                _cit_mark(wd->calendar, mday_it, mark->mark_type);
-              break;
-          }
-     }
+   mm = _month_marks_get(wd, maxdays);
+   if (!mm) return;
+   for (c = 0; c < mm->count; c++)
+     _cit_mark(wd->calendar, mm->cells[c].cit, mm->cells[c].mark_type);
 }
 
 static void
@@ -419,6 +683,9 @@ _del_hook(Evas_Object *obj)
              _mark_free(mark);
           }
      }
+   for (i = 0; i < MARK_BUCKETS; i++)
+     _bucket_clear(&wd->buckets[i]);
+   _months_clear(wd);
 
    for (i = 0; i < ELM_DAY_LAST; i++)
      eina_stringshare_del(wd->weekdays[i]);
@@ -776,6 +1043,8 @@ elm_calendar_add(Evas_Object *parent)
    wd->first_day_it = -1;
    wd->format_func = _format_month_year;
    wd->marks = NULL;
+   for (i = 0; i < MARK_BUCKETS; i++)
+     wd->buckets[i].sorted = EINA_TRUE;
 
    wd->calendar = edje_object_add(e);
    _elm_theme_object_set(obj, wd->calendar, "calendar", "base", "default");
@@ -973,8 +1242,11 @@ elm_calendar_mark_add(Evas_Object *obj, const char *mark_type, struct tm *mark_t
    if (!wd) return NULL;
 
    mark = _mark_new(obj, mark_type, mark_time, repeat);
+   if (!mark) return NULL;
    wd->marks = eina_list_append(wd->marks, mark);
    mark->node = eina_list_last(wd->marks);
+   _mark_index(wd, mark);
+   _months_clear(wd);
    return mark;
 }
 
@@ -991,6 +1263,8 @@ elm_calendar_mark_del(Elm_Calendar_Mark *mark)
    if (!wd) return;
 
    wd->marks = eina_list_remove_list(wd->marks, mark->node);
+   if (mark->bucket) _bucket_remove(mark->bucket, mark);
+   _months_clear(wd);
    _mark_free(mark);
 }
 
@@ -1000,10 +1274,14 @@ elm_calendar_marks_clear(Evas_Object *obj)
    ELM_CHECK_WIDTYPE(obj, widtype);
    Widget_Data *wd = elm_widget_data_get(obj);
    Elm_Calendar_Mark *mark;
+   int i;
 
    if (!wd) return;
    EINA_LIST_FREE(wd->marks, mark)
       _mark_free(mark);
+   for (i = 0; i < MARK_BUCKETS; i++)
+     _bucket_clear(&wd->buckets[i]);
+   _months_clear(wd);
 }
 
 EAPI const Eina_List *
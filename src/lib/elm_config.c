@@ -21,6 +21,58 @@ const char *_elm_preferred_engine = NULL;
 
 static Ecore_Poller *_elm_cache_flush_poller = NULL;
 
+/* The compiled config image: a base.cfg flattened once per profile into
+ * a checksummed, read-only file which later processes map instead of
+ * decoding the eet file. Pointer members are stored as offsets into the
+ * image, offset 0 standing for NULL. */
+#define CONFIG_IMAGE_MAGIC 0x494d4345 /* "ECMI" */
+#define CONFIG_IMAGE_ALIGN(s) (((s) + 7) & ~7)
+
+typedef struct _Config_Image         Config_Image;
+typedef struct _Config_Image_Overlay Config_Image_Overlay;
+typedef struct _Config_Image_Palette Config_Image_Palette;
+typedef struct _Config_Image_Writer  Config_Image_Writer;
+
+struct _Config_Image
+{
+   unsigned int magic;
+   unsigned int version;
+   unsigned int config_size;
+   unsigned int size;
+   int          checksum; /* of everything following the header */
+   int          prop_checksum; /* of the eet encoding, as set on X root */
+   unsigned int prop_size;
+   unsigned int src; /* path of the base.cfg it was made from */
+   long long    src_mtime;
+   long long    src_size;
+   unsigned int config;
+   unsigned int overlays, overlays_count;
+   unsigned int palettes, palettes_count;
+   unsigned int engine, theme, modules;
+};
+
+struct _Config_Image_Overlay
+{
+   unsigned int   text_class;
+   unsigned int   font;
+   Evas_Font_Size size;
+};
+
+struct _Config_Image_Palette
+{
+   unsigned int name;
+   unsigned int colors, colors_count;
+};
+
+struct _Config_Image_Writer
+{
+   char        *data;
+   unsigned int size, alloc;
+};
+
+static Eina_File *_config_image_file = NULL;
+static const Config_Image *_config_image = NULL;
+
 const char *_elm_engines[] = {
    "software_x11",
    "fb",
@@ -67,6 +119,7 @@ static Elm_Config *_config_system_load(void);
 static void        _config_load(void);
 static void        _config_update(void);
 static void        _env_get(void);
+static Elm_Config *_config_image_config_get(const Config_Image *img);
 static size_t      _elm_data_dir_snprintf(char       *dst,
                                           size_t      size,
                                           const char *fmt, ...)
@@ -145,7 +198,13 @@ _prop_config_get(void)
         free(data);
         return EINA_FALSE;
      }
-   config_data = eet_data_descriptor_decode(_config_edd, data, size);
+   /* the root window usually carries the very config we mapped */
+   if ((_config_image) && (_config_image->prop_size == (unsigned int)size) &&
+       (_config_image->prop_checksum ==
+        eina_hash_superfast((const char *)data, size)))
+     config_data = _config_image_config_get(_config_image);
+   else
+     config_data = eet_data_descriptor_decode(_config_edd, data, size);
    free(data);
    if (!config_data) return EINA_FALSE;
 
@@ -338,6 +397,7 @@ _desc_init(void)
    ELM_CONFIG_VAL(D, T, scroll_smooth_history_weight, T_DOUBLE);
    ELM_CONFIG_VAL(D, T, scroll_smooth_future_time, T_DOUBLE);
    ELM_CONFIG_VAL(D, T, scroll_smooth_time_window, T_DOUBLE);
+   ELM_CONFIG_VAL(D, T, scroll_smooth_enable, T_UCHAR);
    ELM_CONFIG_VAL(D, T, scale, T_DOUBLE);
    ELM_CONFIG_VAL(D, T, bgpixmap, T_INT);
    ELM_CONFIG_VAL(D, T, compositing, T_INT);
@@ -385,6 +445,8 @@ _desc_init(void)
    ELM_CONFIG_VAL(D, T, weekend_len, T_INT);
    ELM_CONFIG_VAL(D, T, year_min, T_INT);
    ELM_CONFIG_VAL(D, T, year_max, T_INT);
+   ELM_CONFIG_VAL(D, T, icon_index_enable, T_UCHAR);
+   ELM_CONFIG_VAL(D, T, gengrid_thumb_cache_size, T_INT);
    ELM_CONFIG_LIST(D, T, color_palette, _config_color_palette_edd);
 #undef T
 #undef D
@@ -880,20 +942,30 @@ _elm_cache_flush_cb(void *data __UNUSED__)
 /* kind of abusing this call right now -- shared between all of those
  * properties -- but they are not meant to be called that periodically
  * anyway */
+void
+_elm_recache_win(Evas_Object *win)
+{
+   Evas *e = evas_object_evas_get(win);
+
+   evas_image_cache_flush(e);
+   evas_font_cache_flush(e);
+   evas_render_dump(e);
+   evas_image_cache_set(e, _elm_config->image_cache * 1024);
+   evas_font_cache_set(e, _elm_config->font_cache * 1024);
+}
+
 void
 _elm_recache(void)
 {
    Eina_List *l;
    Evas_Object *win;
 
-   elm_cache_all_flush();
-
+   edje_file_cache_flush();
+   edje_collection_cache_flush();
+   eet_clearcache();
+   /* the per window flushes and render dumps are staged over frames */
    EINA_LIST_FOREACH(_elm_win_list, l, win)
-     {
-        Evas *e = evas_object_evas_get(win);
-        evas_image_cache_set(e, _elm_config->image_cache * 1024);
-        evas_font_cache_set(e, _elm_config->font_cache * 1024);
-     }
+     _elm_widget_cache_job_add(win);
    edje_file_cache_set(_elm_config->edje_cache);
    edje_collection_cache_set(_elm_config->edje_collection_cache);
 
@@ -952,14 +1024,351 @@ _config_system_load(void)
    return cfg;
 }
 
+static Eina_Bool
+_config_image_enabled(void)
+{
+   const char *s = getenv("ELM_CONFIG_IMAGE");
+
+   return (!s) || (atoi(s));
+}
+
+static size_t
+_config_image_path_get(char *buf, size_t size)
+{
+   return _elm_user_dir_snprintf(buf, size, "cache/config/%s.img",
+                                 _elm_profile);
+}
+
+/* The base.cfg the eet path would pick: the user's one if any */
+static Eina_Bool
+_config_image_source_get(char *buf, size_t size)
+{
+   _elm_user_dir_snprintf(buf, size, "config/%s/base.cfg", _elm_profile);
+   if (ecore_file_exists(buf)) return EINA_TRUE;
+   _elm_data_dir_snprintf(buf, size, "config/%s/base.cfg", _elm_profile);
+   return ecore_file_exists(buf);
+}
+
+static inline const char *
+_config_image_str_get(const Config_Image *img, unsigned int offset)
+{
+   if (!offset) return NULL;
+   return eina_stringshare_add((const char *)img + offset);
+}
+
+static Eina_Bool
+_config_image_check(const Config_Image *img, size_t size, const char *src)
+{
+   const char *base = (const char *)img;
+   const Config_Image_Palette *pal;
+   unsigned int i;
+
+   if (size < sizeof(Config_Image) + sizeof(Elm_Config)) return EINA_FALSE;
+   if ((img->magic != CONFIG_IMAGE_MAGIC) ||
+       (img->version != ELM_CONFIG_VERSION) ||
+       (img->config_size != sizeof(Elm_Config)) ||
+       (img->size != size) || (base[size - 1]))
+     return EINA_FALSE;
+
+   /* strings are NUL terminated and the image ends with one */
+   if ((img->src >= size) || (img->engine >= size) ||
+       (img->theme >= size) || (img->modules >= size) ||
+       (img->config > size - sizeof(Elm_Config)) ||
+       (img->overlays_count > size / sizeof(Config_Image_Overlay)) ||
+       (img->overlays > size - img->overlays_count *
+        sizeof(Config_Image_Overlay)) ||
+       (img->palettes_count > size / sizeof(Config_Image_Palette)) ||
+       (img->palettes > size - img->palettes_count *
+        sizeof(Config_Image_Palette)))
+     return EINA_FALSE;
+   for (i = 0; i < img->overlays_count; i++)
+     {
+        const Config_Image_Overlay *ov =
+          (const Config_Image_Overlay *)(base + img->overlays) + i;
+
+        if ((ov->text_class >= size) || (ov->font >= size))
+          return EINA_FALSE;
+     }
+   pal = (const Config_Image_Palette *)(base + img->palettes);
+   for (i = 0; i < img->palettes_count; i++, pal++)
+     {
+        if ((pal->name >= size) ||
+            (pal->colors_count > size / sizeof(Elm_Color_RGBA)) ||
+            (pal->colors > size - pal->colors_count * sizeof(Elm_Color_RGBA)))
+          return EINA_FALSE;
+     }
+
+   /* stale against the file it was made from? */
+   if ((!img->src) || (strcmp(base + img->src, src)) ||
+       (img->src_mtime != ecore_file_mod_time(src)) ||
+       (img->src_size != ecore_file_size(src)))
+     return EINA_FALSE;
+
+   return img->checksum == eina_hash_superfast(base + sizeof(Config_Image),
+                                               size - sizeof(Config_Image));
+}
+
+static void
+_config_image_close(void)
+{
+   if (!_config_image_file) return;
+   if (_config_image)
+     eina_file_map_free(_config_image_file, (void *)_config_image);
+   eina_file_close(_config_image_file);
+   _config_image_file = NULL;
+   _config_image = NULL;
+}
+
+/* Only the scalars are taken as they are, the few strings and lists are
+ * rebuilt so the config can be changed and freed like a decoded one. */
+static Elm_Config *
+_config_image_config_get(const Config_Image *img)
+{
+   const char *base = (const char *)img;
+   const Config_Image_Overlay *ov;
+   const Config_Image_Palette *pal;
+   Elm_Config *cfg;
+   unsigned int i, j;
+
+   cfg = malloc(sizeof(Elm_Config));
+   if (!cfg) return NULL;
+   memcpy(cfg, base + img->config, sizeof(Elm_Config));
+   cfg->engine = _config_image_str_get(img, img->engine);
+   cfg->theme = _config_image_str_get(img, img->theme);
+   cfg->modules = _config_image_str_get(img, img->modules);
+
+   ov = (const Config_Image_Overlay *)(base + img->overlays);
+   for (i = 0; i < img->overlays_count; i++, ov++)
+     {
+        Elm_Font_Overlay *fo = calloc(1, sizeof(Elm_Font_Overlay));
+
+        if (!fo) break;
+        fo->text_class = _config_image_str_get(img, ov->text_class);
+        fo->font = _config_image_str_get(img, ov->font);
+        fo->size = ov->size;
+        cfg->font_overlays = eina_list_append(cfg->font_overlays, fo);
+     }
+
+   pal = (const Config_Image_Palette *)(base + img->palettes);
+   for (i = 0; i < img->palettes_count; i++, pal++)
+     {
+        const Elm_Color_RGBA *colors =
+          (const Elm_Color_RGBA *)(base + pal->colors);
+        Elm_Custom_Palette *palette = calloc(1, sizeof(Elm_Custom_Palette));
+
+        if (!palette) break;
+        palette->palette_name = _config_image_str_get(img, pal->name);
+        for (j = 0; j < pal->colors_count; j++)
+          {
+             Elm_Color_RGBA *color = malloc(sizeof(Elm_Color_RGBA));
+
+             if (!color) break;
+             *color = colors[j];
+             palette->color_list = eina_list_append(palette->color_list,
+                                                    color);
+          }
+        cfg->color_palette = eina_list_append(cfg->color_palette, palette);
+     }
+   return cfg;
+}
+
+static Elm_Config *
+_config_image_load(void)
+{
+   char buf[PATH_MAX], src[PATH_MAX];
+   const Config_Image *img;
+   Eina_File *f;
+   size_t size;
+
+   if (!_config_image_enabled()) return NULL;
+   if (!_config_image_source_get(src, sizeof(src))) return NULL;
+   _config_image_path_get(buf, sizeof(buf));
+
+   f = eina_file_open(buf, EINA_FALSE);
+   if (!f) return NULL;
+   size = eina_file_size_get(f);
+   img = eina_file_map_all(f, EINA_FILE_SEQUENTIAL);
+   if ((!img) || (!_config_image_check(img, size, src)))
+     {
+        if (img) eina_file_map_free(f, (void *)img);
+        eina_file_close(f);
+        return NULL;
+     }
+
+   _config_image_file = f;
+   _config_image = img;
+   return _config_image_config_get(img);
+}
+
+/* Appends len bytes to the image, returning their offset or 0 on
+ * failure, which is never a valid one past the header. */
+static unsigned int
+_config_image_put(Config_Image_Writer *w, const void *data, unsigned int len, unsigned int align)
+{
+   unsigned int offset = align ? CONFIG_IMAGE_ALIGN(w->size) : w->size;
+
+   if (offset + len > w->alloc)
+     {
+        unsigned int alloc = w->alloc ? w->alloc : 4096;
+        char *p;
+
+        while (offset + len > alloc) alloc *= 2;
+        p = realloc(w->data, alloc);
+        if (!p) return 0;
+        w->data = p;
+        w->alloc = alloc;
+     }
+   memset(w->data + w->size, 0, offset - w->size);
+   if (data) memcpy(w->data + offset, data, len);
+   else memset(w->data + offset, 0, len);
+   w->size = offset + len;
+   return offset;
+}
+
+static inline unsigned int
+_config_image_str_put(Config_Image_Writer *w, const char *s)
+{
+   if (!s) return 0;
+   return _config_image_put(w, s, strlen(s) + 1, EINA_FALSE);
+}
+
+#define IMG(w) ((Config_Image *)(w)->data)
+
+/* Flattens the config just loaded from src into the profile's image */
+static void
+_config_image_save(const char *src)
+{
+   Config_Image_Writer w = { NULL, 0, 0 };
+   char buf[PATH_MAX], buf2[PATH_MAX];
+   Elm_Custom_Palette *palette;
+   Elm_Font_Overlay *fo;
+   Elm_Config cfg;
+   unsigned char *prop;
+   unsigned int i, off, overlays, palettes;
+   Eina_List *l;
+   size_t len;
+   FILE *f;
+   int prop_size = 0;
+
+   if (!_config_image_enabled()) return;
+
+   /* runtime only members never make it to the image */
+   memcpy(&cfg, _elm_config, sizeof(Elm_Config));
+   cfg.engine = cfg.theme = cfg.modules = NULL;
+   cfg.font_dirs = cfg.font_overlays = cfg.color_palette = NULL;
+   cfg.is_mirrored = EINA_FALSE;
+   cfg.translate = EINA_FALSE;
+
+   _config_image_put(&w, NULL, sizeof(Config_Image), EINA_TRUE);
+   if (!w.data) goto end;
+   IMG(&w)->magic = CONFIG_IMAGE_MAGIC;
+   IMG(&w)->version = ELM_CONFIG_VERSION;
+   IMG(&w)->config_size = sizeof(Elm_Config);
+   IMG(&w)->src_mtime = ecore_file_mod_time(src);
+   IMG(&w)->src_size = ecore_file_size(src);
+   if (!(off = _config_image_put(&w, &cfg, sizeof(cfg), EINA_TRUE)))
+     goto end;
+   IMG(&w)->config = off;
+
+   IMG(&w)->overlays_count = eina_list_count(_elm_config->font_overlays);
+   overlays = _config_image_put(&w, NULL, IMG(&w)->overlays_count *
+                                sizeof(Config_Image_Overlay), EINA_TRUE);
+   IMG(&w)->palettes_count = eina_list_count(_elm_config->color_palette);
+   palettes = _config_image_put(&w, NULL, IMG(&w)->palettes_count *
+                                sizeof(Config_Image_Palette), EINA_TRUE);
+   if ((!overlays) || (!palettes)) goto end;
+   IMG(&w)->overlays = overlays;
+   IMG(&w)->palettes = palettes;
+
+   i = 0;
+   EINA_LIST_FOREACH(_elm_config->font_overlays, l, fo)
+     {
+        Config_Image_Overlay ov;
+
+        ov.text_class = _config_image_str_put(&w, fo->text_class);
+        ov.font = _config_image_str_put(&w, fo->font);
+        ov.size = fo->size;
+        memcpy(w.data + overlays + i++ * sizeof(ov), &ov, sizeof(ov));
+     }
+
+   i = 0;
+   EINA_LIST_FOREACH(_elm_config->color_palette, l, palette)
+     {
+        Config_Image_Palette pal;
+        Elm_Color_RGBA *color;
+        Eina_List *ll;
+        unsigned int j = 0;
+
+        pal.name = _config_image_str_put(&w, palette->palette_name);
+        pal.colors_count = eina_list_count(palette->color_list);
+        pal.colors = _config_image_put(&w, NULL, pal.colors_count *
+                                       sizeof(Elm_Color_RGBA), EINA_TRUE);
+        if (!pal.colors) goto end;
+        EINA_LIST_FOREACH(palette->color_list, ll, color)
+          memcpy(w.data + pal.colors + j++ * sizeof(Elm_Color_RGBA), color,
+                 sizeof(Elm_Color_RGBA));
+        memcpy(w.data + palettes + i++ * sizeof(pal), &pal, sizeof(pal));
+     }
+
+   off = _config_image_str_put(&w, _elm_config->engine);
+   IMG(&w)->engine = off;
+   off = _config_image_str_put(&w, _elm_config->theme);
+   IMG(&w)->theme = off;
+   off = _config_image_str_put(&w, _elm_config->modules);
+   IMG(&w)->modules = off;
+   off = _config_image_str_put(&w, src);
+   IMG(&w)->src = off;
+   if ((!IMG(&w)->src) || (!_config_image_put(&w, "", 1, EINA_FALSE)))
+     goto end;
+
+   prop = eet_data_descriptor_encode(_config_edd, _elm_config, &prop_size);
+   if (prop)
+     {
+        IMG(&w)->prop_size = prop_size;
+        IMG(&w)->prop_checksum =
+          eina_hash_superfast((const char *)prop, prop_size);
+        free(prop);
+     }
+   IMG(&w)->size = w.size;
+   IMG(&w)->checksum = eina_hash_superfast(w.data + sizeof(Config_Image),
+                                           w.size - sizeof(Config_Image));
+
+   len = _elm_user_dir_snprintf(buf, sizeof(buf), "cache/config");
+   if ((len + 1 >= sizeof(buf)) || (!ecore_file_mkpath(buf))) goto end;
+   _config_image_path_get(buf, sizeof(buf));
+   snprintf(buf2, sizeof(buf2), "%s.tmp", buf);
+
+   f = fopen(buf2, "wb");
+   if (!f) goto end;
+   len = fwrite(w.data, 1, w.size, f);
+   if ((fclose(f)) || (len != w.size) || (!ecore_file_mv(buf2, buf)))
+     {
+        ERR("Error saving Elementary's config image %s", buf);
+        ecore_file_unlink(buf2);
+     }
+
+end:
+   free(w.data);
+}
+
+#undef IMG
+
 static void
 _config_load(void)
 {
+   char src[PATH_MAX];
+
+   _config_image_close();
+   _elm_config = _config_image_load();
+   if (_elm_config) return;
+
    _elm_config = _config_user_load();
    if (_elm_config)
      {
         if (_elm_config->config_version < ELM_CONFIG_VERSION)
           _config_update();
+        if (_config_image_source_get(src, sizeof(src)))
+          _config_image_save(src);
         return;
      }
 
@@ -967,7 +1376,12 @@ _config_load(void)
     * this one, if it's not the right one, someone screwed up at the time
     * of installing it */
    _elm_config = _config_system_load();
-   if (_elm_config) return;
+   if (_elm_config)
+     {
+        if (_config_image_source_get(src, sizeof(src)))
+          _config_image_save(src);
+        return;
+     }
    /* FIXME: config load could have failed because of a non-existent
     * profile. Fallback to default before moving on */
 
@@ -994,6 +1408,7 @@ _config_load(void)
    _elm_config->scroll_smooth_history_weight = 0.3;
    _elm_config->scroll_smooth_future_time = 0.0;
    _elm_config->scroll_smooth_time_window = 0.2;
+   _elm_config->scroll_smooth_enable = EINA_FALSE;
    _elm_config->scale = 1.0;
    _elm_config->bgpixmap = 0;
    _elm_config->compositing = 1;
@@ -1040,6 +1455,8 @@ _config_load(void)
    _elm_config->weekend_len = 2;
    _elm_config->year_min = 2;
    _elm_config->year_max = 137;
+   _elm_config->icon_index_enable = EINA_FALSE;
+   _elm_config->gengrid_thumb_cache_size = 32;
    _elm_config->color_palette = NULL;
 }
 
@@ -1218,6 +1635,9 @@ _elm_config_save(void)
      }
 
    ecore_file_unlink(buf2);
+   /* base.cfg changed, so did its image */
+   _config_image_close();
+   _config_image_save(buf);
    return EINA_TRUE;
 
 err:
@@ -1252,6 +1672,12 @@ _config_update(void)
      COPYVAL(longpress_timeout);
      IFCFGEND;
 
+     IFCFG(0x0004);
+     COPYVAL(scroll_smooth_enable);
+     COPYVAL(icon_index_enable);
+     COPYVAL(gengrid_thumb_cache_size);
+     IFCFGEND;
+
 #undef COPYSTR
 #undef COPYPTR
 #undef COPYVAL
@@ -1403,6 +1829,8 @@ _env_get(void)
    if (s) _elm_config->scroll_smooth_future_time = _elm_atof(s);
    s = getenv("ELM_SCROLL_SMOOTH_TIME_WINDOW");
    if (s) _elm_config->scroll_smooth_time_window = _elm_atof(s);
+   s = getenv("ELM_SCROLL_SMOOTH_ENABLE");
+   if (s) _elm_config->scroll_smooth_enable = !!atoi(s);
    s = getenv("ELM_THEME");
    if (s) eina_stringshare_replace(&_elm_config->theme, s);
 
@@ -1518,6 +1946,12 @@ _env_get(void)
    s = getenv("ELM_ICON_SIZE");
    if (s) _elm_config->icon_size = atoi(s);
 
+   s = getenv("ELM_ICON_INDEX_ENABLE");
+   if (s) _elm_config->icon_index_enable = !!atoi(s);
+
+   s = getenv("ELM_GENGRID_THUMB_CACHE_SIZE");
+   if (s) _elm_config->gengrid_thumb_cache_size = atoi(s);
+
    s = getenv("ELM_LONGPRESS_TIMEOUT");
    if (s) _elm_config->longpress_timeout = _elm_atof(s);
    if (_elm_config->longpress_timeout < 0.0)
@@ -2270,6 +2704,7 @@ _elm_config_shutdown(void)
         free(_elm_profile);
         _elm_profile = NULL;
      }
+   _config_image_close();
    _desc_shutdown();
 }
 
@@ -121,10 +121,24 @@ _diskselector_object_resize(void *data, Evas *e __UNUSED__, Evas_Object *obj, vo
      wd->idler = ecore_idle_enterer_before_add(_move_scroller, data);
 }
 
+/* the view may go back to the item pool, leave it as _item_new() found it */
+static void
+_item_view_reset(Elm_Diskselector_Item *item)
+{
+   Evas_Object *box;
+
+   edje_object_signal_callback_del_full(VIEW(item), "elm,action,click", "",
+                                        _item_click_cb, item);
+   edje_object_signal_emit(VIEW(item), "elm,state,default", "elm");
+   box = evas_object_smart_parent_get(VIEW(item));
+   if (box) evas_object_box_remove(box, VIEW(item));
+}
+
 static void
 _item_del(Elm_Diskselector_Item *item)
 {
    if (!item) return;
+   _item_view_reset(item);
    eina_stringshare_del(item->label);
    if (item->icon)
      evas_object_del(item->icon);
@@ -342,7 +356,6 @@ static Elm_Diskselector_Item *
 _item_new(Evas_Object *obj, Evas_Object *icon, const char *label, Evas_Smart_Cb func, const void *data)
 {
    Elm_Diskselector_Item *it;
-   const char *style = elm_widget_style_get(obj);
 
    it = elm_widget_item_new(obj, Elm_Diskselector_Item);
    if (!it) return NULL;
@@ -357,19 +370,16 @@ _item_new(Evas_Object *obj, Evas_Object *icon, const char *label, Evas_Smart_Cb
    it->icon = icon;
    it->func = func;
    it->base.data = data;
-   VIEW(it) = edje_object_add(evas_object_evas_get(obj));
-   _elm_theme_object_set(obj, VIEW(it), "diskselector", "item", style);
+   elm_widget_item_view_get(it, "diskselector", "item");
    evas_object_size_hint_weight_set(VIEW(it), EVAS_HINT_EXPAND,
                                     EVAS_HINT_EXPAND);
    evas_object_size_hint_align_set(VIEW(it), EVAS_HINT_FILL,
                                    EVAS_HINT_FILL);
    evas_object_show(VIEW(it));
 
+   edje_object_part_text_escaped_set(VIEW(it), "elm.text", it->label);
    if (it->label)
-     {
-        edje_object_part_text_escaped_set(VIEW(it), "elm.text", it->label);
-        edje_object_signal_callback_add(VIEW(it), "elm,action,click", "", _item_click_cb, it);
-     }
+     edje_object_signal_callback_add(VIEW(it), "elm,action,click", "", _item_click_cb, it);
    if (it->icon)
      {
         evas_object_size_hint_min_set(it->icon, 24, 24);
@@ -823,6 +833,7 @@ _round_item_del(Widget_Data *wd, Elm_Diskselector_Item *it)
 {
    if (!it) return;
    elm_box_unpack(wd->main_box, VIEW(it));
+   _item_view_reset(it);
    wd->r_items = eina_list_remove(wd->r_items, it);
    eina_stringshare_del(it->label);
    elm_widget_item_free(it);
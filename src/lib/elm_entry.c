@@ -2760,55 +2760,83 @@ _text_append_idler(void *data)
      }
 }
 
+/* size, in unit, of what a markup fragment (a tag, an escape or a single
+ * character) becomes in utf8, as evas_textblock_text_markup_to_utf8()
+ * would convert it, without allocating anything */
+static int
+_markup_fragment_size_get(const char *frag, int len, Length_Unit unit)
+{
+   const char *rep = NULL;
+
+   if (*frag == '<')
+     {
+        const char *tag = frag + 1;
+        int tlen = len - 2;
+
+        if ((len < 2) || (frag[len - 1] != '>')) return 0;
+        /* like evas, "<br />" is "<br>" */
+        if ((tlen > 0) && (tag[tlen - 1] == '/'))
+          {
+             tlen--;
+             while ((tlen > 0) && (tag[tlen - 1] == ' ')) tlen--;
+          }
+        if ((tlen == 2) && (!strncmp(tag, "br", 2)))
+          rep = "\n";
+        else if ((tlen == 3) && (!strncmp(tag, "tab", 3)))
+          rep = "\t";
+        else if ((tlen == 2) && (!strncmp(tag, "ps", 2)))
+          rep = "\xE2\x80\xA9"; /* paragraph separator */
+        else if ((tlen >= 4) && (!strncmp(tag, "item", 4)))
+          rep = "\xEF\xBF\xBC"; /* object replacement character */
+     }
+   else if (*frag == '&')
+     {
+        if (frag[len - 1] != ';') return 0;
+        rep = evas_textblock_escape_string_range_get(frag, frag + len);
+     }
+   else
+     return (unit == LENGTH_UNIT_BYTE) ? len : 1;
+
+   if (!rep) return 0;
+   if (unit == LENGTH_UNIT_BYTE) return strlen(rep);
+   return evas_string_char_len_get(rep);
+}
+
+/* walks the markup once, keeping the fragments that still fit in can_add
+ * and compacting the text in place. Once the limit is hit, fragments that
+ * take no room (closing tags, ...) are still kept. */
 static void
 _add_chars_till_limit(Evas_Object *obj, char **text, int can_add, Length_Unit unit)
 {
-   int i = 0, current_len = 0;
-   char *new_text;
+   char *r, *w;
+   int i = 0;
 
    if (!*text) return;
    if (unit >= LENGTH_UNIT_LAST) return;
-   new_text = *text;
-   current_len = strlen(*text);
-   while (*new_text)
+   r = w = *text;
+   while (*r)
      {
-        int idx = 0, unit_size = 0;
-        char *markup, *utfstr;
-        if (*new_text == '<')
+        int idx = 0, unit_size;
+
+        if (*r == '<')
           {
-             while (*(new_text + idx) != '>')
+             while (r[idx] != '>')
                {
                   idx++;
-                  if (!*(new_text + idx)) break;
+                  if (!r[idx]) break;
                }
           }
-        else if (*new_text == '&')
+        else if (*r == '&')
           {
-             while (*(new_text + idx) != ';')
+             while (r[idx] != ';')
                {
                   idx++;
-                  if (!*(new_text + idx)) break;
-               }
-          }
-        idx = evas_string_char_next_get(new_text, idx, NULL);
-        markup = malloc(idx + 1);
-        if (markup)
-          {
-             strncpy(markup, new_text, idx);
-             markup[idx] = 0;
-             utfstr = elm_entry_markup_to_utf8(markup);
-             if (utfstr)
-               {
-                  if (unit == LENGTH_UNIT_BYTE)
-                    unit_size = strlen(utfstr);
-                  else if (unit == LENGTH_UNIT_CHAR)
-                    unit_size = evas_string_char_len_get(utfstr);
-                  free(utfstr);
-                  utfstr = NULL;
+                  if (!r[idx]) break;
                }
-             free(markup);
-             markup = NULL;
           }
+        idx = evas_string_char_next_get(r, idx, NULL);
+        if (!idx) break;
+        unit_size = _markup_fragment_size_get(r, idx, unit);
         if (can_add < unit_size)
           {
              if (!i)
@@ -2819,17 +2847,17 @@ _add_chars_till_limit(Evas_Object *obj, char **text, int can_add, Length_Unit un
                   return;
                }
              can_add = 0;
-             strncpy(new_text, new_text + idx, current_len - ((new_text + idx) - *text));
-             current_len -= idx;
-             (*text)[current_len] = 0;
           }
         else
           {
-             new_text += idx;
+             if (w != r) memmove(w, r, idx);
+             w += idx;
              can_add -= unit_size;
           }
+        r += idx;
         i++;
      }
+   *w = 0;
    evas_object_smart_callback_call(obj, "maxlength,reached", NULL);
 }
 
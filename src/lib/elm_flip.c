@@ -3,20 +3,15 @@
 
 typedef struct _Widget_Data Widget_Data;
 typedef struct _Slice Slice;
-typedef struct _Vertex2 Vertex2;
 typedef struct _Vertex3 Vertex3;
 
 struct _Slice
 {
    Evas_Object *obj;
+   Evas_Map *m; // reused on every frame, set once by _slice_3d()
    double u[4], v[4], x[4], y[4], z[4];
 };
 
-struct _Vertex2
-{
-   double x, y;
-};
-
 struct _Vertex3
 {
    double x, y, z;
@@ -42,6 +37,10 @@ struct _Widget_Data
    Eina_Bool dir_enabled[4];
    int slices_w, slices_h;
    Slice **slices, **slices2;
+   Eina_List *slice_pool; // slices of a previous grid, for reuse
+   float *mesh; // vertex grid, as separate x, y and z planes
+   int mesh_size;
+   Evas_Coord last_x, last_y; // drag position of the last update
 
    Eina_Bool state : 1;
    Eina_Bool down : 1;
@@ -49,6 +48,7 @@ struct _Widget_Data
    Eina_Bool started : 1;
    Eina_Bool backflip : 1;
    Eina_Bool pageflip : 1;
+   Eina_Bool coarse : 1; // fewer slices while the page moves fast
 };
 
 static const char *widtype = NULL;
@@ -59,6 +59,7 @@ static void _changed_size_hints(void *data, Evas *e, Evas_Object *obj, void *eve
 static void _sub_del(void *data, Evas_Object *obj, void *event_info);
 
 static void _state_slices_clear(Widget_Data *wd);
+static void _state_end(Widget_Data *wd);
 static void _configure(Evas_Object *obj);
 
 static const char SIG_ANIMATE_BEGIN[] = "animate,begin";
@@ -76,7 +77,7 @@ _del_hook(Evas_Object *obj)
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
    if (wd->animator) ecore_animator_del(wd->animator);
-   _state_slices_clear(wd);
+   _state_end(wd);
    free(wd);
 }
 
@@ -174,8 +175,24 @@ _slice_new(Widget_Data *wd, Evas_Object *obj)
 {
    Slice *sl;
 
+   if (wd->slice_pool)
+     {
+        sl = eina_list_data_get(wd->slice_pool);
+        wd->slice_pool = eina_list_remove_list(wd->slice_pool, wd->slice_pool);
+        evas_object_image_source_set(sl->obj, obj);
+        // keep the stacking order of a freshly added slice
+        evas_object_raise(sl->obj);
+        return sl;
+     }
    sl = calloc(1, sizeof(Slice));
    if (!sl) return NULL;
+   sl->m = evas_map_new(4);
+   if (!sl->m)
+     {
+        free(sl);
+        return NULL;
+     }
+   evas_map_smooth_set(sl->m, EINA_FALSE);
    sl->obj = evas_object_image_add(evas_object_evas_get(obj));
    elm_widget_sub_object_add(wd->obj, sl->obj);
    evas_object_smart_member_add(sl->obj, wd->obj);
@@ -189,6 +206,7 @@ static void
 _slice_free(Slice *sl)
 {
    evas_object_del(sl->obj);
+   evas_map_free(sl->m);
    free(sl);
 }
 
@@ -197,12 +215,9 @@ _slice_apply(Widget_Data *wd, Slice *sl, Evas_Coord x __UNUSED__,
              Evas_Coord y __UNUSED__, Evas_Coord w, Evas_Coord h __UNUSED__,
              Evas_Coord ox, Evas_Coord oy, Evas_Coord ow, Evas_Coord oh)
 {
-   Evas_Map *m;
+   Evas_Map *m = sl->m;
    int i;
 
-   m = evas_map_new(4);
-   if (!m) return;
-   evas_map_smooth_set(m, EINA_FALSE);
    for (i = 0; i < 4; i++)
      {
         evas_map_point_color_set(m, i, 255, 255, 255, 255);
@@ -237,18 +252,15 @@ _slice_apply(Widget_Data *wd, Slice *sl, Evas_Coord x __UNUSED__,
      }
    evas_object_map_enable_set(sl->obj, EINA_TRUE);
    evas_object_image_fill_set(sl->obj, 0, 0, ow, oh);
-   evas_object_map_set(sl->obj, m);
-   evas_map_free(m);
 }
 
 static void
 _slice_3d(Widget_Data *wd __UNUSED__, Slice *sl, Evas_Coord x, Evas_Coord y,
           Evas_Coord w, Evas_Coord h)
 {
-   Evas_Map *m = (Evas_Map *)evas_object_map_get(sl->obj);
+   Evas_Map *m = sl->m;
    int i;
 
-   if (!m) return;
    // vanishing point is center of page, and focal dist is 1024
    evas_map_util_3d_perspective(m, x + (w / 2), y + (h / 2), 0, 1024);
    for (i = 0; i < 4; i++)
@@ -265,10 +277,9 @@ _slice_3d(Widget_Data *wd __UNUSED__, Slice *sl, Evas_Coord x, Evas_Coord y,
 static void
 _slice_light(Widget_Data *wd __UNUSED__, Slice *sl, Evas_Coord x, Evas_Coord y, Evas_Coord w, Evas_Coord h)
 {
-   Evas_Map *m = (Evas_Map *)evas_object_map_get(sl->obj);
+   Evas_Map *m = sl->m;
    int i;
 
-   if (!m) return;
    evas_map_util_3d_lighting(m,
                              // light position
                              // (centered over page 10 * h toward camera)
@@ -287,7 +298,6 @@ _slice_light(Widget_Data *wd __UNUSED__, Slice *sl, Evas_Coord x, Evas_Coord y,
         b = (double)b * 1.2; if (b > 255) b = 255;
         evas_map_point_color_set(m, i, r, g, b, a);
      }
-   evas_object_map_set(sl->obj, m);
 }
 
 static void
@@ -317,7 +327,8 @@ _slice_uv(Widget_Data *wd __UNUSED__, Slice *sl,
 }
 
 static void
-_deform_point(Vertex2 *vi, Vertex3 *vo, double rho, double theta, double A)
+_deform_points(const float *ix, const float *iy, float *ox, float *oy,
+               float *oz, int n, float rho, float theta, float A)
 {
    // ^Y
    // |
@@ -326,28 +337,46 @@ _deform_point(Vertex2 *vi, Vertex3 *vo, double rho, double theta, double A)
    // theta == cone angle (0 -> PI/2)
    // A     == distance of cone apex from origin
    // rho   == angle of cone from vertical axis (...-PI/2 to PI/2...)
-   Vertex3  v1;
-   double d, r, b;
+   //
+   // the points are in separate x and y arrays and everything not
+   // depending on the point is computed once, so that the loop body is
+   // straight float math the compiler can vectorize.
+   const float sin_t = sinf(theta), cos_t = cosf(theta);
+   const float sin_r = sinf(rho), cos_r = cosf(rho);
+   const float inv_sin_t = 1.0f / sin_t;
+   int i;
+
+   for (i = 0; i < n; i++)
+     {
+        float x = ix[i], dy = iy[i] - A;
+        float d, r, b, sb, cb, v1x, v1z;
 
-   d = sqrt((vi->x * vi->x) + pow(vi->y - A, 2));
-   r = d * sin(theta);
-   b = asin(vi->x / d) / sin(theta);
+        d = sqrtf((x * x) + (dy * dy));
+        r = d * sin_t;
+        b = asinf((d > 0.0f) ? (x / d) : 0.0f) * inv_sin_t;
+        sb = sinf(b);
+        cb = 1.0f - cosf(b);
 
-   v1.x = r * sin(b);
-   v1.y = d + A - (r * (1 - cos(b)) * sin(theta));
-   v1.z = r * (1 - cos(b)) * cos(theta);
+        v1x = r * sb;
+        v1z = r * cb * cos_t;
 
-   vo->x = (v1.x * cos(rho)) - (v1.z * sin(rho));
-   vo->y = v1.y;
-   vo->z = (v1.x * sin(rho)) + (v1.z * cos(rho));
+        ox[i] = (v1x * cos_r) - (v1z * sin_r);
+        oy[i] = d + A - (r * cb * sin_t);
+        oz[i] = (v1x * sin_r) + (v1z * cos_r);
+     }
 }
 
-static void
-_interp_point(Vertex3 *vi1, Vertex3 *vi2, Vertex3 *vo, double v)
+static float *
+_state_mesh_get(Widget_Data *wd, int size)
 {
-   vo->x = (v * vi2->x) + ((1.0 - v) * vi1->x);
-   vo->y = (v * vi2->y) + ((1.0 - v) * vi1->y);
-   vo->z = (v * vi2->z) + ((1.0 - v) * vi1->z);
+   float *mesh;
+
+   if (size <= wd->mesh_size) return wd->mesh;
+   mesh = realloc(wd->mesh, sizeof(float) * size);
+   if (!mesh) return NULL;
+   wd->mesh = mesh;
+   wd->mesh_size = size;
+   return mesh;
 }
 
 static void
@@ -355,6 +384,7 @@ _state_slices_clear(Widget_Data *wd)
 {
    int i, j, num;
 
+   //keep the slices around, the next grid takes them back
    if (wd->slices)
      {
         num = 0;
@@ -362,8 +392,18 @@ _state_slices_clear(Widget_Data *wd)
           {
              for (i = 0; i < wd->slices_w; i++)
                {
-                  if (wd->slices[num]) _slice_free(wd->slices[num]);
-                  if (wd->slices2[num]) _slice_free(wd->slices2[num]);
+                  if (wd->slices[num])
+                    {
+                       evas_object_hide(wd->slices[num]->obj);
+                       wd->slice_pool = eina_list_append(wd->slice_pool,
+                                                         wd->slices[num]);
+                    }
+                  if (wd->slices2[num])
+                    {
+                       evas_object_hide(wd->slices2[num]->obj);
+                       wd->slice_pool = eina_list_append(wd->slice_pool,
+                                                         wd->slices2[num]);
+                    }
                   num++;
                }
           }
@@ -383,8 +423,7 @@ _slice_obj_color_sum(Slice *s, int p, int *r, int *g, int *b, int *a)
    int rr = 0, gg = 0, bb = 0, aa = 0;
 
    if (!s) return 0;
-   m = (Evas_Map *)evas_object_map_get(s->obj);
-   if (!m) return 0;
+   m = s->m;
    evas_map_point_color_get(m, p, &rr, &gg, &bb, &aa);
    *r += rr; *g += gg; *b += bb; *a += aa;
    return 1;
@@ -396,10 +435,8 @@ _slice_obj_color_set(Slice *s, int p, int r, int g, int b, int a)
    Evas_Map *m;
 
    if (!s) return;
-   m = (Evas_Map *) evas_object_map_get(s->obj);
-   if (!m) return;
+   m = s->m;
    evas_map_point_color_set(m, p, r, g, b, a);
-   evas_object_map_set(s->obj, m);
 }
 
 static void
@@ -430,9 +467,9 @@ _state_update(Widget_Data *wd)
    int i, j, num, nn, jump, num2;
    Slice *sl;
    double b, minv = 0.0, minva, mgrad;
-   int gx, gy, gszw, gszh, gw, gh, col, row, nw, nh;
+   int gx, gy, gszw, gszh, gw, gh, col, row, nw, nh, speed, lnum;
    double rho, A, theta, perc, percm, n, rhol, Al, thetal;
-   Vertex3 *tvo, *tvol;
+   float *mesh, *ix, *iy, *tx, *ty, *tz, *lx, *ly, *ltx, *lty, *ltz;
    Evas_Object *front, *back;
 
    wd->backflip = EINA_TRUE;
@@ -553,8 +590,18 @@ _state_update(Widget_Data *wd)
    n = 1.0 - n;
    thetal = 7.86 + n;
 
-   nw = 16;
-   nh = 16;
+   // drop the slice density while the page moves fast, the eye can't
+   // follow the curl then. the thresholds differ to avoid flapping.
+   speed = 0;
+   if (wd->slices)
+     speed = abs(wd->x - wd->last_x) + abs(wd->y - wd->last_y);
+   wd->last_x = wd->x;
+   wd->last_y = wd->y;
+   if (speed > (w / 24)) wd->coarse = EINA_TRUE;
+   else if (speed < (w / 64)) wd->coarse = EINA_FALSE;
+
+   nw = wd->coarse ? 8 : 16;
+   nh = nw;
    gszw = w / nw;
    gszh = h / nh;
    if (gszw < 4) gszw = 4;
@@ -579,42 +626,58 @@ _state_update(Widget_Data *wd)
      }
 
    num = (wd->slices_w + 1) * (wd->slices_h + 1);
-
-   tvo = alloca(sizeof(Vertex3) * num);
-   tvol = alloca(sizeof(Vertex3) * (wd->slices_w + 1));
-
+   lnum = wd->slices_w + 1;
+
+   mesh = _state_mesh_get(wd, 5 * (num + lnum));
+   if (!mesh) return 0;
+   ix = mesh;
+   iy = ix + num;
+   tx = iy + num;
+   ty = tx + num;
+   tz = ty + num;
+   lx = tz + num;
+   ly = lx + lnum;
+   ltx = ly + lnum;
+   lty = ltx + lnum;
+   ltz = lty + lnum;
+
+   // the curl line
    for (col = 0, gx = 0; gx <= (w + gszw - 1); gx += gszw, col++)
      {
-        Vertex2 vil;
-
-        vil.x = gx;
-        vil.y = h - ((gx * h) / (w + gszw - 1));
-        _deform_point(&vil, &(tvol[col]), rhol, thetal, Al);
+        lx[col] = gx;
+        ly[col] = h - ((gx * h) / (w + gszw - 1));
      }
+   _deform_points(lx, ly, ltx, lty, ltz, lnum, rhol, thetal, Al);
 
-   n = minva * sin(perc * M_PI);
-   n = n * n;
-
+   // the page grid, column by column
    num = 0;
    for (col = 0, gx = 0; gx <= (w + gszw - 1); gx += gszw, col++)
      {
         for (gy = 0; gy <= (h + gszh - 1); gy += gszh)
           {
-             Vertex2 vi;
-             Vertex3 vo, tvo1;
-
-             if (gx > w) vi.x = w;
-             else vi.x = gx;
-             if (gy > h) vi.y = h;
-             else vi.y = gy;
-             _deform_point(&vi, &vo, rho, theta, A);
-             tvo1 = tvol[col];
-             if (gy > h) tvo1.y = h;
-             else tvo1.y = gy;
-             _interp_point(&vo, &tvo1, &(tvo[num]), n);
+             ix[num] = (gx > w) ? w : gx;
+             iy[num] = (gy > h) ? h : gy;
              num++;
           }
      }
+   _deform_points(ix, iy, tx, ty, tz, num, rho, theta, A);
+
+   // blend the page towards the curl line
+   n = minva * sin(perc * M_PI);
+   n = n * n;
+   num = 0;
+   for (col = 0; col < lnum; col++)
+     {
+        const float fn = n, fn1 = 1.0 - n;
+        const float cx = ltx[col], cz = ltz[col];
+
+        for (row = 0; row <= wd->slices_h; row++, num++)
+          {
+             tx[num] = (fn * cx) + (fn1 * tx[num]);
+             ty[num] = (fn * iy[num]) + (fn1 * ty[num]);
+             tz[num] = (fn * cz) + (fn1 * tz[num]);
+          }
+     }
 
    jump = wd->slices_h + 1;
    for (col = 0, gx = 0; gx < w; gx += gszw, col++)
@@ -635,10 +698,13 @@ _state_update(Widget_Data *wd)
              gh = gszh;
              if ((gy + gh) > h) gh = h - gy;
 
-             vo[0] = tvo[num2 + row];
-             vo[1] = tvo[num2 + row + jump];
-             vo[2] = tvo[num2 + row + jump + 1];
-             vo[3] = tvo[num2 + row + 1];
+#define VTX(v, p) \
+   do { (v).x = tx[p]; (v).y = ty[p]; (v).z = tz[p]; } while (0)
+             VTX(vo[0], num2 + row);
+             VTX(vo[1], num2 + row + jump);
+             VTX(vo[2], num2 + row + jump + 1);
+             VTX(vo[3], num2 + row + 1);
+#undef VTX
 #define SWP(a, b) do {typeof(a) vt; vt = (a); (a) = (b); (b) = vt;} while (0)
              if (b > 0)
                {
@@ -766,7 +832,15 @@ _state_update(Widget_Data *wd)
 static void
 _state_end(Widget_Data *wd)
 {
+   Slice *sl;
+
    _state_slices_clear(wd);
+   EINA_LIST_FREE(wd->slice_pool, sl)
+     _slice_free(sl);
+   free(wd->mesh);
+   wd->mesh = NULL;
+   wd->mesh_size = 0;
+   wd->coarse = EINA_FALSE;
 }
 
 
@@ -156,6 +156,7 @@ struct _Widget_Data
    int                            multi_device;
    int                            item_cache_count;
    int                            item_cache_max; /**< maximum number of cached items */
+   unsigned int                   item_cache_hits, item_cache_misses; /**< realizations served from/missing the item cache */
    int                            movements;
    int                            max_items_per_block; /**< maximum number of items per block */
    double                         longpress_timeout; /**< longpress timeout. this value comes from _elm_config by default. this can be changed by elm_genlist_longpress_timeout_set() */
@@ -176,11 +177,25 @@ struct _Widget_Data
    Evas_Coord                     old_pan_x, old_pan_y;
    long                           items_lost;
    double                         align_x, align_y;
+   Elm_Gen_Item                 **grid_lines; /**< first item of each row (column when horizontal), built by the calc job */
+   unsigned int                   grid_lines_count, grid_lines_size;
+   unsigned int                   grid_first_line, grid_last_line; /**< line range placed by the last pan calculate */
+   Elm_Gen_Item                  *grid_last_group;
+   Evas_Coord                     grid_cx, grid_cy; /**< cell of the next appended item */
+   int                            grid_groups;
 
    Eina_Bool                      horizontal : 1;
    Eina_Bool                      move_effect_enabled : 1;
    Eina_Bool                      reorder_item_changed : 1;
    Eina_Bool                      filled : 1;
+   Eina_Hash                     *thumbs; /**< gengrid thumbnails by id, see elm_gengrid_item_thumb_cb_set() */
+   Eina_Hash                     *thumb_parts; /**< content parts per item style, used to decode ahead */
+   Eina_List                     *thumb_queue; /**< thumbnails waiting for a decode slot */
+   Elm_Gengrid_Item_Thumb_Get_Cb  thumb_get;
+   int                            thumb_inflight;
+   int                            thumb_dir; /**< sign of the last pan change on the scroll axis */
+   Eina_Bool                      grid_index_valid : 1; /**< grid_lines matches the items inlist */
+   Eina_Bool                      grid_range_valid : 1; /**< grid_first_line/grid_last_line hold every realized item */
 
    int                            reorder_fast;
 };
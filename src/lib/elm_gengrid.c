@@ -14,6 +14,9 @@
 
 #define PRELOAD 1
 #define REORDER_EFFECT_TIME 0.5
+#define ITEM_CACHE_MAX 64
+#define THUMB_INFLIGHT_MAX 2
+#define THUMB_AHEAD 2
 
 #define ELM_GEN_SETUP(wd) \
    (wd)->calc_cb = (Ecore_Cb)_calc_job
@@ -24,6 +27,38 @@
    (it)->unsel_cb = (Ecore_Cb)_item_unselect; \
    (it)->unrealize_cb = (Ecore_Cb)_item_unrealize_cb
 
+typedef struct _Item_Cache Item_Cache;
+typedef struct _Thumb      Thumb;
+
+struct _Item_Cache
+{
+   EINA_INLIST;
+
+   Evas_Object *base_view, *spacer;
+
+   const char  *item_style; // it->itc->item_style
+   Eina_Bool    group : 1; // it->group
+};
+
+struct _Thumb
+{
+   EINA_INLIST; /* parked thumbnails, least recently used last */
+
+   Widget_Data  *wd;
+   Elm_Gen_Item *it; /* item showing it, NULL when parked or decoded ahead */
+   Evas_Object  *img;
+   const char   *id;
+   const char   *part; /* swallowing it once decoded */
+   Evas_Coord    pos; /* position on the scroll axis, for priorities */
+   size_t        bytes;
+
+   Eina_Bool     queued : 1;
+   Eina_Bool     loading : 1;
+   Eina_Bool     ready : 1;
+   Eina_Bool     parked : 1;
+   Eina_Bool     shared : 1; /* registered in wd->thumbs */
+};
+
 struct Elm_Gen_Item_Type
 {
    Elm_Gen_Item   *it;
@@ -31,16 +66,21 @@ struct Elm_Gen_Item_Type
    Evas_Coord   gx, gy, ox, oy, tx, ty, rx, ry;
    unsigned int moving_effect_start_time;
    int          prev_group;
+   Eina_List   *thumbs;
 
    Eina_Bool   group_realized : 1;
    Eina_Bool   moving : 1;
 };
 
 static const char *widtype = NULL;
+static Eina_Inlist *_thumb_lru = NULL;
+static size_t       _thumb_bytes = 0;
 static void      _item_highlight(Elm_Gen_Item *it);
 static void      _item_unrealize_cb(Elm_Gen_Item *it);
 static void      _item_unselect(Elm_Gen_Item *it);
 static void      _calc_job(void *data);
+static void      _item_cache_zero(Widget_Data *wd);
+static void      _thumb_flush(Widget_Data *wd);
 static void      _on_focus_hook(void        *data,
                                 Evas_Object *obj);
 static Eina_Bool _item_multi_select_up(Widget_Data *wd);
@@ -533,6 +573,7 @@ _mirrored_set(Evas_Object *obj, Eina_Bool rtl)
    Widget_Data *wd = elm_widget_data_get(obj);
    Elm_Gen_Item *it;
    if (!wd) return;
+   _item_cache_zero(wd);
    elm_smart_scroller_mirrored_set(wd->scr, rtl);
    if (!wd->items) return;
    it = ELM_GEN_ITEM_FROM_INLIST(wd->items);
@@ -550,6 +591,7 @@ _theme_hook(Evas_Object *obj)
 {
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
+   _item_cache_zero(wd);
    _elm_widget_mirrored_reload(obj);
    _mirrored_set(obj, elm_widget_mirrored_get(obj));
    elm_smart_scroller_object_theme_set(obj, wd->scr, "gengrid", "base",
@@ -562,6 +604,8 @@ _del_pre_hook(Evas_Object *obj)
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
    elm_gengrid_clear(obj);
+   _item_cache_zero(wd);
+   _thumb_flush(wd);
    evas_object_del(wd->pan_smart);
    wd->pan_smart = NULL;
 }
@@ -571,6 +615,7 @@ _del_hook(Evas_Object *obj)
 {
    Widget_Data *wd = elm_widget_data_get(obj);
    if (wd->calc_job) ecore_job_del(wd->calc_job);
+   free(wd->grid_lines);
    free(wd);
 }
 
@@ -896,29 +941,409 @@ _elm_gengrid_item_index_update(Elm_Gen_Item *it)
      }
 }
 
+static Evas_Coord
+_item_major_pos_get(const Widget_Data *wd, const Elm_Gen_Item *it)
+{
+   if (wd->horizontal)
+     return ((it->x - it->item->prev_group) * wd->item_width) + (it->item->prev_group * wd->group_item_width);
+   return ((it->y - it->item->prev_group) * wd->item_height) + (it->item->prev_group * wd->group_item_height);
+}
+
+static void _thumb_preloaded(void *data, Evas *e, Evas_Object *obj, void *event_info);
+
+static void
+_thumb_free(Thumb *th)
+{
+   Widget_Data *wd = th->wd;
+
+   if (th->queued)
+     wd->thumb_queue = eina_list_remove(wd->thumb_queue, th);
+   if (th->loading)
+     {
+        evas_object_event_callback_del_full(th->img,
+                                            EVAS_CALLBACK_IMAGE_PRELOADED,
+                                            _thumb_preloaded, th);
+        evas_object_image_preload(th->img, EINA_TRUE);
+        wd->thumb_inflight--;
+     }
+   if (th->parked)
+     _thumb_lru = eina_inlist_remove(_thumb_lru, EINA_INLIST_GET(th));
+   if (th->ready) _thumb_bytes -= th->bytes;
+   if (th->shared) eina_hash_del(wd->thumbs, th->id, th);
+   eina_stringshare_del(th->id);
+   eina_stringshare_del(th->part);
+   evas_object_del(th->img);
+   free(th);
+}
+
+static void
+_thumb_budget_apply(void)
+{
+   size_t budget;
+
+   /* 0 disables the budget, it does not mean an empty cache */
+   if (_elm_config->gengrid_thumb_cache_size <= 0) return;
+   budget = (size_t)_elm_config->gengrid_thumb_cache_size * 1024 * 1024;
+   while ((_thumb_bytes > budget) && (_thumb_lru))
+     _thumb_free(EINA_INLIST_CONTAINER_GET(_thumb_lru->last, Thumb));
+}
+
+static void
+_thumb_park(Thumb *th)
+{
+   th->it = NULL;
+   if (!th->ready) return;
+   th->parked = EINA_TRUE;
+   _thumb_lru = eina_inlist_prepend(_thumb_lru, EINA_INLIST_GET(th));
+}
+
+static Evas_Coord
+_thumb_priority_get(const Thumb *th)
+{
+   Widget_Data *wd = th->wd;
+   Evas_Coord vw, vh, d;
+
+   evas_object_geometry_get(wd->pan_smart, NULL, NULL, &vw, &vh);
+   if (wd->horizontal) d = th->pos - (wd->pan_x + (vw / 2));
+   else d = th->pos - (wd->pan_y + (vh / 2));
+   /* what is behind the scrolling direction is needed later */
+   if (((d < 0) && (wd->thumb_dir > 0)) || ((d > 0) && (wd->thumb_dir < 0)))
+     d *= 2;
+   return abs(d);
+}
+
+static void
+_thumb_queue_run(Widget_Data *wd)
+{
+   while ((wd->thumb_queue) && (wd->thumb_inflight < THUMB_INFLIGHT_MAX))
+     {
+        Thumb *th, *best = NULL;
+        Evas_Coord prio, best_prio = 0;
+        Eina_List *l;
+
+        EINA_LIST_FOREACH(wd->thumb_queue, l, th)
+          {
+             prio = _thumb_priority_get(th);
+             if ((!best) || (prio < best_prio))
+               {
+                  best = th;
+                  best_prio = prio;
+               }
+          }
+        wd->thumb_queue = eina_list_remove(wd->thumb_queue, best);
+        best->queued = EINA_FALSE;
+        best->loading = EINA_TRUE;
+        wd->thumb_inflight++;
+        evas_object_image_preload(best->img, EINA_FALSE);
+     }
+}
+
+/* thumbnails only go in the view decoded, a visible image still loading
+ * would be decoded right away by the next render */
+static void
+_thumb_show(Thumb *th)
+{
+   edje_object_part_swallow(VIEW(th->it), th->part, th->img);
+   evas_object_show(th->img);
+}
+
+static void
+_thumb_preloaded(void        *data,
+                 Evas        *e __UNUSED__,
+                 Evas_Object *obj,
+                 void        *event_info __UNUSED__)
+{
+   Thumb *th = data;
+   Widget_Data *wd = th->wd;
+   int w = 0, h = 0;
+
+   evas_object_event_callback_del_full(obj, EVAS_CALLBACK_IMAGE_PRELOADED,
+                                       _thumb_preloaded, th);
+   th->loading = EINA_FALSE;
+   th->ready = EINA_TRUE;
+   wd->thumb_inflight--;
+   evas_object_image_size_get(obj, &w, &h);
+   th->bytes = (size_t)w * h * 4;
+   _thumb_bytes += th->bytes;
+   if (th->it) _thumb_show(th);
+   else _thumb_park(th);
+   _thumb_budget_apply();
+   _thumb_queue_run(wd);
+}
+
+static void
+_thumb_id_get(const Widget_Data *wd,
+              const char        *file,
+              const char        *key,
+              char              *buf,
+              size_t             size)
+{
+   snprintf(buf, size, "%ix%i:%s:%s", wd->item_width, wd->item_height,
+            file, key ? key : "");
+}
+
+static Thumb *
+_thumb_new(Widget_Data *wd,
+           const char  *id,
+           const char  *file,
+           const char  *key)
+{
+   Thumb *th;
+
+   th = calloc(1, sizeof(Thumb));
+   if (!th) return NULL;
+   th->wd = wd;
+   th->id = eina_stringshare_add(id);
+   th->img = evas_object_image_filled_add(evas_object_evas_get(wd->obj));
+   evas_object_image_load_size_set(th->img, wd->item_width, wd->item_height);
+   evas_object_image_file_set(th->img, file, key);
+   evas_object_event_callback_add(th->img, EVAS_CALLBACK_IMAGE_PRELOADED,
+                                  _thumb_preloaded, th);
+   if (!wd->thumbs) wd->thumbs = eina_hash_string_superfast_new(NULL);
+   if (!eina_hash_find(wd->thumbs, th->id))
+     {
+        eina_hash_add(wd->thumbs, th->id, th);
+        th->shared = EINA_TRUE;
+     }
+   th->queued = EINA_TRUE;
+   wd->thumb_queue = eina_list_append(wd->thumb_queue, th);
+   return th;
+}
+
+static Evas_Object *
+_thumb_content_get(Elm_Gen_Item *it, const char *part)
+{
+   Widget_Data *wd = it->wd;
+   const char *file = NULL, *key = NULL;
+   char id[PATH_MAX + 64];
+   Thumb *th = NULL;
+
+   if (it->group) return NULL;
+   if (!wd->thumb_get((void *)it->base.data, WIDGET(it), part, &file, &key))
+     return NULL;
+   if (!file) return NULL;
+
+   _thumb_id_get(wd, file, key, id, sizeof(id));
+   if (wd->thumbs) th = eina_hash_find(wd->thumbs, id);
+   if ((th) && (th->it)) th = NULL; /* shown by another item */
+   if (th)
+     {
+        if (th->parked)
+          {
+             _thumb_lru = eina_inlist_remove(_thumb_lru, EINA_INLIST_GET(th));
+             th->parked = EINA_FALSE;
+          }
+     }
+   else
+     th = _thumb_new(wd, id, file, key);
+   if (!th) return NULL;
+   th->it = it;
+   th->pos = _item_major_pos_get(wd, it);
+   eina_stringshare_replace(&th->part, part);
+   it->item->thumbs = eina_list_append(it->item->thumbs, th);
+   if (th->ready) _thumb_show(th);
+   return th->img;
+}
+
+static void
+_thumb_detach(Elm_Gen_Item *it)
+{
+   Thumb *th;
+
+   if (!it->item->thumbs) return;
+   EINA_LIST_FREE(it->item->thumbs, th)
+     {
+        edje_object_part_unswallow(VIEW(it), th->img);
+        evas_object_hide(th->img);
+        /* keep decoded images around, drop unfinished ones */
+        if ((th->shared) && (th->ready)) _thumb_park(th);
+        else _thumb_free(th);
+     }
+   _thumb_budget_apply();
+}
+
+static void
+_thumb_flush(Widget_Data *wd)
+{
+   Eina_Iterator *itr;
+   Eina_List *thumbs = NULL;
+   Thumb *th;
+
+   if (wd->thumbs)
+     {
+        itr = eina_hash_iterator_data_new(wd->thumbs);
+        EINA_ITERATOR_FOREACH(itr, th)
+          thumbs = eina_list_append(thumbs, th);
+        eina_iterator_free(itr);
+        EINA_LIST_FREE(thumbs, th)
+          _thumb_free(th);
+        eina_hash_free(wd->thumbs);
+        wd->thumbs = NULL;
+     }
+   EINA_LIST_FREE(wd->thumb_queue, th)
+     {
+        th->queued = EINA_FALSE;
+        _thumb_free(th);
+     }
+   if (wd->thumb_parts)
+     {
+        eina_hash_free(wd->thumb_parts);
+        wd->thumb_parts = NULL;
+     }
+}
+
+static void
+_item_cache_free(Item_Cache *itc)
+{
+   if (itc->spacer) evas_object_del(itc->spacer);
+   if (itc->base_view) evas_object_del(itc->base_view);
+   eina_stringshare_del(itc->item_style);
+   free(itc);
+}
+
+static void
+_item_cache_clean(Widget_Data *wd)
+{
+   evas_event_freeze(evas_object_evas_get(wd->obj));
+   while ((wd->item_cache) && (wd->item_cache_count > wd->item_cache_max))
+     {
+        Item_Cache *itc;
+
+        itc = EINA_INLIST_CONTAINER_GET(wd->item_cache->last, Item_Cache);
+        wd->item_cache = eina_inlist_remove(wd->item_cache,
+                                            wd->item_cache->last);
+        wd->item_cache_count--;
+        _item_cache_free(itc);
+     }
+   evas_event_thaw(evas_object_evas_get(wd->obj));
+   evas_event_thaw_eval(evas_object_evas_get(wd->obj));
+}
+
+static void
+_item_cache_zero(Widget_Data *wd)
+{
+   int pmax = wd->item_cache_max;
+   wd->item_cache_max = 0;
+   _item_cache_clean(wd);
+   wd->item_cache_max = pmax;
+}
+
+static void
+_item_cache_add(Elm_Gen_Item *it)
+{
+   Item_Cache *itc = NULL;
+
+   evas_event_freeze(evas_object_evas_get(it->wd->obj));
+   if (it->wd->item_cache_max > 0)
+     itc = calloc(1, sizeof(Item_Cache));
+   if (!itc)
+     {
+        evas_object_del(VIEW(it));
+        VIEW(it) = NULL;
+        evas_object_del(it->spacer);
+        it->spacer = NULL;
+        evas_event_thaw(evas_object_evas_get(it->wd->obj));
+        evas_event_thaw_eval(evas_object_evas_get(it->wd->obj));
+        return;
+     }
+
+   /* the view outlives the item now, drop what points back to it */
+   if (it->tooltip.content_cb) elm_widget_item_tooltip_unset(it);
+   if (it->mouse_cursor) elm_widget_item_cursor_unset(it);
+   if (!it->group)
+     {
+        evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_DOWN,
+                                            _mouse_down, it);
+        evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_UP,
+                                            _mouse_up, it);
+        evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_MOVE,
+                                            _mouse_move, it);
+     }
+   if ((it->selected) || (it->highlighted))
+     edje_object_signal_emit(VIEW(it), "elm,state,unselected", "elm");
+   if (elm_widget_item_disabled_get(it))
+     edje_object_signal_emit(VIEW(it), "elm,state,enabled", "elm");
+
+   itc->base_view = VIEW(it);
+   VIEW(it) = NULL;
+   itc->spacer = it->spacer;
+   it->spacer = NULL;
+   itc->item_style = eina_stringshare_add(it->itc->item_style);
+   itc->group = it->group;
+   evas_object_hide(itc->base_view);
+   evas_object_move(itc->base_view, -9999, -9999);
+
+   it->wd->item_cache = eina_inlist_prepend(it->wd->item_cache,
+                                            EINA_INLIST_GET(itc));
+   it->wd->item_cache_count++;
+   _item_cache_clean(it->wd);
+   evas_event_thaw(evas_object_evas_get(it->wd->obj));
+   evas_event_thaw_eval(evas_object_evas_get(it->wd->obj));
+}
+
+static Item_Cache *
+_item_cache_find(Elm_Gen_Item *it)
+{
+   Item_Cache *itc;
+
+   EINA_INLIST_FOREACH(it->wd->item_cache, itc)
+     {
+        if ((itc->group == it->group) &&
+            (((!it->itc->item_style) && (!itc->item_style)) ||
+             (it->itc->item_style && itc->item_style &&
+              (!strcmp(it->itc->item_style, itc->item_style)))))
+          {
+             it->wd->item_cache = eina_inlist_remove(it->wd->item_cache,
+                                                     EINA_INLIST_GET(itc));
+             it->wd->item_cache_count--;
+             return itc;
+          }
+     }
+   return NULL;
+}
+
 static void
 _item_realize(Elm_Gen_Item *it)
 {
    char buf[1024];
    char style[1024];
+   Item_Cache *itc;
 
    if ((it->realized) || (it->generation < it->wd->generation)) return;
-   VIEW(it) = edje_object_add(evas_object_evas_get(WIDGET(it)));
-   edje_object_scale_set(VIEW(it), elm_widget_scale_get(WIDGET(it)) *
-                         _elm_config->scale);
-   edje_object_mirrored_set(VIEW(it), elm_widget_mirrored_get(WIDGET(it)));
-   evas_object_smart_member_add(VIEW(it), it->wd->pan_smart);
-   elm_widget_sub_object_add(WIDGET(it), VIEW(it));
-   snprintf(style, sizeof(style), "item/%s",
-            it->itc->item_style ? it->itc->item_style : "default");
-   _elm_theme_object_set(WIDGET(it), VIEW(it), "gengrid", style,
-                         elm_widget_style_get(WIDGET(it)));
-   it->spacer =
-      evas_object_rectangle_add(evas_object_evas_get(WIDGET(it)));
-   evas_object_color_set(it->spacer, 0, 0, 0, 0);
-   elm_widget_sub_object_add(WIDGET(it), it->spacer);
-   evas_object_size_hint_min_set(it->spacer, 2 * _elm_config->scale, 1);
-   edje_object_part_swallow(VIEW(it), "elm.swallow.pad", it->spacer);
+   ELM_PERF_SPAN_BEGIN(t0);
+   itc = _item_cache_find(it);
+   if (itc)
+     {
+        it->wd->item_cache_hits++;
+        VIEW(it) = itc->base_view;
+        itc->base_view = NULL;
+        it->spacer = itc->spacer;
+        itc->spacer = NULL;
+        _item_cache_free(itc);
+        edje_object_scale_set(VIEW(it), elm_widget_scale_get(WIDGET(it)) *
+                              _elm_config->scale);
+        edje_object_mirrored_set(VIEW(it), elm_widget_mirrored_get(WIDGET(it)));
+     }
+   else
+     {
+        it->wd->item_cache_misses++;
+        VIEW(it) = edje_object_add(evas_object_evas_get(WIDGET(it)));
+        edje_object_scale_set(VIEW(it), elm_widget_scale_get(WIDGET(it)) *
+                              _elm_config->scale);
+        edje_object_mirrored_set(VIEW(it), elm_widget_mirrored_get(WIDGET(it)));
+        evas_object_smart_member_add(VIEW(it), it->wd->pan_smart);
+        elm_widget_sub_object_add(WIDGET(it), VIEW(it));
+        snprintf(style, sizeof(style), "item/%s",
+                 it->itc->item_style ? it->itc->item_style : "default");
+        _elm_theme_object_set(WIDGET(it), VIEW(it), "gengrid", style,
+                              elm_widget_style_get(WIDGET(it)));
+        it->spacer =
+           evas_object_rectangle_add(evas_object_evas_get(WIDGET(it)));
+        evas_object_color_set(it->spacer, 0, 0, 0, 0);
+        elm_widget_sub_object_add(WIDGET(it), it->spacer);
+        evas_object_size_hint_min_set(it->spacer, 2 * _elm_config->scale, 1);
+        edje_object_part_swallow(VIEW(it), "elm.swallow.pad", it->spacer);
+     }
 
    if (it->itc->func.text_get)
      {
@@ -940,7 +1365,7 @@ _item_realize(Elm_Gen_Item *it)
           }
      }
 
-   if (it->itc->func.content_get)
+   if ((it->itc->func.content_get) || (it->wd->thumb_get))
      {
         const Eina_List *l;
         const char *key;
@@ -949,11 +1374,34 @@ _item_realize(Elm_Gen_Item *it)
         it->contents =
            elm_widget_stringlist_get(edje_object_data_get(VIEW(it),
                                                           "contents"));
+        if ((it->wd->thumb_get) && (!it->group))
+          {
+             const char *style = it->itc->item_style ? it->itc->item_style : "default";
+
+             if (!it->wd->thumb_parts)
+               it->wd->thumb_parts = eina_hash_string_superfast_new
+                  ((Eina_Free_Cb)elm_widget_stringlist_free);
+             if (!eina_hash_find(it->wd->thumb_parts, style))
+               eina_hash_add(it->wd->thumb_parts, style,
+                             elm_widget_stringlist_get
+                             (edje_object_data_get(VIEW(it), "contents")));
+          }
         EINA_LIST_FOREACH(it->contents, l, key)
           {
+             ic = NULL;
+             if (it->wd->thumb_get)
+               {
+                  /* swallowed by the thumbnail once it is decoded */
+                  if (_thumb_content_get(it, key)) continue;
+               }
              if (it->itc->func.content_get)
-               ic = it->itc->func.content_get
-                  ((void *)it->base.data, WIDGET(it), key);
+               {
+                  ELM_PERF_SPAN_BEGIN(t1);
+                  ic = it->itc->func.content_get
+                     ((void *)it->base.data, WIDGET(it), key);
+                  ELM_PERF_SPAN_END(t1, elm_widget_type_get(WIDGET(it)),
+                                    ELM_PERF_SITE_CONTENT_GET);
+               }
              if (ic)
                {
                   it->content_objs = eina_list_append(it->content_objs, ic);
@@ -981,6 +1429,11 @@ _item_realize(Elm_Gen_Item *it)
                   snprintf(buf, sizeof(buf), "elm,state,%s,active", key);
                   edje_object_signal_emit(VIEW(it), buf, "elm");
                }
+             else if (itc)
+               {
+                  snprintf(buf, sizeof(buf), "elm,state,%s,passive", key);
+                  edje_object_signal_emit(VIEW(it), buf, "elm");
+               }
           }
      }
 
@@ -1038,15 +1491,15 @@ _item_realize(Elm_Gen_Item *it)
 
    it->realized = EINA_TRUE;
    it->want_unrealize = EINA_FALSE;
+   ELM_PERF_SPAN_END(t0, elm_widget_type_get(WIDGET(it)),
+                     ELM_PERF_SITE_ITEM_REALIZE);
 }
 
 static void
 _item_unrealize_cb(Elm_Gen_Item *it)
 {
-   evas_object_del(VIEW(it));
-   VIEW(it) = NULL;
-   evas_object_del(it->spacer);
-   it->spacer = NULL;
+   _thumb_detach(it);
+   _item_cache_add(it);
 }
 
 static Eina_Bool
@@ -1147,34 +1600,22 @@ _group_item_place(Pan *sd)
 
 
 static void
-_item_place(Elm_Gen_Item *it,
-            Evas_Coord    cx,
-            Evas_Coord    cy)
+_align_get(Widget_Data *wd,
+           Evas_Coord   vw,
+           Evas_Coord   vh,
+           Evas_Coord  *alignw,
+           Evas_Coord  *alignh)
 {
-   Evas_Coord x, y, ox, oy, cvx, cvy, cvw, cvh, iw, ih, ww;
-   Evas_Coord tch, tcw, alignw = 0, alignh = 0, vw, vh;
-   Eina_Bool reorder_item_move_forward = EINA_FALSE;
+   Evas_Coord tch, tcw;
    long items_count;
-   it->x = cx;
-   it->y = cy;
-   evas_object_geometry_get(it->wd->pan_smart, &ox, &oy, &vw, &vh);
-
-   /* Preload rows/columns at each side of the Gengrid */
-   cvx = ox - PRELOAD * it->wd->item_width;
-   cvy = oy - PRELOAD * it->wd->item_height;
-   cvw = vw + 2 * PRELOAD * it->wd->item_width;
-   cvh = vh + 2 * PRELOAD * it->wd->item_height;
-
-   alignh = 0;
-   alignw = 0;
 
-   items_count = it->wd->item_count - eina_list_count(it->wd->group_items) + it->wd->items_lost;
-   if (it->wd->horizontal)
+   items_count = wd->item_count - eina_list_count(wd->group_items) + wd->items_lost;
+   if (wd->horizontal)
      {
         int columns, items_visible = 0, items_row;
 
-        if (it->wd->item_height > 0)
-          items_visible = vh / it->wd->item_height;
+        if (wd->item_height > 0)
+          items_visible = vh / wd->item_height;
         if (items_visible < 1)
           items_visible = 1;
 
@@ -1182,25 +1623,25 @@ _item_place(Elm_Gen_Item *it,
         if (items_count % items_visible)
           columns++;
 
-        tcw = (it->wd->item_width * columns) + (it->wd->group_item_width * eina_list_count(it->wd->group_items));
-        alignw = (vw - tcw) * it->wd->align_x;
+        tcw = (wd->item_width * columns) + (wd->group_item_width * eina_list_count(wd->group_items));
+        *alignw = (vw - tcw) * wd->align_x;
 
         items_row = items_visible;
-        if ((unsigned int)items_row > it->wd->item_count)
-          items_row = it->wd->item_count;
-         if (it->wd->filled
-             && (unsigned int)it->wd->nmax > (unsigned int)it->wd->item_count)
-           tch = it->wd->nmax * it->wd->item_height;
+        if ((unsigned int)items_row > wd->item_count)
+          items_row = wd->item_count;
+         if (wd->filled
+             && (unsigned int)wd->nmax > (unsigned int)wd->item_count)
+           tch = wd->nmax * wd->item_height;
          else
-           tch = items_row * it->wd->item_height;
-        alignh = (vh - tch) * it->wd->align_y;
+           tch = items_row * wd->item_height;
+        *alignh = (vh - tch) * wd->align_y;
      }
    else
      {
         unsigned int rows, items_visible = 0, items_col;
 
-        if (it->wd->item_width > 0)
-          items_visible = vw / it->wd->item_width;
+        if (wd->item_width > 0)
+          items_visible = vw / wd->item_width;
         if (items_visible < 1)
           items_visible = 1;
 
@@ -1208,19 +1649,40 @@ _item_place(Elm_Gen_Item *it,
         if (items_count % items_visible)
           rows++;
 
-        tch = (it->wd->item_height * rows) + (it->wd->group_item_height * eina_list_count(it->wd->group_items));
-        alignh = (vh - tch) * it->wd->align_y;
+        tch = (wd->item_height * rows) + (wd->group_item_height * eina_list_count(wd->group_items));
+        *alignh = (vh - tch) * wd->align_y;
 
         items_col = items_visible;
-        if (items_col > it->wd->item_count)
-          items_col = it->wd->item_count;
-         if (it->wd->filled
-             && (unsigned int)it->wd->nmax > (unsigned int)it->wd->item_count)
-           tcw = it->wd->nmax * it->wd->item_width;
+        if (items_col > wd->item_count)
+          items_col = wd->item_count;
+         if (wd->filled
+             && (unsigned int)wd->nmax > (unsigned int)wd->item_count)
+           tcw = wd->nmax * wd->item_width;
          else
-           tcw = items_col * it->wd->item_width;
-        alignw = (vw - tcw) * it->wd->align_x;
+           tcw = items_col * wd->item_width;
+        *alignw = (vw - tcw) * wd->align_x;
      }
+}
+
+static void
+_item_place(Elm_Gen_Item *it,
+            Evas_Coord    cx,
+            Evas_Coord    cy)
+{
+   Evas_Coord x, y, ox, oy, cvx, cvy, cvw, cvh, iw, ih, ww;
+   Evas_Coord alignw = 0, alignh = 0, vw, vh;
+   Eina_Bool reorder_item_move_forward = EINA_FALSE;
+   it->x = cx;
+   it->y = cy;
+   evas_object_geometry_get(it->wd->pan_smart, &ox, &oy, &vw, &vh);
+
+   /* Preload rows/columns at each side of the Gengrid */
+   cvx = ox - PRELOAD * it->wd->item_width;
+   cvy = oy - PRELOAD * it->wd->item_height;
+   cvw = vw + 2 * PRELOAD * it->wd->item_width;
+   cvh = vh + 2 * PRELOAD * it->wd->item_height;
+
+   _align_get(it->wd, vw, vh, &alignw, &alignh);
 
    if (it->group)
      {
@@ -1375,6 +1837,7 @@ _item_place(Elm_Gen_Item *it,
                                    reorder_item_move_forward = EINA_TRUE;
                               }
 
+                            it->wd->grid_index_valid = EINA_FALSE;
                             it->wd->items = eina_inlist_remove(it->wd->items,
                                                                  EINA_INLIST_GET(it->wd->reorder_it));
                             if (reorder_item_move_forward)
@@ -1437,6 +1900,7 @@ _item_del(Elm_Gen_Item *it)
    Evas_Object *obj = WIDGET(it);
 
    evas_event_freeze(evas_object_evas_get(obj));
+   it->wd->grid_index_valid = EINA_FALSE;
    it->wd->selected = eina_list_remove(it->wd->selected, it);
    if (it->realized) _elm_genlist_item_unrealize(it, EINA_FALSE);
    _elm_genlist_item_del_serious(it);
@@ -1459,15 +1923,166 @@ _item_unselect(Elm_Gen_Item *it)
      }
 }
 
+/* The line index: rows (columns when horizontal) only depend on the
+ * items order, the group items and nmax, so they are kept across pan
+ * changes and resizes, and only rebuilt when one of those changes.
+ * Appending at the end extends it in place. */
+static void
+_grid_line_add(Widget_Data *wd, Elm_Gen_Item *it)
+{
+   if (wd->grid_lines_count == wd->grid_lines_size)
+     {
+        Elm_Gen_Item **lines;
+        unsigned int size = wd->grid_lines_size ? wd->grid_lines_size * 2 : 64;
+
+        lines = realloc(wd->grid_lines, size * sizeof(Elm_Gen_Item *));
+        if (!lines)
+          {
+             wd->grid_index_valid = EINA_FALSE;
+             return;
+          }
+        wd->grid_lines = lines;
+        wd->grid_lines_size = size;
+     }
+   wd->grid_lines[wd->grid_lines_count++] = it;
+}
+
+static void
+_grid_index_item_add(Widget_Data *wd, Elm_Gen_Item *it)
+{
+   Evas_Coord *major, *minor;
+
+   if (wd->horizontal)
+     {
+        major = &wd->grid_cx;
+        minor = &wd->grid_cy;
+     }
+   else
+     {
+        major = &wd->grid_cy;
+        minor = &wd->grid_cx;
+     }
+
+   it->item->prev_group = wd->grid_groups;
+   if (it->group)
+     {
+        if (*minor)
+          {
+             wd->items_lost += wd->nmax - *minor;
+             *minor = 0;
+             (*major)++;
+          }
+        wd->grid_groups++;
+        wd->grid_last_group = it;
+        _grid_line_add(wd, it);
+        it->x = wd->grid_cx;
+        it->y = wd->grid_cy;
+        (*major)++;
+     }
+   else
+     {
+        it->parent = wd->grid_last_group;
+        if (!*minor) _grid_line_add(wd, it);
+        it->x = wd->grid_cx;
+        it->y = wd->grid_cy;
+        *minor = (*minor + 1) % wd->nmax;
+        if (!*minor) (*major)++;
+     }
+}
+
+static void
+_grid_index_build(Widget_Data *wd)
+{
+   Elm_Gen_Item *it;
+
+   wd->items_lost = 0;
+   wd->grid_lines_count = 0;
+   wd->grid_last_group = NULL;
+   wd->grid_cx = 0;
+   wd->grid_cy = 0;
+   wd->grid_groups = 0;
+   wd->grid_index_valid = EINA_TRUE;
+   wd->grid_range_valid = EINA_FALSE;
+   EINA_INLIST_FOREACH(wd->items, it)
+     _grid_index_item_add(wd, it);
+}
+
+static Evas_Coord
+_grid_line_pos_get(const Widget_Data *wd, unsigned int line)
+{
+   return _item_major_pos_get(wd, wd->grid_lines[line]);
+}
+
+static Evas_Coord
+_grid_line_end_get(const Widget_Data *wd, unsigned int line)
+{
+   Evas_Coord size;
+
+   if (wd->grid_lines[line]->group)
+     size = wd->horizontal ? wd->group_item_width : wd->group_item_height;
+   else
+     size = wd->horizontal ? wd->item_width : wd->item_height;
+   return _grid_line_pos_get(wd, line) + size;
+}
+
+/* Lines intersecting the viewport plus the preload margin, found by
+ * binary search. Returns EINA_FALSE when every item has to be placed. */
+static Eina_Bool
+_grid_range_get(Widget_Data  *wd,
+                unsigned int *first,
+                unsigned int *last)
+{
+   Evas_Coord vw, vh, alignw = 0, alignh = 0, lo, hi;
+   unsigned int a, b, m;
+
+   if ((!wd->grid_index_valid) || (!wd->grid_lines_count)) return EINA_FALSE;
+   if (wd->reorder_mode) return EINA_FALSE;
+   if ((wd->horizontal) && (elm_widget_mirrored_get(wd->obj))) return EINA_FALSE;
+
+   evas_object_geometry_get(wd->pan_smart, NULL, NULL, &vw, &vh);
+   _align_get(wd, vw, vh, &alignw, &alignh);
+   if (wd->horizontal)
+     {
+        lo = wd->pan_x - alignw - PRELOAD * wd->item_width;
+        hi = lo + vw + 2 * PRELOAD * wd->item_width;
+     }
+   else
+     {
+        lo = wd->pan_y - alignh - PRELOAD * wd->item_height;
+        hi = lo + vh + 2 * PRELOAD * wd->item_height;
+     }
+
+   a = 0;
+   b = wd->grid_lines_count;
+   while (a < b)
+     {
+        m = (a + b) / 2;
+        if (_grid_line_end_get(wd, m) <= lo) a = m + 1;
+        else b = m;
+     }
+   *first = a;
+   b = wd->grid_lines_count;
+   while (a < b)
+     {
+        m = (a + b) / 2;
+        if (_grid_line_pos_get(wd, m) < hi) a = m + 1;
+        else b = m;
+     }
+   *last = a;
+
+   /* keep one extra line on each side against rounding in _item_place() */
+   if (*first > 0) (*first)--;
+   if (*last >= wd->grid_lines_count) *last = wd->grid_lines_count - 1;
+   if (*last < *first) *last = *first;
+   return EINA_TRUE;
+}
+
 static void
 _calc_job(void *data)
 {
    Widget_Data *wd = data;
    Evas_Coord minw = 0, minh = 0, nmax = 0, cvw, cvh;
-   Elm_Gen_Item *it, *group_item = NULL;
-   int count_group = 0;
    long count = 0;
-   wd->items_lost = 0;
 
    evas_object_geometry_get(wd->pan_smart, NULL, NULL, &cvw, &cvh);
    if ((cvw != 0) || (cvh != 0))
@@ -1480,37 +2095,21 @@ _calc_job(void *data)
         if (nmax < 1)
           nmax = 1;
 
-        EINA_INLIST_FOREACH(wd->items, it)
+        if ((!wd->grid_index_valid) || ((unsigned int)nmax != wd->nmax))
           {
-             if (it->item->prev_group != count_group)
-               it->item->prev_group = count_group;
-             if (it->group)
-               {
-                  count = count % nmax;
-                  if (count)
-                    wd->items_lost += nmax - count;
-                  //printf("%d items and I lost %d\n", count, wd->items_lost);
-                  count_group++;
-                  if (count) count = 0;
-                  group_item = it;
-               }
-             else
-               {
-                  if (it->parent != group_item)
-                    it->parent = group_item;
-                  count++;
-               }
+             wd->nmax = nmax;
+             _grid_index_build(wd);
           }
-        count = wd->item_count + wd->items_lost - count_group;
+        count = wd->item_count + wd->items_lost - wd->grid_groups;
         if (wd->horizontal)
           {
-             minw = (ceil(count / (float)nmax) * wd->item_width) + (count_group * wd->group_item_width);
+             minw = (ceil(count / (float)nmax) * wd->item_width) + (wd->grid_groups * wd->group_item_width);
              minh = nmax * wd->item_height;
           }
         else
           {
              minw = nmax * wd->item_width;
-             minh = (ceil(count / (float)nmax) * wd->item_height) + (count_group * wd->group_item_height);
+             minh = (ceil(count / (float)nmax) * wd->item_height) + (wd->grid_groups * wd->group_item_height);
           }
 
         if ((minw != wd->minw) || (minh != wd->minh))
@@ -1556,7 +2155,10 @@ _pan_set(Evas_Object *obj,
          Evas_Coord   y)
 {
    Pan *sd = evas_object_smart_data_get(obj);
+   Evas_Coord d;
    if ((x == sd->wd->pan_x) && (y == sd->wd->pan_y)) return;
+   d = sd->wd->horizontal ? x - sd->wd->pan_x : y - sd->wd->pan_y;
+   if (d) sd->wd->thumb_dir = (d > 0) ? 1 : -1;
    sd->wd->pan_x = x;
    sd->wd->pan_y = y;
    evas_object_smart_changed(obj);
@@ -1628,6 +2230,131 @@ _pan_resize(Evas_Object *obj,
    sd->wd->calc_job = ecore_job_add(_calc_job, sd->wd);
 }
 
+static Elm_Gen_Item *
+_grid_line_end_item_get(Widget_Data *wd, unsigned int line)
+{
+   if (line + 1 < wd->grid_lines_count) return wd->grid_lines[line + 1];
+   return NULL;
+}
+
+/* Queue the decodes of the lines following the viewport in the
+ * scrolling direction, and forget those queued for lines left behind. */
+static void
+_thumb_ahead(Widget_Data  *wd,
+             unsigned int  first,
+             unsigned int  last)
+{
+   Evas_Coord vw, vh, center, reach;
+   unsigned int line, end_line;
+   Elm_Gen_Item *it, *end;
+   const Eina_List *parts, *pl;
+   Eina_List *l, *l_next;
+   const char *part, *file, *key;
+   char id[PATH_MAX + 64];
+   Thumb *th;
+
+   if ((!wd->thumb_get) || (!wd->thumb_parts)) return;
+
+   evas_object_geometry_get(wd->pan_smart, NULL, NULL, &vw, &vh);
+   if (wd->horizontal)
+     {
+        center = wd->pan_x + (vw / 2);
+        reach = (vw / 2) + ((THUMB_AHEAD + PRELOAD + 1) * wd->item_width);
+     }
+   else
+     {
+        center = wd->pan_y + (vh / 2);
+        reach = (vh / 2) + ((THUMB_AHEAD + PRELOAD + 1) * wd->item_height);
+     }
+   EINA_LIST_FOREACH_SAFE(wd->thumb_queue, l, l_next, th)
+     {
+        if ((!th->it) && (abs(th->pos - center) > reach))
+          _thumb_free(th);
+     }
+
+   if (wd->thumb_dir >= 0)
+     {
+        line = last + 1;
+        end_line = last + THUMB_AHEAD;
+     }
+   else
+     {
+        if (!first) return;
+        end_line = first - 1;
+        line = (first > THUMB_AHEAD) ? first - THUMB_AHEAD : 0;
+     }
+   for (; (line <= end_line) && (line < wd->grid_lines_count); line++)
+     {
+        end = _grid_line_end_item_get(wd, line);
+        for (it = wd->grid_lines[line]; (it) && (it != end);
+             it = ELM_GEN_ITEM_FROM_INLIST(EINA_INLIST_GET(it)->next))
+          {
+             if ((it->group) || (it->realized) ||
+                 (it->generation < wd->generation))
+               continue;
+             parts = eina_hash_find(wd->thumb_parts, it->itc->item_style ?
+                                    it->itc->item_style : "default");
+             EINA_LIST_FOREACH(parts, pl, part)
+               {
+                  file = NULL;
+                  key = NULL;
+                  if ((!wd->thumb_get((void *)it->base.data, WIDGET(it),
+                                      part, &file, &key)) || (!file))
+                    continue;
+                  _thumb_id_get(wd, file, key, id, sizeof(id));
+                  if ((wd->thumbs) && (eina_hash_find(wd->thumbs, id)))
+                    continue;
+                  th = _thumb_new(wd, id, file, key);
+                  if (th) th->pos = _item_major_pos_get(wd, it);
+               }
+          }
+     }
+}
+
+static Eina_Bool
+_pan_calculate_range(Pan *sd)
+{
+   Widget_Data *wd = sd->wd;
+   Elm_Gen_Item *it, *end;
+   unsigned int first, last, line;
+   Eina_List *l;
+
+   if (!wd->grid_range_valid) return EINA_FALSE;
+   if (!_grid_range_get(wd, &first, &last)) return EINA_FALSE;
+
+   /* lines left since the last frame */
+   for (line = wd->grid_first_line; line <= wd->grid_last_line; line++)
+     {
+        if ((line >= first) && (line <= last)) continue;
+        end = _grid_line_end_item_get(wd, line);
+        for (it = wd->grid_lines[line]; (it) && (it != end);
+             it = ELM_GEN_ITEM_FROM_INLIST(EINA_INLIST_GET(it)->next))
+          {
+             if (!it->group)
+               _elm_genlist_item_unrealize(it, EINA_FALSE);
+          }
+     }
+
+   /* headers are flagged again by their visible items */
+   EINA_LIST_FOREACH(wd->group_items, l, it)
+     it->item->group_realized = EINA_FALSE;
+   it = wd->grid_lines[first];
+   if ((!it->group) && (it->parent))
+     _item_place(it->parent, it->parent->x, it->parent->y);
+
+   end = _grid_line_end_item_get(wd, last);
+   for (; (it) && (it != end);
+        it = ELM_GEN_ITEM_FROM_INLIST(EINA_INLIST_GET(it)->next))
+     {
+        _item_place(it, it->x, it->y);
+        if (wd->reorder_item_changed) return EINA_TRUE;
+     }
+   wd->grid_first_line = first;
+   wd->grid_last_line = last;
+   _thumb_ahead(wd, first, last);
+   return EINA_TRUE;
+}
+
 static void
 _pan_calculate(Evas_Object *obj)
 {
@@ -1640,6 +2367,12 @@ _pan_calculate(Evas_Object *obj)
 
    sd->wd->reorder_item_changed = EINA_FALSE;
 
+   if (_pan_calculate_range(sd))
+     {
+        if (sd->wd->reorder_item_changed) return;
+        goto done;
+     }
+
    EINA_INLIST_FOREACH(sd->wd->items, it)
      {
         if (it->group)
@@ -1690,7 +2423,12 @@ _pan_calculate(Evas_Object *obj)
                }
           }
      }
+   sd->wd->grid_range_valid =
+      _grid_range_get(sd->wd, &sd->wd->grid_first_line, &sd->wd->grid_last_line);
+
+done:
    _group_item_place(sd);
+   if (sd->wd->thumb_queue) _thumb_queue_run(sd->wd);
 
 
    if ((sd->wd->reorder_mode) && (sd->wd->reorder_it))
@@ -1953,6 +2691,7 @@ elm_gengrid_add(Evas_Object *parent)
    wd->obj = obj;
    wd->align_x = 0.5;
    wd->align_y = 0.5;
+   wd->item_cache_max = ITEM_CACHE_MAX;
    wd->h_bounce = bounce;
    wd->v_bounce = bounce;
    wd->highlight = EINA_TRUE;
@@ -2082,11 +2821,13 @@ elm_gengrid_item_append(Evas_Object                  *obj,
    it = _item_new(wd, itc, data, func, func_data);
    if (!it) return NULL;
    wd->items = eina_inlist_append(wd->items, EINA_INLIST_GET(it));
-   it->position = eina_inlist_count(wd->items);
+   it->position = wd->item_count;
    it->position_update = EINA_TRUE;
 
    if (it->group)
      wd->group_items = eina_list_prepend(wd->group_items, it);
+   if (wd->grid_index_valid)
+     _grid_index_item_add(wd, it);
 
    if (wd->calc_job) ecore_job_del(wd->calc_job);
    wd->calc_job = ecore_job_add(_calc_job, wd);
@@ -2109,6 +2850,7 @@ elm_gengrid_item_prepend(Evas_Object                  *obj,
    it = _item_new(wd, itc, data, func, func_data);
    if (!it) return NULL;
    wd->items = eina_inlist_prepend(wd->items, EINA_INLIST_GET(it));
+   wd->grid_index_valid = EINA_FALSE;
    _item_position_update(wd->items, 0);
 
    if (it->group)
@@ -2138,6 +2880,7 @@ elm_gengrid_item_insert_before(Evas_Object                  *obj,
    if (!it) return NULL;
    wd->items = eina_inlist_prepend_relative
       (wd->items, EINA_INLIST_GET(it), EINA_INLIST_GET((Elm_Gen_Item *) relative));
+   wd->grid_index_valid = EINA_FALSE;
    Eina_Inlist *tmp = eina_inlist_find(wd->items, EINA_INLIST_GET(it));
    _item_position_update(tmp, ((Elm_Gen_Item *)relative)->position);
 
@@ -2168,6 +2911,7 @@ elm_gengrid_item_insert_after(Evas_Object                  *obj,
    if (!it) return NULL;
    wd->items = eina_inlist_append_relative
       (wd->items, EINA_INLIST_GET(it), EINA_INLIST_GET((Elm_Gen_Item *) relative));
+   wd->grid_index_valid = EINA_FALSE;
    Eina_Inlist *tmp = eina_inlist_find(wd->items, EINA_INLIST_GET(it));
    _item_position_update(tmp, ((Elm_Gen_Item *)relative)->position+1);
 
@@ -2202,6 +2946,7 @@ elm_gengrid_item_sorted_insert(Evas_Object                  *obj,
    wd->item_compare_cb = comp;
    wd->items = eina_inlist_sorted_state_insert(wd->items, EINA_INLIST_GET(it),
                                          _elm_gengrid_item_compare, wd->state);
+   wd->grid_index_valid = EINA_FALSE;
    _item_position_update(wd->items, 0);
 
    if (wd->calc_job) ecore_job_del(wd->calc_job);
@@ -2220,6 +2965,7 @@ elm_gengrid_horizontal_set(Evas_Object *obj,
    horizontal = !!horizontal;
    if (horizontal == wd->horizontal) return;
    wd->horizontal = horizontal;
+   wd->grid_index_valid = EINA_FALSE;
 
    /* Update the items to conform to the new layout */
    if (wd->calc_job) ecore_job_del(wd->calc_job);
@@ -2750,6 +3496,49 @@ elm_gengrid_filled_get(const Evas_Object *obj)
    return wd->filled;
 }
 
+EAPI void
+elm_gengrid_item_cache_max_set(Evas_Object *obj,
+                               int          max)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (max < 0) max = 0;
+   wd->item_cache_max = max;
+   _item_cache_clean(wd);
+}
+
+EAPI int
+elm_gengrid_item_cache_max_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) 0;
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return 0;
+   return wd->item_cache_max;
+}
+
+EAPI void
+elm_gengrid_item_thumb_cb_set(Evas_Object                  *obj,
+                              Elm_Gengrid_Item_Thumb_Get_Cb func)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   wd->thumb_get = func;
+}
+
+EAPI void
+elm_gengrid_item_cache_stats_get(const Evas_Object *obj,
+                                 unsigned int      *hits,
+                                 unsigned int      *misses)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (hits) *hits = wd->item_cache_hits;
+   if (misses) *misses = wd->item_cache_misses;
+}
+
 EAPI unsigned int
 elm_gengrid_items_count(const Evas_Object *obj)
 {
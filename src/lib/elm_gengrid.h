@@ -264,6 +264,23 @@ typedef Elm_Gen_Item_State_Get_Cb Elm_Gengrid_Item_State_Get_Cb;
  */
 typedef Elm_Gen_Item_Del_Cb Elm_Gengrid_Item_Del_Cb;
 
+/**
+ * Thumbnail fetching class function for gengrid item classes.
+ *
+ * @param data The data passed in the item creation function
+ * @param obj The base widget object
+ * @param part The content part name of the item's theme
+ * @param file Where to store the image file path to show in @p part
+ * @param key Where to store the image key inside @p file, or @c NULL
+ * @return @c EINA_TRUE if @p part shows an image file, @c EINA_FALSE to
+ * fall back to the content_get class function.
+ *
+ * The strings are only used during the call.
+ *
+ * @see elm_gengrid_item_thumb_cb_set()
+ */
+typedef Eina_Bool (*Elm_Gengrid_Item_Thumb_Get_Cb)(void *data, Evas_Object *obj, const char *part, const char **file, const char **key);
+
 /**
  * Add a new gengrid widget to the given parent Elementary
  * (container) object
@@ -1500,6 +1517,78 @@ EAPI void                          elm_gengrid_filled_set(Evas_Object *obj, Eina
  */
 EAPI Eina_Bool                     elm_gengrid_filled_get(const Evas_Object *obj);
 
+/**
+ * Set the maximum number of item views kept for reuse
+ *
+ * @param obj The gengrid object.
+ * @param max The maximum number of cached item views. @c 0 disables
+ * the cache.
+ *
+ * When an item scrolls out of the viewport, its Edje view is hidden
+ * and kept in a cache instead of being deleted. Items realized later
+ * with the same item style take a view from this cache instead of
+ * creating and theming a new one. The default is 64.
+ *
+ * @see elm_gengrid_item_cache_max_get()
+ * @see elm_gengrid_item_cache_stats_get()
+ *
+ * @ingroup Gengrid
+ */
+EAPI void                          elm_gengrid_item_cache_max_set(Evas_Object *obj, int max);
+
+/**
+ * Get the maximum number of item views kept for reuse
+ *
+ * @param obj The gengrid object.
+ * @return The maximum number of cached item views, or @c 0 on errors.
+ *
+ * @see elm_gengrid_item_cache_max_set() for more details
+ *
+ * @ingroup Gengrid
+ */
+EAPI int                           elm_gengrid_item_cache_max_get(const Evas_Object *obj);
+
+/**
+ * Get how many item realizations were served by the item view cache
+ *
+ * @param obj The gengrid object.
+ * @param hits Pointer to a variable where to store the number of
+ * realizations that reused a cached view.
+ * @param misses Pointer to a variable where to store the number of
+ * realizations that had to create a new view.
+ *
+ * @note Use @c NULL pointers on the values you're not interested in:
+ * they'll be ignored by the function.
+ *
+ * @see elm_gengrid_item_cache_max_set()
+ *
+ * @ingroup Gengrid
+ */
+EAPI void                          elm_gengrid_item_cache_stats_get(const Evas_Object *obj, unsigned int *hits, unsigned int *misses);
+
+/**
+ * Show image files as item contents without decoding them on the main loop
+ *
+ * @param obj The gengrid object.
+ * @param func The function giving the image file of a content part, or
+ * @c NULL to only use the content_get class function.
+ *
+ * For every content part of a realized item, @p func is asked for an
+ * image file first. Gengrid then creates the image itself, scaled down
+ * to the item size at load time, and decodes it asynchronously: the
+ * part stays empty until the pixels are ready. Pending decodes are
+ * started closest to the viewport first, favouring the scroll
+ * direction, and the next rows in the scroll direction are decoded
+ * ahead of time.
+ *
+ * Decoded images that scrolled out are kept for reuse, within the
+ * "gengrid_thumb_cache_size" configuration budget (in megabytes)
+ * shared by all gengrids of the process, @c 0 meaning no limit.
+ *
+ * @ingroup Gengrid
+ */
+EAPI void                          elm_gengrid_item_thumb_cb_set(Evas_Object *obj, Elm_Gengrid_Item_Thumb_Get_Cb func);
+
 /**
  * Set the gengrid select mode.
  *
@@ -1975,6 +1975,18 @@ _content_unfocused(void *data, Evas_Object *obj __UNUSED__, void *event_info __U
 }
 
 
+static Evas_Object *
+_item_content_get(Elm_Gen_Item *it, const char *part)
+{
+   Evas_Object *ic;
+   ELM_PERF_SPAN_BEGIN(t0);
+
+   ic = it->itc->func.content_get((void *)it->base.data, WIDGET(it), part);
+   ELM_PERF_SPAN_END(t0, elm_widget_type_get(WIDGET(it)),
+                     ELM_PERF_SITE_CONTENT_GET);
+   return ic;
+}
+
 static Eina_List *
 _item_mode_content_realize(Elm_Gen_Item *it,
                            Evas_Object  *target,
@@ -1995,8 +2007,7 @@ _item_mode_content_realize(Elm_Gen_Item *it,
              if (parts && fnmatch(parts, key, FNM_PERIOD))
                continue;
 
-             ic = it->itc->func.content_get
-               ((void *)it->base.data, WIDGET(it), key);
+             ic = _item_content_get(it, key);
 
              if (ic)
                {
@@ -2151,8 +2162,7 @@ _item_content_realize(Elm_Gen_Item *it,
                continue;
 
              if (it->itc->func.content_get)
-               ic = it->itc->func.content_get
-                  ((void *)it->base.data, WIDGET(it), key);
+               ic = _item_content_get(it, key);
              if (ic)
                {
                   res = eina_list_append(res, ic);
@@ -2253,6 +2263,7 @@ _item_realize(Elm_Gen_Item *it,
         //evas_event_thaw_eval(evas_object_evas_get(it->wd->obj));
         return;
      }
+   ELM_PERF_SPAN_BEGIN(t0);
    it->item->order_num_in = in;
 
    if ((it->item->nocache_once) && (!it->flipped))
@@ -2450,6 +2461,8 @@ _item_realize(Elm_Gen_Item *it,
           }
      }
    edje_object_message_signal_process(VIEW(it));
+   ELM_PERF_SPAN_END(t0, elm_widget_type_get(WIDGET(it)),
+                     ELM_PERF_SITE_ITEM_REALIZE);
 }
 
 static void
@@ -4567,6 +4580,7 @@ _queue_process(Widget_Data *wd)
 {
    int n;
    double t0, t;
+   ELM_PERF_SPAN_BEGIN(span);
 
    t0 = ecore_loop_time_get();
    //evas_event_freeze(evas_object_evas_get(wd->obj));
@@ -4588,6 +4602,8 @@ _queue_process(Widget_Data *wd)
      }
    //evas_event_thaw(evas_object_evas_get(wd->obj));
    //evas_event_thaw_eval(evas_object_evas_get(wd->obj));
+   ELM_PERF_SPAN_END(span, elm_widget_type_get(wd->obj),
+                     ELM_PERF_SITE_QUEUE_PROCESS);
    return n;
 }
 
@@ -6431,6 +6447,7 @@ _elm_genlist_item_unrealize(Elm_Gen_Item *it,
    if (it->wd->reorder_it == it) return;
    if (it->defer_unrealize && !it->item->updateme) return;
 
+   ELM_PERF_SPAN_BEGIN(t0);
    evas_event_freeze(evas_object_evas_get(WIDGET(it)));
    if (!calc)
      evas_object_smart_callback_call(WIDGET(it), SIG_UNREALIZED, it);
@@ -6458,6 +6475,8 @@ _elm_genlist_item_unrealize(Elm_Gen_Item *it,
    it->want_unrealize = EINA_FALSE;
    evas_event_thaw(evas_object_evas_get(WIDGET(it)));
    evas_event_thaw_eval(evas_object_evas_get(WIDGET(it)));
+   ELM_PERF_SPAN_END(t0, elm_widget_type_get(WIDGET(it)),
+                     ELM_PERF_SITE_ITEM_UNREALIZE);
 }
 
 void
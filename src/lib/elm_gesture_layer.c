@@ -21,15 +21,10 @@
 #define RAD2DEG(x) ((x) * 57.295779513)
 #define DEG2RAD(x) ((x) / 57.295779513)
 
-static void *
-_glayer_bufdup(void *buf, size_t size)
-{
-   void *p;
-   p = malloc(size);
-   memcpy(p, buf, size);
-   return p;
-}
-#define COPY_EVENT_INFO(EV) _glayer_bufdup(EV, sizeof(*EV))
+/* Initial capacity of the event history ring, grows by doubling */
+#define ELM_GESTURE_EVENT_HISTORY_SIZE 64
+
+#define COPY_EVENT_INFO(DST, EV) memcpy(DST, EV, sizeof(*EV))
 
 
 #define SET_TEST_BIT(P) do { \
@@ -38,6 +33,18 @@ _glayer_bufdup(void *buf, size_t size)
 
 #define IS_TESTED(T) ((wd->gesture[T]) ? wd->gesture[T]->test : EINA_FALSE)
 
+/* Run recognizer CALL for gesture T, timing it when profiling is enabled */
+#define PROFILED_TEST(T, CALL) do { \
+   if (wd->profile) \
+     { \
+        double _t0 = ecore_time_get(); \
+        CALL; \
+        _profile_add(wd, T, ecore_time_get() - _t0); \
+     } \
+   else \
+     CALL; \
+} while (0)
+
 /**
  * @internal
  *
@@ -79,6 +86,7 @@ struct _Gesture_Info
   Elm_Gesture_State state;  /**< gesture state */
   void *info;                        /**< Data for the state callback */
   Eina_Bool test; /**< if true this gesture should be tested on input */
+  Elm_Gesture_Profile_Info prof; /**< Time spent testing and transitions */
 };
 
 /**
@@ -95,16 +103,28 @@ typedef struct _Gesture_Info Gesture_Info;
  * @internal
  *
  * @struct _Event_History
- * Struct holds event history.
+ * Struct holds one event history record.
  * These events are repeated if no gesture found.
+ * Records live in a preallocated ring buffer (see Widget_Data),
+ * so no allocation happens per input event.
  *
  * @ingroup Elm_Gesture_Layer
  */
 struct _Event_History
 {
-   EINA_INLIST;
-   void *event;
    Evas_Callback_Type event_type;
+   union
+     {
+        Evas_Event_Mouse_Down mouse_down;
+        Evas_Event_Mouse_Move mouse_move;
+        Evas_Event_Mouse_Up mouse_up;
+        Evas_Event_Mouse_Wheel mouse_wheel;
+        Evas_Event_Multi_Down multi_down;
+        Evas_Event_Multi_Move multi_move;
+        Evas_Event_Multi_Up multi_up;
+        Evas_Event_Key_Down key_down;
+        Evas_Event_Key_Up key_up;
+     } event; /**< Copy of the event, tagged by event_type */
 };
 
 /**
@@ -238,7 +258,10 @@ typedef struct _Rotate_Type Rotate_Type;
 struct _Widget_Data
 {
    Evas_Object *target;  /* Target Widget */
-   Event_History *event_history_list;
+   Event_History *event_history; /* Ring buffer of recorded events */
+   unsigned int event_history_size;  /* Capacity of the ring */
+   unsigned int event_history_first; /* Index of the oldest record */
+   unsigned int event_history_count; /* Number of records in the ring */
 
    int line_min_length;
    Evas_Coord zoom_distance_tolerance;
@@ -260,6 +283,7 @@ struct _Widget_Data
    Eina_List *touched;  /* Information  of touched devices   */
 
    Eina_Bool repeat_events : 1;
+   Eina_Bool profile : 1; /* Measure time spent in each recognizer */
 };
 typedef struct _Widget_Data Widget_Data;
 
@@ -505,6 +529,8 @@ _set_state(Gesture_Info *g, Elm_Gesture_State s,
      return EVAS_EVENT_FLAG_NONE;
 
    old_state = g->state;
+   if ((s != old_state) && (s != ELM_GESTURE_STATE_UNDEFINED))
+     g->prof.transitions[s]++;
 
    g->state = s;
    g->info = info;  /* Information for user callback */
@@ -966,19 +992,17 @@ _event_history_clear(Evas_Object *obj)
 
    /* Disable gesture layer so refeeded events won't be consumed by it */
    _unregister_callbacks(obj);
-   while (wd->event_history_list)
+   while (wd->event_history_count)
      {
         Event_History *t;
-        t = wd->event_history_list;
+        t = &wd->event_history[wd->event_history_first];
         Eina_List *pending = _device_is_pending(wd->pending,
-              wd->event_history_list->event,
-              wd->event_history_list->event_type);
+              &t->event, t->event_type);
 
         /* Refeed events if no gesture matched input */
         if (pending || ((!gesture_found) && (!wd->repeat_events)))
           {
-             evas_event_refeed_event(e, wd->event_history_list->event,
-                   wd->event_history_list->event_type);
+             evas_event_refeed_event(e, &t->event, t->event_type);
 
              if (pending)
                {
@@ -987,17 +1011,15 @@ _event_history_clear(Evas_Object *obj)
              else
                {
                   wd->pending = _add_device_pending(wd->pending,
-                        wd->event_history_list->event,
-                        wd->event_history_list->event_type);
+                        &t->event, t->event_type);
                }
           }
 
-        free(wd->event_history_list->event);
-        wd->event_history_list = (Event_History *) eina_inlist_remove(
-              EINA_INLIST_GET(wd->event_history_list),
-              EINA_INLIST_GET(wd->event_history_list));
-        free(t);
+        wd->event_history_first =
+           (wd->event_history_first + 1) % wd->event_history_size;
+        wd->event_history_count--;
      }
+   wd->event_history_first = 0;
    _register_callbacks(obj);
    return EINA_TRUE;
 }
@@ -1006,49 +1028,94 @@ _event_history_clear(Evas_Object *obj)
  * @internal
  *
  * This function copies input events.
- * We copy event info before adding it to history.
- * The memory is freed when we clear history.
+ * We copy event info into the history record before adding it to history.
  *
+ * @param ev the history record to fill
  * @param event the event to copy
  * @param event_type event type to copy
+ * @return EINA_FALSE if event type is not recorded in history
  *
  * @ingroup Elm_Gesture_Layer
  */
-static void *
-_copy_event_info(void *event, Evas_Callback_Type event_type)
+static Eina_Bool
+_copy_event_info(Event_History *ev, void *event, Evas_Callback_Type event_type)
 {
    switch(event_type)
      {
       case EVAS_CALLBACK_MOUSE_DOWN:
-         return COPY_EVENT_INFO((Evas_Event_Mouse_Down *) event);
+         COPY_EVENT_INFO(&ev->event.mouse_down, (Evas_Event_Mouse_Down *) event);
          break;
       case EVAS_CALLBACK_MOUSE_MOVE:
-         return COPY_EVENT_INFO((Evas_Event_Mouse_Move *) event);
+         COPY_EVENT_INFO(&ev->event.mouse_move, (Evas_Event_Mouse_Move *) event);
          break;
       case EVAS_CALLBACK_MOUSE_UP:
-         return COPY_EVENT_INFO((Evas_Event_Mouse_Up *) event);
+         COPY_EVENT_INFO(&ev->event.mouse_up, (Evas_Event_Mouse_Up *) event);
          break;
       case EVAS_CALLBACK_MOUSE_WHEEL:
-         return COPY_EVENT_INFO((Evas_Event_Mouse_Wheel *) event);
+         COPY_EVENT_INFO(&ev->event.mouse_wheel, (Evas_Event_Mouse_Wheel *) event);
          break;
       case EVAS_CALLBACK_MULTI_DOWN:
-         return COPY_EVENT_INFO((Evas_Event_Multi_Down *) event);
+         COPY_EVENT_INFO(&ev->event.multi_down, (Evas_Event_Multi_Down *) event);
          break;
       case EVAS_CALLBACK_MULTI_MOVE:
-         return COPY_EVENT_INFO((Evas_Event_Multi_Move *) event);
+         COPY_EVENT_INFO(&ev->event.multi_move, (Evas_Event_Multi_Move *) event);
          break;
       case EVAS_CALLBACK_MULTI_UP:
-         return COPY_EVENT_INFO((Evas_Event_Multi_Up *) event);
+         COPY_EVENT_INFO(&ev->event.multi_up, (Evas_Event_Multi_Up *) event);
          break;
       case EVAS_CALLBACK_KEY_DOWN:
-         return COPY_EVENT_INFO((Evas_Event_Key_Down *) event);
+         COPY_EVENT_INFO(&ev->event.key_down, (Evas_Event_Key_Down *) event);
          break;
       case EVAS_CALLBACK_KEY_UP:
-         return COPY_EVENT_INFO((Evas_Event_Key_Up *) event);
+         COPY_EVENT_INFO(&ev->event.key_up, (Evas_Event_Key_Up *) event);
          break;
       default:
-         return NULL;
+         return EINA_FALSE;
      }
+
+   ev->event_type = event_type;
+   return EINA_TRUE;
+}
+
+/**
+ * @internal
+ *
+ * This function makes room for one more record in event history ring.
+ * The ring is only reallocated when it is full, its capacity is doubled
+ * and records are unwrapped so the oldest one is at index 0 again.
+ *
+ * @param wd The gesture-layer data.
+ * @return EINA_FALSE on allocation failure
+ *
+ * @ingroup Elm_Gesture_Layer
+ */
+static Eina_Bool
+_event_history_reserve(Widget_Data *wd)
+{
+   Event_History *tmp;
+   unsigned int size, tail;
+
+   if (wd->event_history_count < wd->event_history_size)
+     return EINA_TRUE;
+
+   size = (wd->event_history_size) ?
+      (wd->event_history_size * 2) : ELM_GESTURE_EVENT_HISTORY_SIZE;
+   tmp = realloc(wd->event_history, size * sizeof(Event_History));
+   if (!tmp) return EINA_FALSE;
+
+   /* Move wrapped part (records before first) after the old end */
+   tail = wd->event_history_size - wd->event_history_first;
+   if ((wd->event_history_first) && (wd->event_history_count > tail))
+     memcpy(tmp + wd->event_history_size, tmp,
+            (wd->event_history_count - tail) * sizeof(Event_History));
+   if (wd->event_history_first)
+     memmove(tmp, tmp + wd->event_history_first,
+             wd->event_history_count * sizeof(Event_History));
+
+   wd->event_history = tmp;
+   wd->event_history_size = size;
+   wd->event_history_first = 0;
+   return EINA_TRUE;
 }
 
 static Eina_Bool
@@ -1058,11 +1125,12 @@ _event_history_add(Evas_Object *obj, void *event, Evas_Callback_Type event_type)
    Event_History *ev;
    if (!wd) return EINA_FALSE;
 
-   ev = malloc(sizeof(Event_History));
-   ev->event = _copy_event_info(event, event_type);  /* Freed on event_history_clear */
-   ev->event_type = event_type;
-   wd->event_history_list = (Event_History *) eina_inlist_append(
-         EINA_INLIST_GET(wd->event_history_list), EINA_INLIST_GET(ev));
+   if (!_event_history_reserve(wd)) return EINA_FALSE;
+
+   ev = &wd->event_history[(wd->event_history_first + wd->event_history_count)
+      % wd->event_history_size];
+   if (!_copy_event_info(ev, event, event_type)) return EINA_FALSE;
+   wd->event_history_count++;
 
    return EINA_TRUE;
 }
@@ -1075,6 +1143,7 @@ _del_hook(Evas_Object *obj)
    if (!wd) return;
 
    _event_history_clear(obj);
+   free(wd->event_history);
    eina_list_free(wd->pending);
 
    Pointer_Event *data;
@@ -3186,6 +3255,27 @@ continues_gestures_restart(void *data, Eina_Bool states_reset)
      }
 }
 
+/**
+ * @internal
+ *
+ * Accumulates time spent by a recognizer on one input event.
+ *
+ * @param wd The gesture-layer data.
+ * @param g_type The gesture the recognizer was run for.
+ * @param t Time spent in seconds.
+ *
+ * @ingroup Elm_Gesture_Layer
+ */
+static void
+_profile_add(Widget_Data *wd, Elm_Gesture_Type g_type, double t)
+{
+   Gesture_Info *g = wd->gesture[g_type];
+   if (!g) return;
+
+   g->prof.time += t;
+   g->prof.calls++;
+}
+
 /**
  * @internal
  *
@@ -3234,30 +3324,46 @@ _event_process(void *data, Evas_Object *obj __UNUSED__,
      pe = &_pe;
 
    if (IS_TESTED(ELM_GESTURE_N_LONG_TAPS))
-     _n_long_tap_test(data, pe, event_info, event_type,
-           ELM_GESTURE_N_LONG_TAPS);
+     PROFILED_TEST(ELM_GESTURE_N_LONG_TAPS,
+                   _n_long_tap_test(data, pe, event_info, event_type,
+                                    ELM_GESTURE_N_LONG_TAPS));
 
    /* This takes care of single, double and tripple tap */
-   _tap_gestures_test(data, pe, event_info, event_type);
+   /* Time is accounted to first tap gesture in use      */
+   PROFILED_TEST((wd->gesture[ELM_GESTURE_N_TAPS]) ? ELM_GESTURE_N_TAPS :
+                 (wd->gesture[ELM_GESTURE_N_DOUBLE_TAPS]) ?
+                 ELM_GESTURE_N_DOUBLE_TAPS : ELM_GESTURE_N_TRIPLE_TAPS,
+                 _tap_gestures_test(data, pe, event_info, event_type));
 
    if (IS_TESTED(ELM_GESTURE_MOMENTUM))
-     _momentum_test(data, pe, event_info, event_type,
-           ELM_GESTURE_MOMENTUM);
+     PROFILED_TEST(ELM_GESTURE_MOMENTUM,
+                   _momentum_test(data, pe, event_info, event_type,
+                                  ELM_GESTURE_MOMENTUM));
 
    if (IS_TESTED(ELM_GESTURE_N_LINES))
-     _n_line_test(data, pe, event_info, event_type, ELM_GESTURE_N_LINES);
+     PROFILED_TEST(ELM_GESTURE_N_LINES,
+                   _n_line_test(data, pe, event_info, event_type,
+                                ELM_GESTURE_N_LINES));
 
    if (IS_TESTED(ELM_GESTURE_N_FLICKS))
-     _n_line_test(data, pe, event_info, event_type, ELM_GESTURE_N_FLICKS);
+     PROFILED_TEST(ELM_GESTURE_N_FLICKS,
+                   _n_line_test(data, pe, event_info, event_type,
+                                ELM_GESTURE_N_FLICKS));
 
    if (_elm_config->glayer_zoom_finger_enable && IS_TESTED(ELM_GESTURE_ZOOM))
-     _zoom_test(data, pe, event_info, event_type, ELM_GESTURE_ZOOM);
+     PROFILED_TEST(ELM_GESTURE_ZOOM,
+                   _zoom_test(data, pe, event_info, event_type,
+                              ELM_GESTURE_ZOOM));
 
    if (IS_TESTED(ELM_GESTURE_ZOOM))
-     _zoom_with_wheel_test(data, event_info, event_type, ELM_GESTURE_ZOOM);
+     PROFILED_TEST(ELM_GESTURE_ZOOM,
+                   _zoom_with_wheel_test(data, event_info, event_type,
+                                         ELM_GESTURE_ZOOM));
 
    if (_elm_config->glayer_rotate_finger_enable && IS_TESTED(ELM_GESTURE_ROTATE))
-     _rotate_test(data, pe, event_info, event_type, ELM_GESTURE_ROTATE);
+     PROFILED_TEST(ELM_GESTURE_ROTATE,
+                   _rotate_test(data, pe, event_info, event_type,
+                                ELM_GESTURE_ROTATE));
 
    if (_get_event_flag(event_info, event_type) & EVAS_EVENT_FLAG_ON_HOLD)
      _event_history_add(data, event_info, event_type);
@@ -3488,6 +3594,159 @@ elm_gesture_layer_attach(Evas_Object *obj, Evas_Object *target)
    return EINA_TRUE;
 }
 
+EAPI void
+elm_gesture_layer_profile_enabled_set(Evas_Object *obj, Eina_Bool enabled)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+
+   wd->profile = !!enabled;
+}
+
+EAPI Eina_Bool
+elm_gesture_layer_profile_enabled_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) EINA_FALSE;
+
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return EINA_FALSE;
+
+   return wd->profile;
+}
+
+EAPI Eina_Bool
+elm_gesture_layer_profile_get(const Evas_Object *obj, Elm_Gesture_Type idx,
+      Elm_Gesture_Profile_Info *info)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) EINA_FALSE;
+
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if ((!wd) || (!info)) return EINA_FALSE;
+   if ((idx <= ELM_GESTURE_FIRST) || (idx >= ELM_GESTURE_LAST))
+     return EINA_FALSE;
+
+   if (!wd->gesture[idx])
+     {
+        memset(info, 0, sizeof(Elm_Gesture_Profile_Info));
+        return EINA_FALSE;
+     }
+
+   *info = wd->gesture[idx]->prof;
+   return EINA_TRUE;
+}
+
+EAPI void
+elm_gesture_layer_profile_reset(Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+
+   int i;
+   for (i = ELM_GESTURE_FIRST; i < ELM_GESTURE_LAST; i++)
+     if (wd->gesture[i])
+       memset(&wd->gesture[i]->prof, 0, sizeof(Elm_Gesture_Profile_Info));
+}
+
+/**
+ * @internal
+ *
+ * Feeds one recorded pointer event to canvas.
+ * Device 0 is fed as mouse event, any other device as multi event.
+ *
+ * @ingroup Elm_Gesture_Layer
+ */
+static Eina_Bool
+_replay_event_feed(Evas *e, const char *type, int device,
+      Evas_Coord x, Evas_Coord y, unsigned int timestamp)
+{
+   if (device == ELM_MOUSE_DEVICE)
+     {
+        if (!strcmp(type, "down"))
+          {
+             evas_event_feed_mouse_move(e, x, y, timestamp, NULL);
+             evas_event_feed_mouse_down(e, 1, EVAS_BUTTON_NONE, timestamp,
+                                        NULL);
+          }
+        else if (!strcmp(type, "move"))
+          evas_event_feed_mouse_move(e, x, y, timestamp, NULL);
+        else if (!strcmp(type, "up"))
+          {
+             evas_event_feed_mouse_move(e, x, y, timestamp, NULL);
+             evas_event_feed_mouse_up(e, 1, EVAS_BUTTON_NONE, timestamp,
+                                      NULL);
+          }
+        else
+          return EINA_FALSE;
+     }
+   else
+     {
+        if (!strcmp(type, "down"))
+          evas_event_feed_multi_down(e, device, x, y, 0, 0, 0, 0, 0, x, y,
+                                     EVAS_BUTTON_NONE, timestamp, NULL);
+        else if (!strcmp(type, "move"))
+          evas_event_feed_multi_move(e, device, x, y, 0, 0, 0, 0, 0, x, y,
+                                     timestamp, NULL);
+        else if (!strcmp(type, "up"))
+          evas_event_feed_multi_up(e, device, x, y, 0, 0, 0, 0, 0, x, y,
+                                   EVAS_BUTTON_NONE, timestamp, NULL);
+        else
+          return EINA_FALSE;
+     }
+
+   return EINA_TRUE;
+}
+
+EAPI Eina_Bool
+elm_gesture_layer_replay_file(Evas_Object *obj, const char *file)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) EINA_FALSE;
+
+   Widget_Data *wd = elm_widget_data_get(obj);
+   Evas_Coord ox, oy;
+   Eina_Bool ret = EINA_TRUE;
+   unsigned int line = 0;
+   char buf[256];
+   Evas *e;
+   FILE *f;
+
+   if ((!wd) || (!wd->target) || (!file)) return EINA_FALSE;
+
+   f = fopen(file, "r");
+   if (!f)
+     {
+        ERR("Could not open gesture recording '%s'", file);
+        return EINA_FALSE;
+     }
+
+   e = evas_object_evas_get(wd->target);
+   evas_object_geometry_get(wd->target, &ox, &oy, NULL, NULL);
+   while (fgets(buf, sizeof(buf), f))
+     {
+        unsigned int timestamp;
+        int device, x, y;
+        char type[16];
+
+        line++;
+        if ((buf[0] == '#') || (buf[0] == '\n')) continue;
+
+        if ((sscanf(buf, "%u %15s %d %d %d",
+                    &timestamp, type, &device, &x, &y) != 5) ||
+            (!_replay_event_feed(e, type, device, ox + x, oy + y, timestamp)))
+          {
+             ERR("Bad event in gesture recording '%s' line %u", file, line);
+             ret = EINA_FALSE;
+             break;
+          }
+     }
+
+   fclose(f);
+   return ret;
+}
+
 EAPI void
 elm_gesture_layer_cb_set(Evas_Object *obj, Elm_Gesture_Type idx,
       Elm_Gesture_State cb_type, Elm_Gesture_Event_Cb cb, void *data)
@@ -3548,6 +3807,7 @@ elm_gesture_layer_add(Evas_Object *parent)
    wd->long_tap_start_timeout = _elm_config->glayer_long_tap_start_timeout;
    wd->repeat_events = EINA_TRUE;
    wd->glayer_continues_enable = _elm_config->glayer_continues_enable;
+   _event_history_reserve(wd);
 
 #if defined(DEBUG_GESTURE_LAYER)
    printf("size of Gestures = <%d>\n", sizeof(wd->gesture));
@@ -211,6 +211,23 @@ struct _Elm_Gesture_Rotate_Info
  */
 typedef struct _Elm_Gesture_Rotate_Info Elm_Gesture_Rotate_Info;
 
+/**
+ * @struct _Elm_Gesture_Profile_Info
+ * Struct holds recognizer profiling info for one gesture
+ */
+struct _Elm_Gesture_Profile_Info
+{
+   double       time; /**< Total time (seconds) spent testing input, only counted while profiling is enabled */
+   unsigned int calls; /**< Number of input events tested, only counted while profiling is enabled */
+   unsigned int transitions[ELM_GESTURE_STATE_ABORT + 1]; /**< Number of times gesture switched to each state, indexed by @ref Elm_Gesture_State */
+};
+
+/**
+ * @typedef Elm_Gesture_Profile_Info
+ * Holds recognizer profiling info for user
+ */
+typedef struct _Elm_Gesture_Profile_Info Elm_Gesture_Profile_Info;
+
 /**
  * @typedef Elm_Gesture_Event_Cb
  * User callback used to stream gesture info from gesture layer
@@ -316,6 +333,76 @@ EAPI double       elm_gesture_layer_rotate_step_get(const Evas_Object *obj);
  */
 EAPI Eina_Bool    elm_gesture_layer_attach(Evas_Object *obj, Evas_Object *target);
 
+/**
+ * This function enables time measurement of gesture recognizers.
+ * When enabled, time spent testing each input event is accumulated
+ * per gesture, see elm_gesture_layer_profile_get().
+ * State transitions are counted regardless of this setting.
+ *
+ * @param obj gesture-layer.
+ * @param enabled If @c EINA_TRUE, recognizers are timed.
+ *
+ * @see elm_gesture_layer_profile_enabled_get()
+ */
+EAPI void         elm_gesture_layer_profile_enabled_set(Evas_Object *obj, Eina_Bool enabled);
+
+/**
+ * This function returns whether recognizers are timed.
+ *
+ * @param obj gesture-layer.
+ * @return @c EINA_TRUE if recognizers are timed.
+ *
+ * @see elm_gesture_layer_profile_enabled_set()
+ */
+EAPI Eina_Bool    elm_gesture_layer_profile_enabled_get(const Evas_Object *obj);
+
+/**
+ * This function gets profiling info of a gesture.
+ * Time spent testing single, double and triple taps is done in
+ * one pass and is accounted to the first of them that has callbacks set.
+ *
+ * @param obj gesture-layer.
+ * @param idx The gesture you would like to get profiling info for.
+ * @param info Where to store the info.
+ * @return TRUE, FALSE on success, failure (no callbacks set for gesture).
+ *
+ * @see elm_gesture_layer_profile_reset()
+ */
+EAPI Eina_Bool    elm_gesture_layer_profile_get(const Evas_Object *obj, Elm_Gesture_Type idx, Elm_Gesture_Profile_Info *info);
+
+/**
+ * This function clears profiling info of all gestures.
+ *
+ * @param obj gesture-layer.
+ */
+EAPI void         elm_gesture_layer_profile_reset(Evas_Object *obj);
+
+/**
+ * This function replays a recording of pointer events to the target
+ * of gesture-layer. Events are fed to the canvas, so this works on any
+ * engine, including buffer engine with no display.
+ *
+ * Recording is a text file, one event per line:
+ * @code
+ * # timestamp(ms) event device x y
+ * 1000 down 0 10 10
+ * 1016 move 0 12 10
+ * 1032 up 0 12 10
+ * @endcode
+ * Event is one of @c down, @c move or @c up. Device 0 is fed as mouse,
+ * other devices as multi events. Coordinates are relative to target
+ * top-left corner. Lines starting with # are ignored.
+ * Events are fed synchronously, so timer driven gestures (long-tap,
+ * tap timeouts) are only reported once main loop runs.
+ *
+ * @param obj gesture-layer.
+ * @param file Path of the recording.
+ * @return TRUE, FALSE on success, failure (no target or bad recording).
+ *
+ * @see elm_gesture_layer_profile_enabled_set()
+ */
+EAPI Eina_Bool    elm_gesture_layer_replay_file(Evas_Object *obj, const char *file);
+
 /**
  * Call this function to construct a new gesture-layer object.
  * This does not activate the gesture layer. You have to
@@ -6,6 +6,17 @@
 #ifdef ELM_EFREET
 #define NON_EXISTING (void *)-1
 static const char *icon_theme = NULL;
+
+/* Process wide cache of freedesktop lookups,
+ * "theme/size/name" -> path (stringshare, "" for icons not found) */
+static Eina_Hash *_icon_fdo_cache = NULL;
+static Ecore_Event_Handler *_icon_fdo_cache_handler = NULL;
+static unsigned long long _icon_fdo_cache_stamp = 0;
+static Eina_Bool _icon_fdo_cache_dirty = EINA_FALSE;
+/* icon_index_enable when the cache was created, the config is gone by
+ * the time _elm_icon_shutdown() saves the index */
+static Eina_Bool _icon_fdo_index_enable = EINA_FALSE;
+#define ICON_FDO_INDEX_STAMP_KEY "/stamp"
 #endif
 
 typedef struct _Widget_Data Widget_Data;
@@ -104,6 +115,172 @@ _icon_size_min_get(Evas_Object *icon)
    return (size < 16) ? 16 : size;
 }
 
+#ifdef ELM_EFREET
+static void
+_icon_fdo_index_path_get(char *buf, size_t size)
+{
+   const char *home;
+
+   home = getenv("HOME");
+   if (!home) home = "/";
+   snprintf(buf, size, "%s/"ELEMENTARY_BASE_DIR"/icon_index.eet", home);
+}
+
+/* Accumulates mtimes of all directories of a theme and of the themes it
+ * inherits, adding or removing an icon file changes at least one of them */
+static void
+_icon_fdo_theme_stamp_add(const char *name, unsigned long long *stamp, int depth)
+{
+   Efreet_Icon_Theme *theme;
+   Efreet_Icon_Theme_Directory *dir;
+   const char *path, *inherit;
+   Eina_List *l, *ll;
+   char buf[PATH_MAX];
+
+   if ((!name) || (depth > 8)) return;
+   theme = efreet_icon_theme_find(name);
+   if (!theme) return;
+
+   EINA_LIST_FOREACH(theme->paths, l, path)
+     {
+        *stamp = (*stamp * 31) + ecore_file_mod_time(path);
+        EINA_LIST_FOREACH(theme->directories, ll, dir)
+          {
+             snprintf(buf, sizeof(buf), "%s/%s", path, dir->name);
+             *stamp = (*stamp * 31) + ecore_file_mod_time(buf);
+          }
+     }
+   EINA_LIST_FOREACH(theme->inherits, l, inherit)
+     _icon_fdo_theme_stamp_add(inherit, stamp, depth + 1);
+}
+
+static Eina_Bool
+_icon_fdo_cache_update_cb(void *data __UNUSED__, int type __UNUSED__, void *event __UNUSED__)
+{
+   /* efreet rescanned icon directories, forget what we found so far */
+   if (_icon_fdo_cache) eina_hash_free_buckets(_icon_fdo_cache);
+   _icon_fdo_cache_dirty = EINA_TRUE;
+   return ECORE_CALLBACK_PASS_ON;
+}
+
+static void
+_icon_fdo_cache_init(void)
+{
+   char buf[PATH_MAX], stamp[PATH_MAX];
+   char **keys;
+   Eet_File *ef;
+   char *data;
+   int i, num, size;
+
+   _icon_fdo_cache =
+     eina_hash_string_superfast_new(EINA_FREE_CB(eina_stringshare_del));
+   _icon_fdo_cache_handler =
+     ecore_event_handler_add(EFREET_EVENT_ICON_CACHE_UPDATE,
+                             _icon_fdo_cache_update_cb, NULL);
+   _icon_fdo_index_enable = _elm_config->icon_index_enable;
+   if (!_icon_fdo_index_enable) return;
+
+   _icon_fdo_cache_stamp = 0;
+   _icon_fdo_theme_stamp_add(icon_theme, &_icon_fdo_cache_stamp, 0);
+   if (strcmp(icon_theme, "hicolor"))
+     _icon_fdo_theme_stamp_add("hicolor", &_icon_fdo_cache_stamp, 0);
+
+   _icon_fdo_index_path_get(buf, sizeof(buf));
+   ef = eet_open(buf, EET_FILE_MODE_READ);
+   if (!ef) return;
+
+   /* index is only valid for the same theme with unchanged directories */
+   snprintf(stamp, sizeof(stamp), "%s %llu", icon_theme, _icon_fdo_cache_stamp);
+   data = eet_read(ef, ICON_FDO_INDEX_STAMP_KEY, &size);
+   if ((!data) || (size != (int)strlen(stamp) + 1) || (strcmp(data, stamp)))
+     {
+        free(data);
+        eet_close(ef);
+        _icon_fdo_cache_dirty = EINA_TRUE;
+        return;
+     }
+   free(data);
+
+   keys = eet_list(ef, "*", &num);
+   for (i = 0; i < num; i++)
+     {
+        if (keys[i][0] == '/') continue;
+        data = eet_read(ef, keys[i], &size);
+        if ((data) && (size > 0) && (!data[size - 1]))
+          eina_hash_add(_icon_fdo_cache, keys[i], eina_stringshare_add(data));
+        free(data);
+     }
+   free(keys);
+   eet_close(ef);
+}
+
+static Eina_Bool
+_icon_fdo_index_write_cb(const Eina_Hash *hash __UNUSED__, const void *key, void *data, void *fdata)
+{
+   eet_write(fdata, key, data, strlen(data) + 1, 0);
+   return EINA_TRUE;
+}
+
+static void
+_icon_fdo_index_save(void)
+{
+   char buf[PATH_MAX], stamp[PATH_MAX];
+   Eet_File *ef;
+   char *dir;
+
+   _icon_fdo_index_path_get(buf, sizeof(buf));
+   dir = ecore_file_dir_get(buf);
+   if (dir)
+     {
+        ecore_file_mkpath(dir);
+        free(dir);
+     }
+   ef = eet_open(buf, EET_FILE_MODE_WRITE);
+   if (!ef)
+     {
+        ERR("Could not write icon index %s", buf);
+        return;
+     }
+   snprintf(stamp, sizeof(stamp), "%s %llu", icon_theme, _icon_fdo_cache_stamp);
+   eet_write(ef, ICON_FDO_INDEX_STAMP_KEY, stamp, strlen(stamp) + 1, 0);
+   eina_hash_foreach(_icon_fdo_cache, _icon_fdo_index_write_cb, ef);
+   eet_close(ef);
+}
+
+static const char *
+_icon_fdo_path_find(const char *name, int size)
+{
+   char key[PATH_MAX];
+   const char *path;
+
+   if (!_icon_fdo_cache) _icon_fdo_cache_init();
+
+   snprintf(key, sizeof(key), "%s/%d/%s", icon_theme, size, name);
+   path = eina_hash_find(_icon_fdo_cache, key);
+   if (path) return (*path) ? path : NULL;
+
+   path = efreet_icon_path_find(icon_theme, name, size);
+   eina_hash_add(_icon_fdo_cache, key, eina_stringshare_add(path ? path : ""));
+   _icon_fdo_cache_dirty = EINA_TRUE;
+   return path;
+}
+#endif
+
+void
+_elm_icon_shutdown(void)
+{
+#ifdef ELM_EFREET
+   if (!_icon_fdo_cache) return;
+   if ((_icon_fdo_cache_dirty) && (_icon_fdo_index_enable))
+     _icon_fdo_index_save();
+   eina_hash_free(_icon_fdo_cache);
+   _icon_fdo_cache = NULL;
+   ecore_event_handler_del(_icon_fdo_cache_handler);
+   _icon_fdo_cache_handler = NULL;
+   _icon_fdo_cache_dirty = EINA_FALSE;
+#endif
+}
+
 #ifdef HAVE_ELEMENTARY_ETHUMB
 static void
 _icon_thumb_stop(Widget_Data *wd, void *ethumbd)
@@ -474,6 +651,7 @@ _icon_freedesktop_set(Widget_Data *wd __UNUSED__, Evas_Object *obj __UNUSED__, c
 
    elm_need_efreet();
    if (icon_theme == NON_EXISTING) return EINA_FALSE;
+
    if (!icon_theme)
      {
         Efreet_Icon_Theme *theme;
@@ -500,7 +678,7 @@ _icon_freedesktop_set(Widget_Data *wd __UNUSED__, Evas_Object *obj __UNUSED__, c
         else
           icon_theme = eina_stringshare_add(theme->name.internal);
      }
-   path = efreet_icon_path_find(icon_theme, name, size);
+   path = _icon_fdo_path_find(name, size);
    wd->freedesktop.use = !!path;
    if (wd->freedesktop.use)
      {
@@ -572,9 +750,17 @@ _elm_icon_standard_resize(void *data,
                           void *event_info __UNUSED__)
 {
    Widget_Data *wd = data;
-   const char *refup = eina_stringshare_ref(wd->stdicon);
+   const char *refup;
    Eina_Bool fdo = EINA_FALSE;
 
+#ifdef ELM_EFREET
+   /* Still at the size the current file was looked up for */
+   if ((wd->freedesktop.use) &&
+       (wd->freedesktop.requested_size == _icon_size_min_get(wd->img)))
+     return;
+#endif
+
+   refup = eina_stringshare_ref(wd->stdicon);
    if (!_elm_icon_standard_set(wd, obj, wd->stdicon, &fdo) || (!fdo))
      evas_object_event_callback_del_full(obj, EVAS_CALLBACK_RESIZE,
                                          _elm_icon_standard_resize, wd);
@@ -236,11 +236,27 @@ _item_find(Evas_Object *obj, const void *data)
    return NULL;
 }
 
+/* the view may go back to the item pool, leave it as
+ * _index_box_auto_fill() found it */
+static void
+_item_view_release(Elm_Index_Item *it)
+{
+   Evas_Object *box;
+
+   if (!VIEW(it)) return;
+   if (it->selected)
+     edje_object_signal_emit(VIEW(it), "elm,state,inactive", "elm");
+   box = evas_object_smart_parent_get(VIEW(it));
+   if (box) evas_object_box_remove(box, VIEW(it));
+   elm_widget_item_view_release(it);
+}
+
 static void
 _item_free(Elm_Index_Item *it)
 {
    Widget_Data *wd = elm_widget_data_get(WIDGET(it));
    if (!wd) return;
+   _item_view_release(it);
    wd->items = eina_list_remove(wd->items, it);
    if (it->letter) eina_stringshare_del(it->letter);
 }
@@ -250,14 +266,12 @@ static void
 _index_box_auto_fill(Evas_Object *obj, Evas_Object *box, int level)
 {
    Widget_Data *wd = elm_widget_data_get(obj);
-   Eina_Bool rtl;
    Eina_List *l;
    Elm_Index_Item *it;
    Evas_Coord mw, mh, w, h;
    int i = 0;
    if (!wd) return;
    if (wd->level_active[level]) return;
-   rtl = elm_widget_mirrored_get(obj);
    evas_object_geometry_get(box, NULL, NULL, &w, &h);
    EINA_LIST_FOREACH(wd->items, l, it)
      {
@@ -269,27 +283,19 @@ _index_box_auto_fill(Evas_Object *obj, Evas_Object *box, int level)
 //FIXME: Need to check. This cause one less items show up.
 //        if(i > wd->max_supp_items_count) break;
 
-        o = edje_object_add(evas_object_evas_get(obj));
-        VIEW(it) = o;
-        edje_object_mirrored_set(VIEW(it), rtl);
-
         if (wd->horizontal)
           {
              if (i & 0x1)
-               _elm_theme_object_set(obj, o, "index", "item_odd/horizontal",
-                                     elm_widget_style_get(obj));
+               o = elm_widget_item_view_get(it, "index", "item_odd/horizontal");
              else
-               _elm_theme_object_set(obj, o, "index", "item/horizontal",
-                                     elm_widget_style_get(obj));
+               o = elm_widget_item_view_get(it, "index", "item/horizontal");
           }
         else
           {
              if (i & 0x1)
-               _elm_theme_object_set(obj, o, "index", "item_odd/vertical",
-                                     elm_widget_style_get(obj));
+               o = elm_widget_item_view_get(it, "index", "item_odd/vertical");
              else
-               _elm_theme_object_set(obj, o, "index", "item/vertical",
-                                     elm_widget_style_get(obj));
+               o = elm_widget_item_view_get(it, "index", "item/vertical");
           }
 
         edje_object_part_text_escaped_set(o, "elm.text", it->letter);
@@ -332,10 +338,8 @@ _index_box_clear(Evas_Object *obj, Evas_Object *box __UNUSED__, int level)
    if (!wd->level_active[level]) return;
    EINA_LIST_FOREACH(wd->items, l, it)
      {
-        if (!VIEW(it)) continue;
         if (it->level != level) continue;
-        evas_object_del(VIEW(it));
-        VIEW(it) = NULL;
+        _item_view_release(it);
      }
    wd->level_active[level] = 0;
 }
@@ -184,9 +184,12 @@ static void
 _sizing_eval(Widget_Data *wd)
 {
    Evas_Coord minw = -1, minh = -1;
+   ELM_PERF_SPAN_BEGIN(t0);
    edje_object_size_min_calc(wd->lay, &minw, &minh);
    evas_object_size_hint_min_set(wd->obj, minw, minh);
    evas_object_size_hint_max_set(wd->obj, -1, -1);
+   ELM_PERF_SPAN_END(t0, elm_widget_type_get(wd->obj),
+                     ELM_PERF_SITE_SIZING_EVAL);
 }
 
 static void
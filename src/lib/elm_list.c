@@ -113,6 +113,8 @@ if (((Elm_List_Item *)it)->deleted)                                     \
 static inline void
 _elm_list_item_free(Elm_List_Item *it)
 {
+   Evas_Object *box;
+
    evas_object_event_callback_del_full
       (VIEW(it), EVAS_CALLBACK_MOUSE_DOWN, _mouse_down, it);
    evas_object_event_callback_del_full
@@ -138,6 +140,15 @@ _elm_list_item_free(Elm_List_Item *it)
    it->long_timer = NULL;
    if (it->icon) evas_object_del(it->icon);
    if (it->end) evas_object_del(it->end);
+
+   /* the view may go back to the item pool, leave it as _item_new() found
+    * it */
+   if ((it->selected) || (it->highlighted))
+     edje_object_signal_emit(VIEW(it), "elm,state,unselected", "elm");
+   if (it->base.disabled)
+     edje_object_signal_emit(VIEW(it), "elm,state,enabled", "elm");
+   box = evas_object_smart_parent_get(VIEW(it));
+   if (box) evas_object_box_remove(box, VIEW(it));
 }
 
 static Eina_Bool
@@ -1179,6 +1190,21 @@ _item_del_pre_hook(Elm_Object_Item *it)
    return EINA_TRUE;
 }
 
+/* the theme group of the item at @p idx, see _fix_items() */
+static const char *
+_item_group_get(const Widget_Data *wd, int idx)
+{
+   if (wd->mode == ELM_LIST_COMPRESS)
+     {
+        if (idx & 0x1)
+          return wd->h_mode ? "h_item_compress" : "item_compress";
+        return wd->h_mode ? "h_item_compress_odd" : "item_compress_odd";
+     }
+   if (idx & 0x1)
+     return wd->h_mode ? "h_item" : "item";
+   return wd->h_mode ? "h_item_odd" : "item_odd";
+}
+
 static Elm_List_Item *
 _item_new(Evas_Object *obj, const char *label, Evas_Object *icon, Evas_Object *end, Evas_Smart_Cb func, const void *data)
 {
@@ -1193,8 +1219,9 @@ _item_new(Evas_Object *obj, const char *label, Evas_Object *icon, Evas_Object *e
    it->end = end;
    it->func = func;
    it->base.data = data;
-   VIEW(it) = edje_object_add(evas_object_evas_get(obj));
-   edje_object_mirrored_set(VIEW(it), elm_widget_mirrored_get(obj));
+   /* themed as if appended, _fix_items() fixes the others */
+   elm_widget_item_view_get(it, "list",
+                            _item_group_get(wd, eina_list_count(wd->items)));
    evas_object_event_callback_add(VIEW(it), EVAS_CALLBACK_MOUSE_DOWN,
                                   _mouse_down, it);
    evas_object_event_callback_add(VIEW(it), EVAS_CALLBACK_MOUSE_UP,
@@ -1269,10 +1296,6 @@ _fix_items(Evas_Object *obj)
    Evas_Coord mw, mh;
    int i, redo = 0;
    const char *style = elm_widget_style_get(obj);
-   const char *it_plain = wd->h_mode ? "h_item" : "item";
-   const char *it_odd = wd->h_mode ? "h_item_odd" : "item_odd";
-   const char *it_compress = wd->h_mode ? "h_item_compress" : "item_compress";
-   const char *it_compress_odd = wd->h_mode ? "h_item_compress_odd" : "item_compress_odd";
 
    if (wd->walking)
      {
@@ -1325,24 +1348,9 @@ _fix_items(Evas_Object *obj)
                _elm_theme_object_set(obj, VIEW(it), "separator",
                                      wd->h_mode ? "horizontal" : "vertical",
                                      style);
-             else if (wd->mode == ELM_LIST_COMPRESS)
-               {
-                  if (it->even)
-                    _elm_theme_object_set(obj, VIEW(it), "list",
-                                          it_compress, style);
-                  else
-                    _elm_theme_object_set(obj, VIEW(it), "list",
-                                          it_compress_odd, style);
-               }
              else
-               {
-                  if (it->even)
-                    _elm_theme_object_set(obj, VIEW(it), "list", it_plain,
-                                          style);
-                  else
-                    _elm_theme_object_set(obj, VIEW(it), "list", it_odd,
-                                          style);
-               }
+               _elm_theme_object_set(obj, VIEW(it), "list",
+                                     _item_group_get(wd, i), style);
              stacking = edje_object_data_get(VIEW(it), "stacking");
              if (stacking)
                {
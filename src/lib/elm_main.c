@@ -179,6 +179,7 @@ elm_init(int    argc,
    elm_quicklaunch_init(argc, argv);
    elm_quicklaunch_sub_init(argc, argv);
    _prefix_shutdown();
+   _elm_perf_init();
    return _elm_init_count;
 }
 
@@ -187,8 +188,11 @@ elm_shutdown(void)
 {
    _elm_init_count--;
    if (_elm_init_count > 0) return _elm_init_count;
+   _elm_widget_theme_job_shutdown();
    _elm_win_shutdown();
    while (_elm_win_deferred_free) ecore_main_loop_iterate();
+   _elm_widget_item_pool_shutdown();
+   _elm_perf_shutdown();
 // wrningz :(
 //   _prefix_shutdown();
    elm_quicklaunch_sub_shutdown();
@@ -509,6 +513,7 @@ elm_quicklaunch_shutdown(void)
    _elm_exit_handler = NULL;
 
    _elm_theme_shutdown();
+   _elm_icon_shutdown();
    _elm_unneed_efreet();
    _elm_unneed_e_dbus();
    _elm_unneed_ethumb();
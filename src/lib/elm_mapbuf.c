@@ -6,9 +6,15 @@ typedef struct _Widget_Data Widget_Data;
 struct _Widget_Data
 {
    Evas_Object *content, *clip;
+   Evas_Object *cache, *cache_clip;
+   unsigned int reused, rendered;
    Eina_Bool enabled : 1;
    Eina_Bool alpha : 1;
    Eina_Bool smooth : 1;
+   Eina_Bool cached : 1;
+   Eina_Bool cache_valid : 1;
+   Eina_Bool cache_drawn : 1; // cache changed since it was last drawn
+   Eina_Bool cache_rendered : 1; // and its source was set again for it
 };
 
 static const char *widtype = NULL;
@@ -17,12 +23,18 @@ static void _theme_hook(Evas_Object *obj);
 static void _sizing_eval(Evas_Object *obj);
 static void _changed_size_hints(void *data, Evas *e, Evas_Object *obj, void *event_info);
 static void _sub_del(void *data, Evas_Object *obj, void *event_info);
+static void _configure(Evas_Object *obj);
+static void _render_flush_post(void *data, Evas *e, void *event_info);
 
 static void
 _del_hook(Evas_Object *obj)
 {
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
+   if (wd->cache)
+     evas_event_callback_del_full(evas_object_evas_get(obj),
+                                  EVAS_CALLBACK_RENDER_FLUSH_POST,
+                                  _render_flush_post, obj);
    free(wd);
 }
 
@@ -50,14 +62,120 @@ _sizing_eval(Evas_Object *obj)
    evas_object_size_hint_max_set(obj, maxw, maxh);
 }
 
+static void
+_cache_invalidate(Widget_Data *wd)
+{
+   wd->cache_valid = EINA_FALSE;
+}
+
 static void
 _changed_size_hints(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
 {
    Widget_Data *wd = elm_widget_data_get(data);
    if (!wd) return;
+   _cache_invalidate(wd);
    _sizing_eval(data);
 }
 
+static void
+_content_resize(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Widget_Data *wd = elm_widget_data_get(data);
+   if (!wd) return;
+   _cache_invalidate(wd);
+}
+
+static void
+_content_changed(void *data, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Widget_Data *wd = elm_widget_data_get(data);
+   if (!wd) return;
+   _cache_invalidate(wd);
+}
+
+// counts the frames that drew the cached buffer, see _mapbuf(). evas
+// only renders the proxy, and its source into it, when it is on screen,
+// so the changes made while it is not wait for the frame that draws it
+static void
+_render_flush_post(void *data, Evas *e, void *event_info __UNUSED__)
+{
+   Widget_Data *wd = elm_widget_data_get(data);
+   Evas_Coord x, y, w, h, vx, vy, vw, vh;
+
+   if ((!wd) || (!wd->cache_drawn)) return;
+   if ((!evas_object_visible_get(data)) ||
+       (!evas_object_visible_get(wd->content)))
+     return;
+   evas_object_geometry_get(wd->cache, &x, &y, &w, &h);
+   evas_output_viewport_get(e, &vx, &vy, &vw, &vh);
+   if ((w <= 0) || (h <= 0) ||
+       (!ELM_RECTS_INTERSECT(x, y, w, h, vx, vy, vw, vh)))
+     return;
+   if (wd->cache_rendered) wd->rendered++;
+   else wd->reused++;
+   wd->cache_drawn = EINA_FALSE;
+   wd->cache_rendered = EINA_FALSE;
+}
+
+static void
+_content_callbacks_del(Evas_Object *obj, Evas_Object *content)
+{
+   evas_object_event_callback_del_full(content, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                       _changed_size_hints, obj);
+   evas_object_event_callback_del_full(content, EVAS_CALLBACK_RESIZE,
+                                       _content_resize, obj);
+   evas_object_smart_callback_del(content, "changed", _content_changed);
+}
+
+static void
+_cache_update(Evas_Object *obj)
+{
+   Widget_Data *wd = elm_widget_data_get(obj);
+   Evas *e;
+   if (!wd) return;
+   if ((wd->cached) && (wd->content))
+     {
+        // the content renders into the proxy image only, it is hidden
+        // behind a transparent clipper and left where it is on moves
+        if (!wd->cache)
+          {
+             e = evas_object_evas_get(obj);
+             wd->cache_clip = evas_object_rectangle_add(e);
+             evas_object_color_set(wd->cache_clip, 0, 0, 0, 0);
+             evas_object_pass_events_set(wd->cache_clip, EINA_TRUE);
+             evas_object_smart_member_add(wd->cache_clip, obj);
+             evas_object_show(wd->cache_clip);
+
+             wd->cache = evas_object_image_filled_add(e);
+             evas_object_pass_events_set(wd->cache, EINA_TRUE);
+             evas_object_smart_member_add(wd->cache, obj);
+             evas_object_clip_set(wd->cache, wd->clip);
+             evas_object_show(wd->cache);
+             evas_event_callback_add(e, EVAS_CALLBACK_RENDER_FLUSH_POST,
+                                     _render_flush_post, obj);
+          }
+        evas_object_image_source_set(wd->cache, wd->content);
+        evas_object_clip_set(wd->content, wd->cache_clip);
+        evas_object_map_set(wd->content, NULL);
+        evas_object_map_enable_set(wd->content, EINA_FALSE);
+        wd->cache_valid = EINA_FALSE;
+     }
+   else if (wd->cache)
+     {
+        if (wd->content) evas_object_clip_set(wd->content, wd->clip);
+        evas_event_callback_del_full(evas_object_evas_get(obj),
+                                     EVAS_CALLBACK_RENDER_FLUSH_POST,
+                                     _render_flush_post, obj);
+        evas_object_del(wd->cache);
+        evas_object_del(wd->cache_clip);
+        wd->cache = NULL;
+        wd->cache_clip = NULL;
+        wd->cache_valid = EINA_FALSE;
+        wd->cache_drawn = EINA_FALSE;
+        wd->cache_rendered = EINA_FALSE;
+     }
+}
+
 static void
 _sub_del(void *data __UNUSED__, Evas_Object *obj, void *event_info)
 {
@@ -66,9 +184,9 @@ _sub_del(void *data __UNUSED__, Evas_Object *obj, void *event_info)
    if (!wd) return;
    if (sub == wd->content)
      {
-        evas_object_event_callback_del_full(sub, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
-                                            _changed_size_hints, obj);
+        _content_callbacks_del(obj, sub);
         wd->content = NULL;
+        _cache_update(obj);
         _sizing_eval(obj);
      }
 }
@@ -81,23 +199,49 @@ _mapbuf(Evas_Object *obj)
    if (!wd) return;
    evas_object_geometry_get(wd->clip, &x, &y, &w, &h);
    evas_object_resize(wd->content, w, h);
+   if (wd->cache)
+     {
+        // counted once per frame that draws it, when it is flushed
+        wd->cache_drawn = EINA_TRUE;
+        if (!wd->cache_valid)
+          {
+             // make sure the proxy is redrawn even if evas did not see
+             // the content change (e.g. pixels written behind its back)
+             evas_object_image_source_set(wd->cache, NULL);
+             evas_object_image_source_set(wd->cache, wd->content);
+             wd->cache_valid = EINA_TRUE;
+             wd->cache_rendered = EINA_TRUE;
+          }
+        evas_object_image_smooth_scale_set(wd->cache, wd->smooth);
+        evas_object_move(wd->cache, x, y);
+        evas_object_resize(wd->cache, w, h);
+     }
    if (wd->enabled)
      {
+        Evas_Object *target = wd->cache ? wd->cache : wd->content;
         Evas_Map *m;
 
         m = evas_map_new(4);
         evas_map_util_points_populate_from_geometry(m, x, y, w, h, 0);
         evas_map_smooth_set(m, wd->smooth);
         evas_map_alpha_set(m, wd->alpha);
-        evas_object_map_set(wd->content, m);
-        evas_object_map_enable_set(wd->content, EINA_TRUE);
+        evas_object_map_set(target, m);
+        evas_object_map_enable_set(target, EINA_TRUE);
         evas_map_free(m);
      }
    else
      {
-        evas_object_map_set(wd->content, NULL);
-        evas_object_map_enable_set(wd->content, EINA_FALSE);
-        evas_object_move(wd->content, x, y);
+        if (wd->cache)
+          {
+             evas_object_map_set(wd->cache, NULL);
+             evas_object_map_enable_set(wd->cache, EINA_FALSE);
+          }
+        else
+          {
+             evas_object_map_set(wd->content, NULL);
+             evas_object_map_enable_set(wd->content, EINA_FALSE);
+             evas_object_move(wd->content, x, y);
+          }
      }
 }
 
@@ -112,7 +256,8 @@ _configure(Evas_Object *obj)
 
         evas_object_geometry_get(wd->clip, &x, &y, &w, &h);
         evas_object_geometry_get(wd->content, &x2, &y2, NULL, NULL);
-        if ((x != x2) || (y != y2))
+        // a cached content stays put, only its buffer follows
+        if ((!wd->cache) && ((x != x2) || (y != y2)))
           {
              if (!wd->enabled)
                evas_object_move(wd->content, x, y);
@@ -155,6 +300,7 @@ _content_set_hook(Evas_Object *obj, const char *part, Evas_Object *content)
    if (wd->content == content) return;
    if (wd->content) evas_object_del(wd->content);
    wd->content = content;
+   wd->cache_valid = EINA_FALSE;
    if (content)
      {
         evas_object_data_set(content, "_elm_leaveme", (void *)1);
@@ -165,9 +311,14 @@ _content_set_hook(Evas_Object *obj, const char *part, Evas_Object *content)
         evas_object_event_callback_add(content,
                                        EVAS_CALLBACK_CHANGED_SIZE_HINTS,
                                        _changed_size_hints, obj);
+        evas_object_event_callback_add(content, EVAS_CALLBACK_RESIZE,
+                                       _content_resize, obj);
+        evas_object_smart_callback_add(content, "changed",
+                                       _content_changed, obj);
      }
    else
      evas_object_color_set(wd->clip, 0, 0, 0, 0);
+   _cache_update(obj);
    _sizing_eval(obj);
    _configure(obj);
 }
@@ -196,6 +347,11 @@ _content_unset_hook(Evas_Object *obj, const char *part)
    if (!wd) return NULL;
    if (!wd->content) return NULL;
    content = wd->content;
+   if (wd->cache)
+     {
+        evas_object_map_set(content, NULL);
+        evas_object_map_enable_set(content, EINA_FALSE);
+     }
    elm_widget_sub_object_del(obj, content);
    evas_object_smart_member_del(content);
    evas_object_color_set(wd->clip, 0, 0, 0, 0);
@@ -302,3 +458,48 @@ elm_mapbuf_alpha_get(const Evas_Object *obj)
    if (!wd) return EINA_FALSE;
    return wd->alpha;
 }
+
+EAPI void
+elm_mapbuf_cached_set(Evas_Object *obj, Eina_Bool cached)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   cached = !!cached;
+   if (wd->cached == cached) return;
+   wd->cached = cached;
+   _cache_update(obj);
+   _configure(obj);
+}
+
+EAPI Eina_Bool
+elm_mapbuf_cached_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) EINA_FALSE;
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return EINA_FALSE;
+   return wd->cached;
+}
+
+EAPI void
+elm_mapbuf_cache_invalidate(Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (!wd->cache) return;
+   _cache_invalidate(wd);
+   _configure(obj);
+}
+
+EAPI void
+elm_mapbuf_cache_stats_get(const Evas_Object *obj, unsigned int *reused, unsigned int *rendered)
+{
+   if (reused) *reused = 0;
+   if (rendered) *rendered = 0;
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (reused) *reused = wd->reused;
+   if (rendered) *rendered = wd->rendered;
+}
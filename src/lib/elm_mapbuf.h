@@ -144,6 +144,81 @@ EAPI void                         elm_mapbuf_alpha_set(Evas_Object *obj, Eina_Bo
  */
 EAPI Eina_Bool                    elm_mapbuf_alpha_get(const Evas_Object *obj);
 
+/**
+ * Enable or disable the cached rendering of the mapbuf content.
+ *
+ * @param obj The mapbuf object.
+ * @param cached @c EINA_TRUE to render the content through a cached
+ * buffer or @c EINA_FALSE to render it directly.
+ *
+ * When cached, the content is rendered once into an image buffer, and
+ * this buffer is what is shown (and mapped, if the map is enabled).
+ * Moving the mapbuf only moves the buffer, so the content is not
+ * rendered again as long as it does not change. The buffer is
+ * invalidated when the content is resized, changes its size hints or
+ * emits "changed"; for other changes call elm_mapbuf_cache_invalidate().
+ *
+ * While cached, the content itself is not shown and doesn't get input,
+ * so this is meant for content that is static for a while, like a page
+ * being animated.
+ *
+ * Caching is disabled by default.
+ *
+ * @see elm_mapbuf_cache_invalidate()
+ * @see elm_mapbuf_cache_stats_get()
+ *
+ * @ingroup Mapbuf
+ */
+EAPI void                         elm_mapbuf_cached_set(Evas_Object *obj, Eina_Bool cached);
+
+/**
+ * Get a value whether the mapbuf content is rendered through a cache.
+ *
+ * @param obj The mapbuf object.
+ * @return @c EINA_TRUE means the content is cached. @c EINA_FALSE
+ * indicates it's rendered directly. If @p obj is @c NULL, @c EINA_FALSE
+ * is returned.
+ *
+ * @see elm_mapbuf_cached_set() for details.
+ *
+ * @ingroup Mapbuf
+ */
+EAPI Eina_Bool                    elm_mapbuf_cached_get(const Evas_Object *obj);
+
+/**
+ * Drop the cached buffer of the mapbuf content.
+ *
+ * @param obj The mapbuf object.
+ *
+ * The content is rendered into the buffer again. Use this after changing
+ * the content in a way the mapbuf can't notice, like writing the pixels
+ * of an image inside it. This does nothing if caching is disabled.
+ *
+ * @see elm_mapbuf_cached_set()
+ *
+ * @ingroup Mapbuf
+ */
+EAPI void                         elm_mapbuf_cache_invalidate(Evas_Object *obj);
+
+/**
+ * Get how often the cached buffer of the mapbuf was reused.
+ *
+ * @param obj The mapbuf object.
+ * @param reused Where to store the number of frames that drew the
+ * cached buffer without rendering the content again, or @c NULL.
+ * @param rendered Where to store the number of frames that had to
+ * render the content into the buffer again, or @c NULL.
+ *
+ * Only the frames that drew the mapbuf on the canvas after it was
+ * moved, resized, mapped or invalidated are counted. The counters run
+ * for the lifetime of the mapbuf.
+ *
+ * @see elm_mapbuf_cached_set()
+ *
+ * @ingroup Mapbuf
+ */
+EAPI void                         elm_mapbuf_cache_stats_get(const Evas_Object *obj, unsigned int *reused, unsigned int *rendered);
+
 /**
  * @}
  */
@@ -0,0 +1,272 @@
+#include <Elementary.h>
+#include "elm_priv.h"
+
+#ifdef HAVE_ELEMENTARY_PERF
+
+typedef struct _Perf_Type Perf_Type;
+typedef struct _Perf_Line Perf_Line;
+
+struct _Perf_Type
+{
+   const char      *name;
+   Elm_Perf_Counter counters[ELM_PERF_SITE_LAST];
+};
+
+struct _Perf_Line
+{
+   const Perf_Type *type;
+   Elm_Perf_Site    site;
+};
+
+Eina_Bool _elm_perf_enabled = EINA_FALSE;
+
+static Eina_Hash *types = NULL;
+static const char *dump_file = NULL;
+
+#endif
+
+static const char *site_names[ELM_PERF_SITE_LAST] =
+{
+   "theme", "theme_set", "sizing_eval", "item_realize", "item_unrealize",
+   "content_get", "queue_process", "signal_emit"
+};
+
+#ifdef HAVE_ELEMENTARY_PERF
+
+static void
+_type_free(void *data)
+{
+   Perf_Type *pt = data;
+
+   eina_stringshare_del(pt->name);
+   free(pt);
+}
+
+void
+_elm_perf_span_add(const char *type, Elm_Perf_Site site, double t)
+{
+   Elm_Perf_Counter *c;
+   Perf_Type *pt;
+
+   if (!type) type = "none";
+   if (!types) types = eina_hash_string_superfast_new(_type_free);
+   pt = eina_hash_find(types, type);
+   if (!pt)
+     {
+        pt = calloc(1, sizeof(Perf_Type));
+        if (!pt) return;
+        pt->name = eina_stringshare_add(type);
+        eina_hash_add(types, type, pt);
+     }
+   c = &(pt->counters[site]);
+   c->count++;
+   c->total += t;
+   if (t > c->max) c->max = t;
+}
+
+void
+_elm_perf_init(void)
+{
+   const char *s = getenv("ELM_PERF_DUMP");
+
+   if ((!s) || (!*s)) return;
+   eina_stringshare_replace(&dump_file, s);
+   _elm_perf_enabled = EINA_TRUE;
+}
+
+void
+_elm_perf_shutdown(void)
+{
+   if (dump_file)
+     {
+        elm_perf_dump(dump_file);
+        eina_stringshare_del(dump_file);
+        dump_file = NULL;
+     }
+   _elm_perf_enabled = EINA_FALSE;
+   elm_perf_reset();
+}
+
+static Eina_Bool
+_types_collect(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata)
+{
+   Eina_List **list = fdata;
+   Perf_Type *pt = data;
+
+   *list = eina_list_append(*list, pt);
+   return EINA_TRUE;
+}
+
+static int
+_line_cmp(const void *a, const void *b)
+{
+   const Perf_Line *la = a, *lb = b;
+   double ta = la->type->counters[la->site].total;
+   double tb = lb->type->counters[lb->site].total;
+
+   if (ta > tb) return -1;
+   if (ta < tb) return 1;
+   return 0;
+}
+
+EAPI Eina_Bool
+elm_perf_available_get(void)
+{
+   return EINA_TRUE;
+}
+
+EAPI void
+elm_perf_enabled_set(Eina_Bool enabled)
+{
+   _elm_perf_enabled = !!enabled;
+}
+
+EAPI Eina_Bool
+elm_perf_enabled_get(void)
+{
+   return _elm_perf_enabled;
+}
+
+EAPI void
+elm_perf_reset(void)
+{
+   if (!types) return;
+   eina_hash_free(types);
+   types = NULL;
+}
+
+EAPI Eina_List *
+elm_perf_types_get(void)
+{
+   Eina_List *list = NULL, *names = NULL;
+   Perf_Type *pt;
+
+   if (!types) return NULL;
+   eina_hash_foreach(types, _types_collect, &list);
+   EINA_LIST_FREE(list, pt)
+     names = eina_list_append(names, pt->name);
+   return names;
+}
+
+EAPI Eina_Bool
+elm_perf_counter_get(const char *type, Elm_Perf_Site site, Elm_Perf_Counter *counter)
+{
+   Perf_Type *pt = NULL;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(counter, EINA_FALSE);
+   memset(counter, 0, sizeof(Elm_Perf_Counter));
+   EINA_SAFETY_ON_NULL_RETURN_VAL(type, EINA_FALSE);
+   if ((unsigned int)site >= ELM_PERF_SITE_LAST) return EINA_FALSE;
+   if (types) pt = eina_hash_find(types, type);
+   if (!pt) return EINA_FALSE;
+   *counter = pt->counters[site];
+   return EINA_TRUE;
+}
+
+EAPI Eina_Bool
+elm_perf_dump(const char *file)
+{
+   Eina_List *list = NULL;
+   Perf_Line *lines;
+   Perf_Type *pt;
+   FILE *f = stdout;
+   int i, n = 0;
+
+   if (file)
+     {
+        f = fopen(file, "w");
+        if (!f) return EINA_FALSE;
+     }
+   if (types) eina_hash_foreach(types, _types_collect, &list);
+   lines = malloc(eina_list_count(list) * ELM_PERF_SITE_LAST * sizeof(Perf_Line) + 1);
+   EINA_LIST_FREE(list, pt)
+     {
+        for (i = 0; i < ELM_PERF_SITE_LAST; i++)
+          {
+             if ((!lines) || (!pt->counters[i].count)) continue;
+             lines[n].type = pt;
+             lines[n].site = i;
+             n++;
+          }
+     }
+   if (lines)
+     {
+        qsort(lines, n, sizeof(Perf_Line), _line_cmp);
+        for (i = 0; i < n; i++)
+          {
+             const Elm_Perf_Counter *c =
+                &(lines[i].type->counters[lines[i].site]);
+
+             fprintf(f, "%s\t%s\t%u\t%.3f\t%.4f\t%.3f\n",
+                     lines[i].type->name, site_names[lines[i].site],
+                     c->count, c->total * 1000.0,
+                     (c->total * 1000.0) / c->count, c->max * 1000.0);
+          }
+        free(lines);
+     }
+   if (f != stdout) fclose(f);
+   else fflush(f);
+   return EINA_TRUE;
+}
+
+#else
+
+void
+_elm_perf_init(void)
+{
+}
+
+void
+_elm_perf_shutdown(void)
+{
+}
+
+EAPI Eina_Bool
+elm_perf_available_get(void)
+{
+   return EINA_FALSE;
+}
+
+EAPI void
+elm_perf_enabled_set(Eina_Bool enabled __UNUSED__)
+{
+}
+
+EAPI Eina_Bool
+elm_perf_enabled_get(void)
+{
+   return EINA_FALSE;
+}
+
+EAPI void
+elm_perf_reset(void)
+{
+}
+
+EAPI Eina_List *
+elm_perf_types_get(void)
+{
+   return NULL;
+}
+
+EAPI Eina_Bool
+elm_perf_counter_get(const char *type __UNUSED__, Elm_Perf_Site site __UNUSED__, Elm_Perf_Counter *counter)
+{
+   if (counter) memset(counter, 0, sizeof(Elm_Perf_Counter));
+   return EINA_FALSE;
+}
+
+EAPI Eina_Bool
+elm_perf_dump(const char *file __UNUSED__)
+{
+   return EINA_FALSE;
+}
+
+#endif
+
+EAPI const char *
+elm_perf_site_name_get(Elm_Perf_Site site)
+{
+   if ((unsigned int)site >= ELM_PERF_SITE_LAST) return NULL;
+   return site_names[site];
+}
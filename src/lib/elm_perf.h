@@ -0,0 +1,139 @@
+/**
+ * @defgroup Perf Performance counters
+ * @ingroup Elementary
+ *
+ * Elementary can time a few of its hot paths: theme application, edje
+ * group loading, layout sizing, genlist and gengrid item realization and
+ * item content creation, the genlist item queue and signal emission.
+ * Every span is added to the counter of its site for the widget type it
+ * ran for, so a headless run can tell where the time goes without a
+ * profiler.
+ *
+ * The counters are only built with the @c --enable-perf-counters
+ * configure option, see elm_perf_available_get(). Even then they stay
+ * off until elm_perf_enabled_set() is called, or until Elementary is
+ * initialized with the @c ELM_PERF_DUMP environment variable set to a
+ * file, in which case the counters are written to that file on
+ * elm_shutdown().
+ *
+ * Spans nest: the time of a widget's theme application includes the
+ * groups it loads and the signals it emits.
+ */
+
+/**
+ * The instrumented code paths
+ *
+ * @ingroup Perf
+ */
+typedef enum
+{
+   ELM_PERF_SITE_THEME = 0, /**< theme hook of a widget, tooltips and cursors */
+   ELM_PERF_SITE_THEME_SET, /**< loading of a theme group in an edje object */
+   ELM_PERF_SITE_SIZING_EVAL, /**< size calculation of a layout */
+   ELM_PERF_SITE_ITEM_REALIZE, /**< genlist or gengrid item realization */
+   ELM_PERF_SITE_ITEM_UNREALIZE, /**< genlist or gengrid item unrealization */
+   ELM_PERF_SITE_CONTENT_GET, /**< item class content_get() calls */
+   ELM_PERF_SITE_QUEUE_PROCESS, /**< genlist item queue processing */
+   ELM_PERF_SITE_SIGNAL_EMIT, /**< signal emission on a widget */
+   ELM_PERF_SITE_LAST /**< sentinel, not a site */
+} Elm_Perf_Site;
+
+typedef struct _Elm_Perf_Counter Elm_Perf_Counter;
+
+/**
+ * A counter, for one site and one widget type
+ *
+ * @ingroup Perf
+ */
+struct _Elm_Perf_Counter
+{
+   unsigned int count; /**< number of spans */
+   double       total; /**< time spent, in seconds */
+   double       max; /**< longest span, in seconds */
+};
+
+/**
+ * Get whether the counters were built in.
+ *
+ * @return EINA_TRUE if Elementary was configured with
+ * @c --enable-perf-counters
+ *
+ * @ingroup Perf
+ */
+EAPI Eina_Bool         elm_perf_available_get(void);
+
+/**
+ * Start or stop counting.
+ *
+ * @param enabled EINA_TRUE to count, EINA_FALSE to stop
+ *
+ * Stopping keeps the counters, see elm_perf_reset().
+ *
+ * @ingroup Perf
+ */
+EAPI void              elm_perf_enabled_set(Eina_Bool enabled);
+
+/**
+ * Get whether the counters are counting.
+ *
+ * @return EINA_TRUE if they are
+ *
+ * @ingroup Perf
+ */
+EAPI Eina_Bool         elm_perf_enabled_get(void);
+
+/**
+ * Clear all the counters.
+ *
+ * @ingroup Perf
+ */
+EAPI void              elm_perf_reset(void);
+
+/**
+ * Get the widget types that have counters.
+ *
+ * @return A list of widget type names. Free the list with eina_list_free(),
+ * the names stay valid until elm_perf_reset() or elm_shutdown().
+ *
+ * The loading of theme groups is counted under the theme class of the
+ * group, which is the widget type for most widgets.
+ *
+ * @ingroup Perf
+ */
+EAPI Eina_List        *elm_perf_types_get(void);
+
+/**
+ * Get a counter.
+ *
+ * @param type The widget type, as in the list of elm_perf_types_get()
+ * @param site The code path
+ * @param counter Where to store the counter
+ * @return EINA_FALSE if nothing was counted for @p type, in which case
+ * @p counter is zeroed
+ *
+ * @ingroup Perf
+ */
+EAPI Eina_Bool         elm_perf_counter_get(const char *type, Elm_Perf_Site site, Elm_Perf_Counter *counter);
+
+/**
+ * Get the name of a site, as written by elm_perf_dump().
+ *
+ * @param site The code path
+ * @return Its name, or NULL for an invalid @p site
+ *
+ * @ingroup Perf
+ */
+EAPI const char       *elm_perf_site_name_get(Elm_Perf_Site site);
+
+/**
+ * Write all the counters to a file.
+ *
+ * @param file The file to write, or NULL for the standard output
+ * @return EINA_FALSE if the file can't be written
+ *
+ * One tab separated line per widget type and site, sorted by time spent:
+ * "<type> <site> <count> <total ms> <average ms> <max ms>".
+ *
+ * @ingroup Perf
+ */
+EAPI Eina_Bool         elm_perf_dump(const char *file);
@@ -67,7 +67,7 @@ struct _Elm_Theme
 /* increment this whenever a new set of config values are added but the users
  * config doesn't need to be wiped - simply new values need to be put in
  */
-#define ELM_CONFIG_FILE_GENERATION 0x0003
+#define ELM_CONFIG_FILE_GENERATION 0x0004
 #define ELM_CONFIG_VERSION         ((ELM_CONFIG_EPOCH << 16) | ELM_CONFIG_FILE_GENERATION)
 /* NB: profile configuration files (.src) must have their
  * "config_version" entry's value up-to-date with ELM_CONFIG_VERSION
@@ -126,6 +126,7 @@ struct _Elm_Config
    double        scroll_smooth_history_weight;
    double        scroll_smooth_future_time;
    double        scroll_smooth_time_window;
+   unsigned char scroll_smooth_enable;
    double        scale;
    int           bgpixmap;
    int           compositing;
@@ -173,6 +174,8 @@ struct _Elm_Config
    int           weekend_len;
    int           year_min;
    int           year_max;
+   unsigned char icon_index_enable;
+   int           gengrid_thumb_cache_size;
    Eina_List    *color_palette;
 
    /* Not part of the EET file */
@@ -217,6 +220,7 @@ Eina_Bool            _elm_theme_set(Elm_Theme *th, Evas_Object *o, const char *c
 Eina_Bool            _elm_theme_icon_set(Elm_Theme *th, Evas_Object *o, const char *group, const char *style);
 Eina_Bool            _elm_theme_parse(Elm_Theme *th, const char *theme);
 void                 _elm_theme_shutdown(void);
+void                 _elm_theme_job_done(void);
 
 void                 _elm_module_init(void);
 void                 _elm_module_shutdown(void);
@@ -232,8 +236,16 @@ void                 _elm_widget_type_clear(void);
 void                 _elm_widget_focus_region_show(const Evas_Object *obj);
 void                 _elm_widget_top_win_focused_set(Evas_Object *obj, Eina_Bool top_win_focused);
 Eina_Bool            _elm_widget_top_win_focused_get(const Evas_Object *obj);
+void                 _elm_widget_theme_job_add(Evas_Object *obj, Elm_Theme *th);
+void                 _elm_widget_cache_job_add(Evas_Object *obj);
+void                 _elm_widget_theme_job_finish(void);
+double               _elm_widget_theme_job_progress_get(void);
+void                 _elm_widget_theme_job_shutdown(void);
+void                 _elm_widget_item_pool_views_flush(void);
+void                 _elm_widget_item_pool_shutdown(void);
 
 void                 _elm_unneed_ethumb(void);
+void                 _elm_icon_shutdown(void);
 void                 _elm_unneed_web(void);
 
 void                 _elm_rescale(void);
@@ -247,6 +259,7 @@ Eina_Bool            _elm_config_save(void);
 void                 _elm_config_reload(void);
 
 void                 _elm_recache(void);
+void                 _elm_recache_win(Evas_Object *win);
 
 const char          *_elm_config_current_profile_get(void);
 const char          *_elm_config_profile_dir_get(const char *prof, Eina_Bool is_user);
@@ -318,4 +331,27 @@ void _elm_entry_entry_paste(Evas_Object *obj, const char *entry);
 
 double _elm_atof(const char *s);
 
+void                 _elm_perf_init(void);
+void                 _elm_perf_shutdown(void);
+
+/* Timed spans, see elm_perf.h. Built only with --enable-perf-counters:
+ *   ELM_PERF_SPAN_BEGIN(t0);
+ *   ...
+ *   ELM_PERF_SPAN_END(t0, elm_widget_type_get(obj), ELM_PERF_SITE_THEME);
+ */
+#ifdef HAVE_ELEMENTARY_PERF
+extern Eina_Bool _elm_perf_enabled;
+void _elm_perf_span_add(const char *type, Elm_Perf_Site site, double t);
+# define ELM_PERF_SPAN_BEGIN(span) \
+   double span = (EINA_UNLIKELY(_elm_perf_enabled)) ? ecore_time_get() : 0.0
+# define ELM_PERF_SPAN_END(span, type, site) \
+   do { \
+        if (span > 0.0) \
+          _elm_perf_span_add((type), (site), ecore_time_get() - span); \
+   } while (0)
+#else
+# define ELM_PERF_SPAN_BEGIN(span)
+# define ELM_PERF_SPAN_END(span, type, site) do { } while (0)
+#endif
+
 #endif
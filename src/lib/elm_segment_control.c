@@ -186,6 +186,14 @@ _item_free(Elm_Segment_Item *it)
 
    if (it->icon) evas_object_del(it->icon);
    if (it->label) eina_stringshare_del(it->label);
+
+   /* the view may go back to the item pool, _update_list() sets all its
+    * states again */
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_DOWN,
+                                       _mouse_down, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_UP,
+                                       _mouse_up, it);
+   evas_object_smart_member_del(VIEW(it));
 }
 
 static void
@@ -527,15 +535,9 @@ _item_new(Evas_Object *obj, Evas_Object *icon, const char *label)
    elm_widget_item_content_set_hook_set(it, _item_content_set_hook);
    elm_widget_item_content_get_hook_set(it, _item_content_get_hook);
 
-   VIEW(it) = edje_object_add(evas_object_evas_get(obj));
-   edje_object_scale_set(VIEW(it), elm_widget_scale_get(VIEW(it))
-                         *_elm_config->scale);
+   elm_widget_item_view_get(it, "segment_control", "item");
    evas_object_smart_member_add(VIEW(it), obj);
    elm_widget_sub_object_add(obj, VIEW(it));
-   _elm_theme_object_set(obj, VIEW(it), "segment_control", "item",
-                         elm_object_style_get(obj));
-   edje_object_mirrored_set(VIEW(it),
-                            elm_widget_mirrored_get(WIDGET(it)));
 
    if (label)
      eina_stringshare_replace(&it->label, label);
@@ -11,6 +11,11 @@ struct _Elm_Slideshow_Item
    Eina_List *l, *l_built;
 
    const Elm_Slideshow_Item_Class *itc;
+
+   Evas_Object *img; // image decoded ahead, found in VIEW(item)
+   size_t bytes; // decoded size, accounted in wd->built_bytes
+   unsigned int window; // last cache window it was in, see _item_realize()
+   Eina_Bool ready : 1; // nothing left to decode
 };
 
 struct _Widget_Data
@@ -31,6 +36,12 @@ struct _Widget_Data
    int count_item_pre_after;
    Ecore_Timer *timer;
    double timeout;
+   Elm_Slideshow_Item *waiting; // next slide the timer waits for
+   Elm_Slideshow_Item *realizing; // kept while its neighbours are built
+   unsigned int window; // current cache window
+   int window_max; // neighbours the cache size lets in the window, -1 for all
+   size_t built_bytes;
+   int cache_size; // in MB, 0 for no limit
    Eina_Bool loop:1;
 
    struct
@@ -48,6 +59,7 @@ static void _theme_hook(Evas_Object *obj);
 static void _sizing_eval(Evas_Object *obj);
 static void _changed_size_hints(void *data, Evas *e, Evas_Object *obj, void *event_info);
 static Eina_Bool _timer_cb(void *data);
+static void _item_unbuild(Elm_Slideshow_Item *item);
 static void _on_focus_hook(void *data, Evas_Object *obj);
 static Eina_Bool _event_hook(Evas_Object *obj, Evas_Object *src,
                              Evas_Callback_Type type, void *event_info);
@@ -90,10 +102,11 @@ _event_hook(Evas_Object *obj, Evas_Object *src __UNUSED__, Evas_Callback_Type ty
      {
         if (wd->timeout)
           {
-             if (wd->timer)
+             if ((wd->timer) || (wd->waiting))
                {
-                  ecore_timer_del(wd->timer);
+                  if (wd->timer) ecore_timer_del(wd->timer);
                   wd->timer = NULL;
+                  wd->waiting = NULL;
                }
              else
                elm_slideshow_timeout_set(obj, wd->timeout);
@@ -207,113 +220,222 @@ _sub_del(void *data __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __
    ;
 }
 
+static Evas_Object *
+_item_image_find(Evas_Object *o, int depth)
+{
+   Evas_Object *found = NULL, *child;
+   Eina_List *members;
+   const char *type = evas_object_type_get(o);
+
+   if (!type) return NULL;
+   if (!strcmp(type, "image")) return o;
+   //only look into the widgets showing images, photos and icons
+   if ((depth <= 0) ||
+       ((strcmp(type, "elm_widget")) && (strcmp(type, "e_icon"))))
+     return NULL;
+   members = evas_object_smart_members_get(o);
+   EINA_LIST_FREE(members, child)
+     if (!found) found = _item_image_find(child, depth - 1);
+   return found;
+}
+
 static void
-_item_realize(Elm_Slideshow_Item *item)
+_items_built_trim(Widget_Data *wd)
+{
+   Elm_Slideshow_Item *item;
+   Eina_List *l, *l_next, *l_prev;
+   size_t max;
+   int count = 0;
+
+   if (wd->cache_size <= 0) return;
+   max = (size_t)wd->cache_size * 1024 * 1024;
+   //least recently shown first
+   EINA_LIST_FOREACH_SAFE(wd->items_built, l, l_next, item)
+     {
+        if (wd->built_bytes <= max) return;
+        if ((item == wd->current) || (item == wd->previous) ||
+            (item == wd->waiting) || (item == wd->realizing) ||
+            (item->window == wd->window))
+          continue;
+        _item_unbuild(item);
+     }
+   if (wd->built_bytes <= max) return;
+
+   //still over, shrink the window: its items were built from the
+   //current one outwards, the farthest ones are the last
+   for (l = eina_list_last(wd->items_built); l; l = l_prev)
+     {
+        l_prev = eina_list_prev(l);
+        item = eina_list_data_get(l);
+        if (item->window != wd->window) continue;
+        if ((wd->built_bytes <= max) ||
+            (item == wd->current) || (item == wd->previous) ||
+            (item == wd->waiting) || (item == wd->realizing))
+          count++;
+        else
+          _item_unbuild(item);
+     }
+   //the next windows keep the neighbours that fit, the shown one aside
+   wd->window_max = (count > 0) ? count - 1 : 0;
+}
+
+static void
+_item_preloaded(void *data, Evas *e __UNUSED__, Evas_Object *o, void *event_info __UNUSED__)
 {
-   Elm_Slideshow_Item *_item_prev, *_item_next;
+   Elm_Slideshow_Item *item = data;
    Evas_Object *obj = WIDGET(item);
    Widget_Data *wd = elm_widget_data_get(obj);
-   int ac, bc, lc, ic = 0;
+   int w = 0, h = 0;
 
+   evas_object_event_callback_del_full(o, EVAS_CALLBACK_IMAGE_PRELOADED,
+                                       _item_preloaded, item);
+   item->ready = EINA_TRUE;
    if (!wd) return;
-   if ((!VIEW(item)) && (item->itc->func.get))
+   if (evas_object_image_load_error_get(o) == EVAS_LOAD_ERROR_NONE)
+     evas_object_image_size_get(o, &w, &h);
+   item->bytes = (size_t)w * h * 4;
+   wd->built_bytes += item->bytes;
+   _items_built_trim(wd);
+
+   //the timer was waiting for this one
+   if (wd->waiting == item)
      {
-        VIEW(item) = item->itc->func.get(elm_widget_item_data_get(item),
-                                         obj);
-        evas_object_smart_member_add(VIEW(item), obj);
-        item->l_built = eina_list_append(NULL, item);
-        wd->items_built = eina_list_merge(wd->items_built, item->l_built);
-        //FIXME: item could be showed by obj
-        evas_object_hide(VIEW(item));
+        wd->waiting = NULL;
+        elm_slideshow_next(obj);
      }
+}
+
+static void
+_item_build(Elm_Slideshow_Item *item)
+{
+   Evas_Object *obj = WIDGET(item);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   Evas_Coord w, h;
+
+   VIEW(item) = item->itc->func.get(elm_widget_item_data_get(item), obj);
+   item->ready = EINA_TRUE;
+   if (!VIEW(item)) return;
+   evas_object_smart_member_add(VIEW(item), obj);
+   item->l_built = eina_list_append(NULL, item);
+   wd->items_built = eina_list_merge(wd->items_built, item->l_built);
+   //FIXME: item could be showed by obj
+   evas_object_hide(VIEW(item));
+
+   //decode the pixels on the evas threads, at the size they are shown
+   item->img = _item_image_find(VIEW(item), 3);
+   if (!item->img) return;
+   evas_object_geometry_get(obj, NULL, NULL, &w, &h);
+   if ((w > 0) && (h > 0))
+     {
+        int lw = 0, lh = 0;
+
+        evas_object_image_load_size_get(item->img, &lw, &lh);
+        if ((lw <= 0) && (lh <= 0))
+          evas_object_image_load_size_set(item->img, w, h);
+     }
+   item->ready = EINA_FALSE;
+   evas_object_event_callback_add(item->img, EVAS_CALLBACK_IMAGE_PRELOADED,
+                                  _item_preloaded, item);
+   evas_object_image_preload(item->img, EINA_FALSE);
+}
+
+static void
+_item_preload_cancel(Elm_Slideshow_Item *item)
+{
+   Widget_Data *wd = elm_widget_data_get(WIDGET(item));
+
+   if (wd)
+     {
+        if (wd->waiting == item) wd->waiting = NULL;
+        wd->built_bytes -= item->bytes;
+     }
+   item->bytes = 0;
+   if ((item->img) && (!item->ready))
+     evas_object_event_callback_del_full(item->img,
+                                         EVAS_CALLBACK_IMAGE_PRELOADED,
+                                         _item_preloaded, item);
+   item->img = NULL;
+   item->ready = EINA_FALSE;
+}
+
+static void
+_item_unbuild(Elm_Slideshow_Item *item)
+{
+   Widget_Data *wd = elm_widget_data_get(WIDGET(item));
+
+   _item_preload_cancel(item);
+   wd->items_built = eina_list_remove_list(wd->items_built, item->l_built);
+   item->l_built = NULL;
+   if (item->itc->func.del)
+     item->itc->func.del(elm_widget_item_data_get(item), VIEW(item));
+   evas_object_del(VIEW(item));
+   VIEW(item) = NULL;
+}
+
+//Put item in the current cache window, built and shown most recently
+static Eina_Bool
+_item_window_add(Widget_Data *wd, Elm_Slideshow_Item *item)
+{
+   //looped back into the window, it holds all the items
+   if (item->window == wd->window) return EINA_FALSE;
+   item->window = wd->window;
+   if ((!VIEW(item)) && (item->itc->func.get))
+     _item_build(item);
    else if (item->l_built)
      wd->items_built = eina_list_demote_list(wd->items_built, item->l_built);
+   return EINA_TRUE;
+}
+
+static void
+_item_realize(Elm_Slideshow_Item *item)
+{
+   Elm_Slideshow_Item *_item_prev, *_item_next, *unused;
+   Evas_Object *obj = WIDGET(item);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   int ac, bc, left;
+
+   if (!wd) return;
+   wd->realizing = item;
+   wd->window++;
+   _item_window_add(wd, item);
 
    //pre-create previous and next item
    ac = wd->count_item_pre_after;
    _item_next = item;
    bc = wd->count_item_pre_before;
    _item_prev = item;
-   lc = eina_list_count(wd->items) - 1;
-   while (lc > 0 && ((ac > 0) || (bc > 0)))
+   left = wd->window_max;
+   while ((_item_next) || (_item_prev))
      {
-        if (lc > 0 && ac > 0)
+        if ((_item_next) && (ac-- > 0) && (left != 0))
           {
-             --ac;
-             --lc;
-             if (_item_next)
-               {
-                  _item_next = _item_next_get(_item_next);
-                  if ((_item_next)
-                      && (!VIEW(_item_next))
-                      && (_item_next->itc->func.get))
-                    {
-                       ic++;
-                       VIEW(_item_next) =
-                          _item_next->itc->func.get(
-                             elm_widget_item_data_get(_item_next), obj);
-                       evas_object_smart_member_add(VIEW(_item_next), obj);
-                       _item_next->l_built = eina_list_append(NULL, _item_next);
-                       wd->items_built = eina_list_merge(wd->items_built,
-                                                         _item_next->l_built);
-                       //FIXME: _item_next could be showed by obj later
-                       evas_object_hide(VIEW(_item_next));
-                    }
-                  else if (_item_next && _item_next->l_built)
-                    {
-                       ic++;
-                       wd->items_built =
-                           eina_list_demote_list(wd->items_built,
-                                             _item_next->l_built);
-                    }
-               }
+             _item_next = _item_next_get(_item_next);
+             if ((_item_next) && (!_item_window_add(wd, _item_next)))
+               _item_next = NULL;
+             else if (_item_next)
+               left--;
           }
+        else
+          _item_next = NULL;
 
-        if (lc > 0 && bc > 0)
+        if ((_item_prev) && (bc-- > 0) && (left != 0))
           {
-             --bc;
-             --lc;
-             if (_item_prev)
-               {
-                  _item_prev = _item_prev_get(_item_prev);
-                  if ((_item_prev)
-                      && (!VIEW(_item_prev))
-                      && (_item_prev->itc->func.get))
-                    {
-                       ic++;
-                       VIEW(_item_prev) =
-                          _item_prev->itc->func.get(
-                             elm_widget_item_data_get(_item_prev), obj);
-                       evas_object_smart_member_add(VIEW(_item_prev), obj);
-                       _item_prev->l_built = eina_list_append(NULL, _item_prev);
-                       wd->items_built = eina_list_merge(wd->items_built,
-                                                         _item_prev->l_built);
-                       //FIXME: _item_prev could be showed by obj later
-                       evas_object_hide(VIEW(_item_prev));
-                    }
-                  else if (_item_prev && _item_prev->l_built)
-                    {
-                       ic++;
-                       wd->items_built =
-                           eina_list_demote_list(wd->items_built,
-                                             _item_prev->l_built);
-                    }
-               }
+             _item_prev = _item_prev_get(_item_prev);
+             if ((_item_prev) && (!_item_window_add(wd, _item_prev)))
+               _item_prev = NULL;
+             else if (_item_prev)
+               left--;
           }
+        else
+          _item_prev = NULL;
      }
 
-   //delete unused items
-   lc = ic + 1;
-   while ((int)eina_list_count(wd->items_built) > lc)
-     {
-        item = eina_list_data_get(wd->items_built);
-        wd->items_built = eina_list_remove_list(wd->items_built,
-                                                wd->items_built);
-        if (item->itc->func.del)
-          item->itc->func.del(elm_widget_item_data_get(item), VIEW(item));
-        evas_object_del(VIEW(item));
-        VIEW(item) = NULL;
-     }
+   //delete unused items, the window ones were all moved to the end
+   while ((wd->items_built) &&
+          ((unused = eina_list_data_get(wd->items_built))->window != wd->window))
+     _item_unbuild(unused);
+   wd->realizing = NULL;
+   _items_built_trim(wd);
 }
 
 static void
@@ -347,9 +469,23 @@ static Eina_Bool
 _timer_cb(void *data)
 {
    Evas_Object *obj = data;
+   Elm_Slideshow_Item *next = NULL;
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return ECORE_CALLBACK_CANCEL;
    wd->timer = NULL;
+   //do not show a slide still being decoded, it is shown once ready
+   if (wd->current) next = _item_next_get(wd->current);
+   if ((next) && (next != wd->current))
+     {
+        if ((!VIEW(next)) && (next->itc->func.get)) _item_build(next);
+        //wait one more timeout at most, in case the decode never ends
+        if ((VIEW(next)) && (!next->ready) && (wd->waiting != next))
+          {
+             wd->waiting = next;
+             wd->timer = ecore_timer_add(wd->timeout, _timer_cb, obj);
+             return ECORE_CALLBACK_CANCEL;
+          }
+     }
    elm_slideshow_next(obj);
    return ECORE_CALLBACK_CANCEL;
 }
@@ -362,6 +498,7 @@ _item_del_pre_hook(Elm_Object_Item *it)
    if (!wd) return EINA_FALSE;
 
    if (wd->previous == item) wd->previous = NULL;
+   _item_preload_cancel(item);
    if (wd->current == item)
      {
         Eina_List *l = eina_list_data_find_list(wd->items, item);
@@ -414,6 +551,7 @@ elm_slideshow_add(Evas_Object *parent)
    _elm_theme_object_set(obj, wd->slideshow, "slideshow", "base", "default");
    wd->count_item_pre_before = 2;
    wd->count_item_pre_after = 2;
+   wd->window_max = -1;
    elm_widget_resize_object_set(obj, wd->slideshow);
 
    wd->transitions = elm_widget_stringlist_get(edje_object_data_get(wd->slideshow, "transitions"));
@@ -498,6 +636,7 @@ elm_slideshow_item_show(Elm_Object_Item *it)
 
    if (wd->timer) ecore_timer_del(wd->timer);
    wd->timer = NULL;
+   wd->waiting = NULL;
    if (wd->timeout > 0.0)
      wd->timer = ecore_timer_add(wd->timeout, _timer_cb, WIDGET(item));
    _item_realize(next);
@@ -532,6 +671,7 @@ elm_slideshow_next(Evas_Object *obj)
 
    if (wd->timer) ecore_timer_del(wd->timer);
    wd->timer = NULL;
+   wd->waiting = NULL;
    if (wd->timeout > 0.0)
      wd->timer = ecore_timer_add(wd->timeout, _timer_cb, obj);
 
@@ -569,6 +709,7 @@ elm_slideshow_previous(Evas_Object *obj)
 
    if (wd->timer) ecore_timer_del(wd->timer);
    wd->timer = NULL;
+   wd->waiting = NULL;
    if (wd->timeout > 0.0)
      wd->timer = ecore_timer_add(wd->timeout, _timer_cb, obj);
 
@@ -632,6 +773,7 @@ elm_slideshow_timeout_set(Evas_Object *obj, double timeout)
    wd->timeout = timeout;
    if (wd->timer) ecore_timer_del(wd->timer);
    wd->timer = NULL;
+   wd->waiting = NULL;
    if (timeout > 0.0)
      wd->timer = ecore_timer_add(timeout, _timer_cb, obj);
 }
@@ -696,6 +838,8 @@ elm_slideshow_clear(Evas_Object *obj)
    wd->current = NULL;
    EINA_LIST_FREE(wd->items_built, item)
      {
+        item->l_built = NULL;
+        _item_preload_cancel(item);
         if (item->itc->func.del)
           item->itc->func.del(elm_widget_item_data_get(item), VIEW(item));
      }
@@ -746,6 +890,7 @@ elm_slideshow_cache_before_set(Evas_Object *obj, int count)
    if (!wd) return;
    if (count < 0) count = 0;
    wd->count_item_pre_before = count;
+   wd->window_max = -1;
 }
 
 EAPI int
@@ -765,6 +910,36 @@ elm_slideshow_cache_after_set(Evas_Object *obj, int count)
    if (!wd) return;
    if (count < 0) count = 0;
    wd->count_item_pre_after = count;
+   wd->window_max = -1;
+}
+
+EAPI void
+elm_slideshow_cache_size_set(Evas_Object *obj, int size)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype);
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return;
+   if (size < 0) size = 0;
+   wd->cache_size = size;
+   wd->window_max = -1;
+   _items_built_trim(wd);
+}
+
+EAPI int
+elm_slideshow_cache_size_get(const Evas_Object *obj)
+{
+   ELM_CHECK_WIDTYPE(obj, widtype) -1;
+   Widget_Data *wd = elm_widget_data_get(obj);
+   if (!wd) return -1;
+   return wd->cache_size;
+}
+
+EAPI Eina_Bool
+elm_slideshow_item_ready_get(const Elm_Object_Item *it)
+{
+   ELM_OBJ_ITEM_CHECK_OR_RETURN(it, EINA_FALSE);
+   Elm_Slideshow_Item *item = (Elm_Slideshow_Item *)it;
+   return (VIEW(item)) && (item->ready);
 }
 
 EAPI Elm_Object_Item *
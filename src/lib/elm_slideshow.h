@@ -45,6 +45,14 @@
  * cached @b before and @b after the current item, in the widget's
  * item list.
  *
+ * When an item's object shows an image (an image, icon or photo
+ * widget, or a plain Evas image), its pixels are decoded in the
+ * background, at the size of the slideshow, as soon as the item is
+ * cached. The timer does not switch to an item whose image is still
+ * being decoded: it waits for it, for one more timeout at most. The
+ * memory used by cached items can be limited with
+ * elm_slideshow_cache_size_set().
+ *
  * Smart events one can add callbacks for are:
  *
  * - @c "changed" - when the slideshow switches its view to a new
@@ -531,6 +539,51 @@ EAPI void                  elm_slideshow_cache_after_set(Evas_Object *obj, int c
  */
 EAPI int                   elm_slideshow_cache_after_get(const Evas_Object *obj);
 
+/**
+ * Set the maximum memory used by the cached items of a given
+ * slideshow widget
+ *
+ * @param obj The slideshow object
+ * @param size The maximum size, in megabytes, of the decoded images of
+ * the cached items. @c 0 means no limit.
+ *
+ * When over the limit, the items shown the least recently are
+ * released first, then the cached items farthest from the current
+ * one, and fewer items are cached from then on, until the cache
+ * settings change again. The current item is never released for
+ * it. The default value is @c 0. See
+ * @ref Slideshow_Caching "slideshow caching" for more details.
+ *
+ * @see elm_slideshow_cache_size_get()
+ *
+ * @ingroup Slideshow
+ */
+EAPI void                  elm_slideshow_cache_size_set(Evas_Object *obj, int size);
+
+/**
+ * Get the maximum memory used by the cached items of a given
+ * slideshow widget
+ *
+ * @param obj The slideshow object
+ * @return The maximum size in megabytes, @c 0 meaning no limit
+ *
+ * @see elm_slideshow_cache_size_set() for more details
+ *
+ * @ingroup Slideshow
+ */
+EAPI int                   elm_slideshow_cache_size_get(const Evas_Object *obj);
+
+/**
+ * Get whether a given slideshow item is ready to be shown
+ *
+ * @param it The slideshow item
+ * @return @c EINA_TRUE if the item's object is created and its image
+ * decoded, @c EINA_FALSE otherwise
+ *
+ * @ingroup Slideshow
+ */
+EAPI Eina_Bool             elm_slideshow_item_ready_get(const Elm_Object_Item *it);
+
 /**
  * Get the number of items stored in a given slideshow widget
  *
@@ -9,6 +9,17 @@ static Elm_Theme theme_default =
 
 static Eina_List *themes = NULL;
 
+typedef struct _Theme_Job_Cb Theme_Job_Cb;
+struct _Theme_Job_Cb
+{
+   Elm_Theme_Job_Done_Cb func;
+   const void           *data;
+   Eina_Bool             delete_me : 1;
+};
+
+static Eina_List *job_cbs = NULL;
+static int job_cbs_walking = 0;
+
 static void
 _elm_theme_clear(Elm_Theme *th)
 {
@@ -205,14 +216,13 @@ _elm_theme_object_icon_set(Evas_Object *parent, Evas_Object *o, const char *grou
    return _elm_theme_icon_set(th, o, group, style);
 }
 
-Eina_Bool
-_elm_theme_set(Elm_Theme *th, Evas_Object *o, const char *clas, const char *group, const char *style)
+static Eina_Bool
+_theme_group_set(Elm_Theme *th, Evas_Object *o, const char *clas, const char *group, const char *style)
 {
    const char *file;
    char buf2[1024];
    Eina_Bool ok;
 
-   if ((!clas) || (!group) || (!style)) return EINA_FALSE;
    if (!th) th = &(theme_default);
    snprintf(buf2, sizeof(buf2), "elm/%s/%s/%s", clas, group, style);
    file = _elm_theme_group_file_find(th, buf2);
@@ -234,6 +244,18 @@ _elm_theme_set(Elm_Theme *th, Evas_Object *o, const char *clas, const char *grou
    return ok;
 }
 
+Eina_Bool
+_elm_theme_set(Elm_Theme *th, Evas_Object *o, const char *clas, const char *group, const char *style)
+{
+   Eina_Bool ok;
+
+   if ((!clas) || (!group) || (!style)) return EINA_FALSE;
+   ELM_PERF_SPAN_BEGIN(t0);
+   ok = _theme_group_set(th, o, clas, group, style);
+   ELM_PERF_SPAN_END(t0, clas, ELM_PERF_SITE_THEME_SET);
+   return ok;
+}
+
 Eina_Bool
 _elm_theme_icon_set(Elm_Theme *th, Evas_Object *o, const char *group, const char *style)
 {
@@ -315,7 +337,29 @@ _elm_theme_parse(Elm_Theme *th, const char *theme)
 void
 _elm_theme_shutdown(void)
 {
+   Theme_Job_Cb *cb;
+
    _elm_theme_clear(&(theme_default));
+   EINA_LIST_FREE(job_cbs, cb) free(cb);
+}
+
+void
+_elm_theme_job_done(void)
+{
+   Eina_List *l, *l_next;
+   Theme_Job_Cb *cb;
+
+   job_cbs_walking++;
+   EINA_LIST_FOREACH(job_cbs, l, cb)
+     if (!cb->delete_me) cb->func((void *)cb->data);
+   job_cbs_walking--;
+   if (job_cbs_walking) return;
+   EINA_LIST_FOREACH_SAFE(job_cbs, l, l_next, cb)
+     {
+        if (!cb->delete_me) continue;
+        job_cbs = eina_list_remove_list(job_cbs, l);
+        free(cb);
+     }
 }
 
 EAPI Elm_Theme *
@@ -586,6 +630,7 @@ elm_theme_flush(Elm_Theme *th)
    th->cache = eina_hash_string_superfast_new(EINA_FREE_CB(eina_stringshare_del));
    if (th->cache_data) eina_hash_free(th->cache_data);
    th->cache_data = eina_hash_string_superfast_new(EINA_FREE_CB(eina_stringshare_del));
+   _elm_widget_item_pool_views_flush();
    _elm_win_rescale(th, EINA_TRUE);
    _elm_ews_wm_rescale(th, EINA_TRUE);
    if (th->referrers)
@@ -610,6 +655,52 @@ elm_theme_full_flush(void)
    elm_theme_flush(&(theme_default));
 }
 
+EAPI double
+elm_theme_job_progress_get(void)
+{
+   return _elm_widget_theme_job_progress_get();
+}
+
+EAPI void
+elm_theme_job_finish(void)
+{
+   _elm_widget_theme_job_finish();
+}
+
+EAPI void
+elm_theme_job_done_callback_add(Elm_Theme_Job_Done_Cb func, const void *data)
+{
+   Theme_Job_Cb *cb;
+
+   EINA_SAFETY_ON_NULL_RETURN(func);
+   cb = calloc(1, sizeof(Theme_Job_Cb));
+   if (!cb) return;
+   cb->func = func;
+   cb->data = data;
+   job_cbs = eina_list_append(job_cbs, cb);
+}
+
+EAPI void
+elm_theme_job_done_callback_del(Elm_Theme_Job_Done_Cb func, const void *data)
+{
+   Eina_List *l;
+   Theme_Job_Cb *cb;
+
+   EINA_LIST_FOREACH(job_cbs, l, cb)
+     {
+        if ((cb->func != func) || (cb->data != data) || (cb->delete_me))
+          continue;
+        if (job_cbs_walking)
+          cb->delete_me = EINA_TRUE;
+        else
+          {
+             job_cbs = eina_list_remove_list(job_cbs, l);
+             free(cb);
+          }
+        return;
+     }
+}
+
 EAPI Eina_List *
 elm_theme_name_available_list_new(void)
 {
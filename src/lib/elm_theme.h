@@ -78,6 +78,15 @@
  */
 typedef struct _Elm_Theme Elm_Theme;
 
+/**
+ * @typedef Elm_Theme_Job_Done_Cb
+ *
+ * Function called when a staged retheme finishes.
+ *
+ * @see elm_theme_job_done_callback_add()
+ */
+typedef void (*Elm_Theme_Job_Done_Cb)(void *data);
+
 /**
  * Create a new specific theme
  *
@@ -358,6 +367,53 @@ EAPI void             elm_theme_flush(Elm_Theme *th);
  */
 EAPI void             elm_theme_full_flush(void);
 
+/**
+ * Get the progress of the pending retheme.
+ *
+ * @return A value between 0.0 and 1.0, 1.0 when nothing is pending
+ *
+ * Flushing a theme or changing the scale does not re-theme every widget at
+ * once: the visible widgets are re-themed over the next frames, a few at a
+ * time so that each frame keeps room for rendering and input, and widgets
+ * that are hidden are re-themed when they get shown. The cache flushes done
+ * when the cache configuration changes are staged the same way.
+ *
+ * @see elm_theme_job_finish()
+ *
+ * @ingroup Theme
+ */
+EAPI double           elm_theme_job_progress_get(void);
+
+/**
+ * Apply the pending retheme right away.
+ *
+ * This blocks until every visible widget queued for a retheme is done.
+ * Hidden widgets are still re-themed only when shown.
+ *
+ * @ingroup Theme
+ */
+EAPI void             elm_theme_job_finish(void);
+
+/**
+ * Add a function to call each time a staged retheme finishes.
+ *
+ * @param func The function to call
+ * @param data Data passed to @p func
+ *
+ * @ingroup Theme
+ */
+EAPI void             elm_theme_job_done_callback_add(Elm_Theme_Job_Done_Cb func, const void *data);
+
+/**
+ * Remove a function added with elm_theme_job_done_callback_add().
+ *
+ * @param func The function given on addition
+ * @param data The data given on addition
+ *
+ * @ingroup Theme
+ */
+EAPI void             elm_theme_job_done_callback_del(Elm_Theme_Job_Done_Cb func, const void *data);
+
 /**
  * Return a list of theme elements in the theme search path
  *
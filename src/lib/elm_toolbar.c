@@ -24,8 +24,21 @@ struct _Widget_Data
    Eina_Bool homogeneous : 1;
    Eina_Bool vertical : 1;
    Eina_Bool long_press : 1;
+   Eina_Bool layout_dirty : 1;
+   Eina_Bool overflow : 1;
    Ecore_Timer *long_timer;
    Ecore_Job *resize_job;
+   struct
+     {
+        /* items sorted by priority, the ones above standard_priority
+         * first, and the ones fitting the viewport first among those */
+        Elm_Toolbar_Item **items;
+        unsigned int count, size;
+        unsigned int high, shown;
+        Evas_Coord more, sum, total;
+        Eina_Bool dirty : 1;
+        Eina_Bool sums_dirty : 1;
+     } prio;
 };
 
 struct _Elm_Toolbar_Item
@@ -42,6 +55,8 @@ struct _Elm_Toolbar_Item
    struct
      {
         int priority;
+        unsigned int pos;
+        Evas_Coord w, h;
         Eina_Bool visible : 1;
      } prio;
    Eina_Bool selected : 1;
@@ -66,6 +81,7 @@ struct _Elm_Toolbar_Item_State
 static const char *widtype = NULL;
 static void _item_show(Elm_Toolbar_Item *it);
 static void _item_select(Elm_Toolbar_Item *it);
+static void _more_menu_fill(Widget_Data *wd);
 static void _item_unselect(Elm_Toolbar_Item *it);
 static void _del_pre_hook(Evas_Object *obj);
 static void _del_hook(Evas_Object *obj);
@@ -76,6 +92,14 @@ static void _sizing_eval(Evas_Object *obj);
 static void _resize(void *data, Evas *e, Evas_Object *obj, void *event_info);
 static void _menu_move_resize(void *data, Evas *e, Evas_Object *obj, void *event_info);
 static void _menu_hide(void *data, Evas *e, Evas_Object *obj, void *event_info);
+static void _resize_item(void *data, Evas *e, Evas_Object *obj, void *event_info);
+static void _items_changed(Evas_Object *obj);
+static void _select(void *data, Evas_Object *obj, const char *emission, const char *source);
+static void _select_filter(Elm_Toolbar_Item *it, Evas_Object *obj, const char *emission, const char *source);
+static void _mouse_in(void *data, Evas_Object *obj, const char *emission, const char *source);
+static void _mouse_out(void *data, Evas_Object *obj, const char *emission, const char *source);
+static void _mouse_down(Elm_Toolbar_Item *it, Evas *evas, Evas_Object *obj, Evas_Event_Mouse_Down *ev);
+static void _mouse_up(Elm_Toolbar_Item *it, Evas *evas, Evas_Object *obj, Evas_Event_Mouse_Up *ev);
 static void _layout(Evas_Object *o, Evas_Object_Box_Data *priv, void *data);
 static void _elm_toolbar_item_icon_obj_set(Evas_Object *obj, Elm_Toolbar_Item *item, Evas_Object *icon_obj, const char *icon_str, double icon_size, const char *sig);
 static void _item_label_set(Elm_Toolbar_Item *item, const char *label, const char *sig);
@@ -110,7 +134,7 @@ _item_disable_hook(Elm_Object_Item *it)
         edje_object_signal_emit(VIEW(toolbar_it), "elm,state,enabled", "elm");
         elm_widget_signal_emit(toolbar_it->icon, "elm,state,enabled", "elm");
      }
-   _resize(WIDGET(toolbar_it), NULL, NULL, NULL);
+   _items_changed(WIDGET(toolbar_it));
 }
 
 static Eina_Bool
@@ -233,6 +257,10 @@ _item_select(Elm_Toolbar_Item *it)
    obj2 = WIDGET(it);
    if (it->menu && (!sel))
      {
+        /* submenus may have changed since the last layout */
+        if ((it == wd->more_item) &&
+            (wd->shrink_mode == ELM_TOOLBAR_SHRINK_MENU))
+          _more_menu_fill(wd);
         evas_object_show(it->o_menu);
         evas_object_event_callback_add(VIEW(it), EVAS_CALLBACK_RESIZE,
                                        _menu_move_resize, it);
@@ -278,6 +306,7 @@ static void
 _item_del(Elm_Toolbar_Item *it)
 {
    Elm_Toolbar_Item_State *it_state;
+   Evas_Object *box;
    _item_unselect(it);
    EINA_LIST_FREE(it->states, it_state)
      {
@@ -299,6 +328,32 @@ _item_del(Elm_Toolbar_Item *it)
    if (it->object) evas_object_del(it->object);
    //TODO: See if checking for wd->menu_parent is necessary before deleting menu
    if (it->o_menu) evas_object_del(it->o_menu);
+   if (!VIEW(it)) return;
+   /* the view may go back to the item pool, leave it as _item_new() found
+    * it */
+   edje_object_signal_emit(VIEW(it), "elm,state,unhighlighted", "elm");
+   if (elm_widget_item_disabled_get(it))
+     edje_object_signal_emit(VIEW(it), "elm,state,enabled", "elm");
+   edje_object_signal_callback_del_full(VIEW(it), "elm,action,click", "elm",
+                                        _select, it);
+   edje_object_signal_callback_del_full(VIEW(it), "mouse,clicked,*", "*",
+                                        (Edje_Signal_Cb)_select_filter, it);
+   edje_object_signal_callback_del_full(VIEW(it), "elm,mouse,in", "elm",
+                                        _mouse_in, it);
+   edje_object_signal_callback_del_full(VIEW(it), "elm,mouse,out", "elm",
+                                        _mouse_out, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_DOWN,
+                                       (Evas_Object_Event_Cb)_mouse_down, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOUSE_UP,
+                                       (Evas_Object_Event_Cb)_mouse_up, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_RESIZE,
+                                       _menu_move_resize, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_MOVE,
+                                       _menu_move_resize, it);
+   evas_object_event_callback_del_full(VIEW(it), EVAS_CALLBACK_RESIZE,
+                                       _resize_item, it);
+   box = evas_object_smart_parent_get(VIEW(it));
+   if (box) evas_object_box_remove(box, VIEW(it));
 }
 
 static void
@@ -334,6 +389,7 @@ _del_hook(Evas_Object *obj)
    Widget_Data *wd = elm_widget_data_get(obj);
 
    if (!wd) return;
+   free(wd->prio.items);
    free(wd);
 }
 
@@ -449,6 +505,7 @@ _theme_hook(Evas_Object *obj)
    scale = (elm_widget_scale_get(obj) * _elm_config->scale);
    edje_object_scale_set(wd->scr, scale);
    wd->icon_size = _elm_toolbar_icon_size_get(wd);
+   wd->layout_dirty = EINA_TRUE;
    EINA_INLIST_FOREACH(wd->items, it)
       _theme_hook_item(obj, it, scale, wd->icon_size);
    if (wd->more_item)
@@ -619,74 +676,198 @@ _item_menu_destroy(Elm_Toolbar_Item *item)
    item->menu = EINA_FALSE;
 }
 
+/* Higher priorities first, items of the same priority in toolbar order. */
 static int
 _toolbar_item_prio_compare_cb(const void *i1, const void *i2)
 {
-   const Elm_Toolbar_Item *eti1 = i1;
-   const Elm_Toolbar_Item *eti2 = i2;
-
-   if (!eti2) return 1;
-   if (!eti1) return -1;
+   const Elm_Toolbar_Item *eti1 = *(Elm_Toolbar_Item * const *)i1;
+   const Elm_Toolbar_Item *eti2 = *(Elm_Toolbar_Item * const *)i2;
 
-   if (eti2->prio.priority == eti1->prio.priority)
-     return -1;
+   if (eti2->prio.priority != eti1->prio.priority)
+     return (eti2->prio.priority > eti1->prio.priority) ? 1 : -1;
+   if (eti2->prio.pos != eti1->prio.pos)
+     return (eti2->prio.pos > eti1->prio.pos) ? -1 : 1;
+   return 0;
+}
 
-   return eti2->prio.priority - eti1->prio.priority;
+static Evas_Coord
+_item_extent_get(const Widget_Data *wd, const Elm_Toolbar_Item *it)
+{
+   return wd->vertical ? it->prio.h : it->prio.w;
 }
 
-static void
-_fix_items_visibility(Widget_Data *wd, Evas_Coord *iw, Evas_Coord vw, Eina_Bool *more)
+/* Rebuilds the priority index from scratch, needed only when items are
+ * added, removed, reordered or turned into separators. Returns EINA_FALSE
+ * if the index could not be allocated, it stays dirty then. */
+static Eina_Bool
+_prio_index_build(Widget_Data *wd)
 {
-   Elm_Toolbar_Item *it, *prev;
-   Eina_List *sorted = NULL;
-   Evas_Coord ciw = 0, cih = 0;
-   int count = 0, i = 0;
-   *more = EINA_FALSE;
+   Elm_Toolbar_Item *it, *prev = NULL, **items;
+   unsigned int n;
 
-   EINA_INLIST_FOREACH(wd->items, it)
+   n = eina_inlist_count(wd->items);
+   if (n > wd->prio.size)
      {
-        if (it->separator)
+        items = realloc(wd->prio.items, n * sizeof(Elm_Toolbar_Item *));
+        if (!items)
           {
-             prev = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(it)->prev);
-             it->prio.priority = prev->prio.priority;
+             wd->prio.count = 0;
+             return EINA_FALSE;
           }
+        wd->prio.items = items;
+        wd->prio.size = n;
      }
-
+   n = 0;
    EINA_INLIST_FOREACH(wd->items, it)
      {
-        sorted = eina_list_sorted_insert(sorted,
-                                         _toolbar_item_prio_compare_cb, it);
-     }
+        /* separators go wherever the item before them goes */
+        if ((it->separator) && (prev))
+          it->prio.priority = prev->prio.priority;
+        it->prio.pos = n;
+        wd->prio.items[n++] = it;
+        prev = it;
+     }
+   wd->prio.count = n;
+   qsort(wd->prio.items, n, sizeof(Elm_Toolbar_Item *),
+         _toolbar_item_prio_compare_cb);
+   wd->prio.dirty = EINA_FALSE;
+   wd->prio.sums_dirty = EINA_TRUE;
+   wd->layout_dirty = EINA_TRUE;
+   return EINA_TRUE;
+}
 
-   if (wd->more_item)
+/* Moves a single item to the slot of its new priority. */
+static void
+_prio_item_slot(Widget_Data *wd, Elm_Toolbar_Item *it, int priority)
+{
+   Elm_Toolbar_Item **items = wd->prio.items, **p;
+   unsigned int i, lo = 0, hi, mid;
+
+   p = bsearch(&it, items, wd->prio.count, sizeof(Elm_Toolbar_Item *),
+               _toolbar_item_prio_compare_cb);
+   it->prio.priority = priority;
+   if (!p)
      {
-        evas_object_geometry_get(wd->VIEW(more_item), NULL, NULL, &ciw, &cih);
-        if (wd->vertical) *iw += cih;
-        else              *iw += ciw;
+        wd->prio.dirty = EINA_TRUE;
+        return;
      }
-
-   EINA_LIST_FREE(sorted, it)
+   i = p - items;
+   memmove(items + i, items + i + 1,
+           (wd->prio.count - i - 1) * sizeof(Elm_Toolbar_Item *));
+   hi = wd->prio.count - 1;
+   while (lo < hi)
      {
+        mid = (lo + hi) / 2;
+        if (_toolbar_item_prio_compare_cb(items + mid, &it) < 0) lo = mid + 1;
+        else hi = mid;
+     }
+   memmove(items + lo + 1, items + lo,
+           (wd->prio.count - 1 - lo) * sizeof(Elm_Toolbar_Item *));
+   items[lo] = it;
+   wd->prio.sums_dirty = EINA_TRUE;
+}
+
+/* Full pass over the index, after priorities or item extents changed.
+ * Returns whether any item changed box or visibility. */
+static Eina_Bool
+_prio_layout(Widget_Data *wd, Evas_Coord vw)
+{
+   Elm_Toolbar_Item *it;
+   Evas_Object *box;
+   Evas_Coord ext;
+   Eina_Bool changed = EINA_FALSE, visible;
+   unsigned int n, count = 0, i = 0;
+
+   wd->prio.high = 0;
+   wd->prio.shown = 0;
+   wd->prio.sum = wd->prio.more;
+   wd->prio.total = wd->prio.more;
+   for (n = 0; n < wd->prio.count; n++)
+     {
+        it = wd->prio.items[n];
         if (it->prio.priority > wd->standard_priority)
           {
-             evas_object_geometry_get(VIEW(it), NULL, NULL, &ciw, &cih);
-             if (wd->vertical) *iw += cih;
-             else              *iw += ciw;
-             it->prio.visible = (*iw <= vw);
-             it->in_box = wd->bx;
+             ext = _item_extent_get(wd, it);
+             wd->prio.total += ext;
+             visible = ((wd->prio.shown == n) &&
+                        (wd->prio.sum + ext <= vw));
+             if (visible)
+               {
+                  wd->prio.sum += ext;
+                  wd->prio.shown++;
+               }
+             wd->prio.high++;
+             box = wd->bx;
              if (!it->separator) count++;
           }
         else
           {
-             it->prio.visible = EINA_FALSE;
+             visible = EINA_FALSE;
              if (!it->separator) i++;
              if (i <= (count + 1))
-               it->in_box = wd->bx_more;
+               box = wd->bx_more;
              else
-               it->in_box = wd->bx_more2;
-             *more = EINA_TRUE;
+               box = wd->bx_more2;
           }
+        if ((it->prio.visible != visible) || (it->in_box != box))
+          changed = EINA_TRUE;
+        it->prio.visible = visible;
+        it->in_box = box;
+     }
+   wd->prio.sums_dirty = EINA_FALSE;
+   return changed;
+}
+
+/* A plain resize only moves the boundary between the items that fit and
+ * the ones that do not. */
+static Eina_Bool
+_prio_boundary_move(Widget_Data *wd, Evas_Coord vw)
+{
+   Elm_Toolbar_Item *it;
+   Evas_Coord ext;
+   Eina_Bool changed = EINA_FALSE;
+
+   while (wd->prio.shown < wd->prio.high)
+     {
+        it = wd->prio.items[wd->prio.shown];
+        ext = _item_extent_get(wd, it);
+        if (wd->prio.sum + ext > vw) break;
+        wd->prio.sum += ext;
+        wd->prio.shown++;
+        it->prio.visible = EINA_TRUE;
+        changed = EINA_TRUE;
+     }
+   while ((wd->prio.shown > 0) && (wd->prio.sum > vw))
+     {
+        it = wd->prio.items[--wd->prio.shown];
+        wd->prio.sum -= _item_extent_get(wd, it);
+        it->prio.visible = EINA_FALSE;
+        changed = EINA_TRUE;
      }
+   return changed;
+}
+
+static Eina_Bool
+_fix_items_visibility(Widget_Data *wd, Evas_Coord *iw, Evas_Coord vw, Eina_Bool *more)
+{
+   Evas_Coord ciw = 0, cih = 0, ext = 0;
+   Eina_Bool changed;
+
+   if (wd->more_item)
+     {
+        evas_object_geometry_get(wd->VIEW(more_item), NULL, NULL, &ciw, &cih);
+        ext = wd->vertical ? cih : ciw;
+     }
+   if (ext != wd->prio.more)
+     {
+        wd->prio.more = ext;
+        wd->prio.sums_dirty = EINA_TRUE;
+     }
+   if (wd->prio.sums_dirty) changed = _prio_layout(wd, vw);
+   else changed = _prio_boundary_move(wd, vw);
+   *iw += wd->prio.total;
+   *more = (wd->prio.high < wd->prio.count);
+   return changed;
 }
 
 static void
@@ -696,6 +877,35 @@ _elm_toolbar_item_menu_cb(void *data, Evas_Object *obj __UNUSED__, void *event_i
    if (it->func) it->func((void *)(it->base.data), WIDGET(it), it);
 }
 
+/* Refills the "More" menu with the items over the boundary, cloning their
+ * submenus as they are now. */
+static void
+_more_menu_fill(Widget_Data *wd)
+{
+   Elm_Toolbar_Item *it;
+   Evas_Object *menu;
+
+   _item_menu_destroy(wd->more_item);
+   _item_menu_create(wd, wd->more_item);
+   menu = wd->more_item->o_menu;
+   EINA_INLIST_FOREACH(wd->items, it)
+     {
+        if (it->prio.visible) continue;
+        if (it->separator)
+          elm_menu_item_separator_add(menu, NULL);
+        else
+          {
+             Elm_Object_Item *menu_it;
+             menu_it = elm_menu_item_add(menu, NULL, it->icon_str, it->label,
+                                         _elm_toolbar_item_menu_cb, it);
+             elm_object_item_disabled_set(menu_it,
+                                          elm_widget_item_disabled_get(it));
+             if (it->o_menu)
+               elm_menu_clone(it->o_menu, menu, menu_it);
+          }
+     }
+}
+
 static void
 _resize_job(void *data)
 {
@@ -703,11 +913,14 @@ _resize_job(void *data)
    Widget_Data *wd = elm_widget_data_get(obj);
    Evas_Coord mw, mh, vw = 0, vh = 0, w = 0, h = 0;
    Elm_Toolbar_Item *it;
+   Evas_Object *first, *last;
    Eina_List *list;
-   Eina_Bool more;
+   Eina_Bool more, changed, overflow = EINA_FALSE;
 
    if (!wd) return;
    wd->resize_job = NULL;
+   /* every mode may walk the priority index, try again on the next resize */
+   if ((wd->prio.dirty) && (!_prio_index_build(wd))) return;
    elm_smart_scroller_child_viewport_size_get(wd->scr, &vw, &vh);
    evas_object_size_hint_min_get(wd->bx, &mw, &mh);
    evas_object_geometry_get(wd->bx, NULL, NULL, &w, &h);
@@ -718,12 +931,12 @@ _resize_job(void *data)
         if (wd->vertical)
           {
              evas_object_resize(wd->bx, w, vh);
-             _fix_items_visibility(wd, &ih, vh, &more);
+             changed = _fix_items_visibility(wd, &ih, vh, &more);
           }
         else
           {
              evas_object_resize(wd->bx, vw, h);
-             _fix_items_visibility(wd, &iw, vw, &more);
+             changed = _fix_items_visibility(wd, &iw, vw, &more);
           }
         evas_object_geometry_get(wd->VIEW(more_item), NULL, NULL,
                                  &more_w, &more_h);
@@ -735,56 +948,43 @@ _resize_job(void *data)
           {
              if ((iw - more_w) <= vw) iw -= more_w;
           }
-
-        /* All items are removed from the box object, since removing individual
-         * items won't trigger a resize. Items are be readded below. */
-        evas_object_box_remove_all(wd->bx, EINA_FALSE);
-        if (((wd->vertical)  && (ih > vh)) ||
-            ((!wd->vertical) && (iw > vw)) || more)
+        overflow = (((wd->vertical)  && (ih > vh)) ||
+                    ((!wd->vertical) && (iw > vw)) || more);
+
+        /* Unless something crossed the boundary, the box and the menu are
+         * still right. All items are removed from the box object, since
+         * removing individual items won't trigger a resize. Items are be
+         * readded below. */
+        if ((changed) || (wd->layout_dirty) || (overflow != wd->overflow))
           {
-             Evas_Object *menu;
-
-             _item_menu_destroy(wd->more_item);
-             _item_menu_create(wd, wd->more_item);
-             menu = elm_toolbar_item_menu_get((Elm_Object_Item *)wd->more_item);
-             EINA_INLIST_FOREACH(wd->items, it)
+             evas_object_box_remove_all(wd->bx, EINA_FALSE);
+             if (overflow)
                {
-                  if (!it->prio.visible)
+                  _more_menu_fill(wd);
+                  EINA_INLIST_FOREACH(wd->items, it)
                     {
-                       if (it->separator)
-                         elm_menu_item_separator_add(menu, NULL);
+                       if (!it->prio.visible)
+                         evas_object_hide(VIEW(it));
                        else
                          {
-                            Elm_Object_Item *menu_it;
-                            menu_it = elm_menu_item_add
-                              (menu, NULL, it->icon_str, it->label,
-                                  _elm_toolbar_item_menu_cb, it);
-                            elm_object_item_disabled_set
-                              (menu_it, elm_widget_item_disabled_get(it));
-                            if (it->o_menu)
-                              elm_menu_clone(it->o_menu, menu, menu_it);
+                            evas_object_box_append(wd->bx, VIEW(it));
+                            evas_object_show(VIEW(it));
                          }
-                       evas_object_hide(VIEW(it));
                     }
-                  else
+                  evas_object_box_append(wd->bx, wd->VIEW(more_item));
+                  evas_object_show(wd->VIEW(more_item));
+               }
+             else
+               {
+                  /* All items are visible, show them all (except for the "More"
+                   * button, of course). */
+                  EINA_INLIST_FOREACH(wd->items, it)
                     {
-                       evas_object_box_append(wd->bx, VIEW(it));
                        evas_object_show(VIEW(it));
+                       evas_object_box_append(wd->bx, VIEW(it));
                     }
+                  evas_object_hide(wd->VIEW(more_item));
                }
-             evas_object_box_append(wd->bx, wd->VIEW(more_item));
-             evas_object_show(wd->VIEW(more_item));
-          }
-        else
-          {
-             /* All items are visible, show them all (except for the "More"
-              * button, of course). */
-             EINA_INLIST_FOREACH(wd->items, it)
-               {
-                  evas_object_show(VIEW(it));
-                  evas_object_box_append(wd->bx, VIEW(it));
-               }
-             evas_object_hide(wd->VIEW(more_item));
           }
      }
    else if (wd->shrink_mode == ELM_TOOLBAR_SHRINK_HIDE)
@@ -794,35 +994,39 @@ _resize_job(void *data)
         if (wd->vertical)
           {
              evas_object_resize(wd->bx, w, vh);
-             _fix_items_visibility(wd, &ih, vh, &more);
+             changed = _fix_items_visibility(wd, &ih, vh, &more);
           }
         else
           {
              evas_object_resize(wd->bx, vw, h);
-             _fix_items_visibility(wd, &iw, vw, &more);
+             changed = _fix_items_visibility(wd, &iw, vw, &more);
           }
-        evas_object_box_remove_all(wd->bx, EINA_FALSE);
-        if (((wd->vertical)  && (ih > vh)) ||
-            ((!wd->vertical) && (iw > vw)) || more)
+        overflow = (((wd->vertical)  && (ih > vh)) ||
+                    ((!wd->vertical) && (iw > vw)) || more);
+        if ((changed) || (wd->layout_dirty) || (overflow != wd->overflow))
           {
-             EINA_INLIST_FOREACH(wd->items, it)
+             evas_object_box_remove_all(wd->bx, EINA_FALSE);
+             if (overflow)
                {
-                  if (!it->prio.visible)
-                    evas_object_hide(VIEW(it));
-                  else
+                  EINA_INLIST_FOREACH(wd->items, it)
                     {
-                       evas_object_box_append(wd->bx, VIEW(it));
-                       evas_object_show(VIEW(it));
+                       if (!it->prio.visible)
+                         evas_object_hide(VIEW(it));
+                       else
+                         {
+                            evas_object_box_append(wd->bx, VIEW(it));
+                            evas_object_show(VIEW(it));
+                         }
                     }
                }
-          }
-        else
-          {
-             /* All items are visible, show them all */
-             EINA_INLIST_FOREACH(wd->items, it)
+             else
                {
-                  evas_object_show(VIEW(it));
-                  evas_object_box_append(wd->bx, VIEW(it));
+                  /* All items are visible, show them all */
+                  EINA_INLIST_FOREACH(wd->items, it)
+                    {
+                       evas_object_show(VIEW(it));
+                       evas_object_box_append(wd->bx, VIEW(it));
+                    }
                }
           }
      }
@@ -837,28 +1041,32 @@ _resize_job(void *data)
           evas_object_resize(wd->bx, vw, mh);
 
         if (wd->vertical)
-          _fix_items_visibility(wd, &ih, vh, &more);
+          changed = _fix_items_visibility(wd, &ih, vh, &more);
         else
-          _fix_items_visibility(wd, &iw, vw, &more);
+          changed = _fix_items_visibility(wd, &iw, vw, &more);
+        overflow = more;
 
-        evas_object_box_remove_all(wd->bx, EINA_FALSE);
-        evas_object_box_remove_all(wd->bx_more, EINA_FALSE);
-        evas_object_box_remove_all(wd->bx_more2, EINA_FALSE);
-        EINA_INLIST_FOREACH(wd->items, it)
+        if ((changed) || (wd->layout_dirty) || (overflow != wd->overflow))
           {
-             if (it->in_box)
+             evas_object_box_remove_all(wd->bx, EINA_FALSE);
+             evas_object_box_remove_all(wd->bx_more, EINA_FALSE);
+             evas_object_box_remove_all(wd->bx_more2, EINA_FALSE);
+             EINA_INLIST_FOREACH(wd->items, it)
                {
-                  evas_object_box_append(it->in_box, VIEW(it));
-                  evas_object_show(VIEW(it));
+                  if (it->in_box)
+                    {
+                       evas_object_box_append(it->in_box, VIEW(it));
+                       evas_object_show(VIEW(it));
+                    }
                }
+             if (more)
+               {
+                  evas_object_box_append(wd->bx, wd->VIEW(more_item));
+                  evas_object_show(wd->VIEW(more_item));
+               }
+             else
+               evas_object_hide(wd->VIEW(more_item));
           }
-        if (more)
-          {
-             evas_object_box_append(wd->bx, wd->VIEW(more_item));
-             evas_object_show(wd->VIEW(more_item));
-          }
-        else
-          evas_object_hide(wd->VIEW(more_item));
      }
    else
      {
@@ -880,12 +1088,17 @@ _resize_job(void *data)
           }
      }
 
+   wd->layout_dirty = EINA_FALSE;
+   wd->overflow = overflow;
+
    // Remove the first or last separator since it is not neccessary
    list = evas_object_box_children_get(wd->bx_more);
+   first = eina_list_data_get(list);
+   last = eina_list_data_get(eina_list_last(list));
+   eina_list_free(list);
    EINA_INLIST_FOREACH(wd->items, it)
      {
-        if (it->separator && ((VIEW(it) == eina_list_data_get(list)) ||
-            (VIEW(it) == eina_list_nth(list, eina_list_count(list)-1))))
+        if (it->separator && ((VIEW(it) == first) || (VIEW(it) == last)))
           {
              evas_object_box_remove(wd->bx_more, VIEW(it));
              evas_object_move(VIEW(it), -9999, -9999);
@@ -893,10 +1106,12 @@ _resize_job(void *data)
           }
      }
    list = evas_object_box_children_get(wd->bx_more2);
+   first = eina_list_data_get(list);
+   last = eina_list_data_get(eina_list_last(list));
+   eina_list_free(list);
    EINA_INLIST_FOREACH(wd->items, it)
      {
-        if (it->separator && ((VIEW(it) == eina_list_data_get(list)) ||
-            (VIEW(it) == eina_list_nth(list, eina_list_count(list)-1))))
+        if (it->separator && ((VIEW(it) == first) || (VIEW(it) == last)))
           {
              evas_object_box_remove(wd->bx_more2, VIEW(it));
              evas_object_move(VIEW(it), -9999, -9999);
@@ -908,10 +1123,32 @@ _resize_job(void *data)
 }
 
 static void
-_resize_item(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+_resize_item(void *data, Evas *e __UNUSED__, Evas_Object *obj, void *event_info __UNUSED__)
+{
+   Elm_Toolbar_Item *it = data;
+   Widget_Data *wd = elm_widget_data_get(WIDGET(it));
+   Evas_Coord w, h;
+
+   if (!wd) return;
+   evas_object_geometry_get(obj, NULL, NULL, &w, &h);
+   if ((wd->vertical) ? (h != it->prio.h) : (w != it->prio.w))
+     wd->prio.sums_dirty = EINA_TRUE;
+   it->prio.w = w;
+   it->prio.h = h;
+   _sizing_eval(WIDGET(it));
+   _resize(WIDGET(it), NULL, NULL, NULL);
+}
+
+/* Something about the items changed besides their geometry: the boxes and
+ * the "More" menu are refilled on the next resize job. */
+static void
+_items_changed(Evas_Object *obj)
 {
-   _sizing_eval(data);
-   _resize(data, NULL, NULL, NULL);
+   Widget_Data *wd = elm_widget_data_get(obj);
+
+   if (!wd) return;
+   wd->layout_dirty = EINA_TRUE;
+   _resize(obj, NULL, NULL, NULL);
 }
 
 static void
@@ -989,8 +1226,9 @@ _change_items(Evas_Object *obj)
         tmp = wd->reorder_from->prio.priority;
         wd->reorder_from->prio.priority = wd->reorder_to->prio.priority;
         wd->reorder_to->prio.priority = tmp;
+        wd->prio.dirty = EINA_TRUE;
      }
-   _resize(obj, NULL, NULL, NULL);
+   _items_changed(obj);
 }
 
 static void
@@ -1243,6 +1481,7 @@ _item_del_pre_hook(Elm_Object_Item *it)
    next = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(item)->next);
    wd->items = eina_inlist_remove(wd->items, EINA_INLIST_GET(item));
    wd->item_count--;
+   wd->prio.dirty = EINA_TRUE;
    if (!next) next = ELM_TOOLBAR_ITEM_FROM_INLIST(wd->items);
    if ((wd->select_mode == ELM_OBJECT_SELECT_MODE_ALWAYS) &&
        item->selected && next) _item_select(next);
@@ -1285,7 +1524,7 @@ _item_new(Evas_Object *obj, const char *icon, const char *label, Evas_Smart_Cb f
    it->separator = EINA_FALSE;
    it->object = NULL;
    it->base.data = data;
-   VIEW(it) = edje_object_add(evas_object_evas_get(obj));
+   elm_widget_item_view_get(it, "toolbar", "item");
    _elm_access_item_register(&it->base, VIEW(it));
    _elm_access_text_set(_elm_access_item_get(&it->base),
                         ELM_ACCESS_TYPE, E_("Tool Item"));
@@ -1306,8 +1545,6 @@ _item_new(Evas_Object *obj, const char *icon, const char *label, Evas_Smart_Cb f
         evas_object_del(icon_obj);
      }
 
-   _elm_theme_object_set(obj, VIEW(it), "toolbar", "item",
-                         elm_widget_style_get(obj));
    edje_object_signal_callback_add(VIEW(it), "elm,action,click", "elm",
                                    _select, it);
    edje_object_signal_callback_add(VIEW(it), "mouse,clicked,*", "*",
@@ -1364,8 +1601,10 @@ _item_new(Evas_Object *obj, const char *icon, const char *label, Evas_Smart_Cb f
      }
    evas_object_size_hint_min_set(VIEW(it), mw, mh);
    evas_object_size_hint_max_set(VIEW(it), -1, -1);
+   evas_object_geometry_get(VIEW(it), NULL, NULL, &it->prio.w, &it->prio.h);
    evas_object_event_callback_add(VIEW(it), EVAS_CALLBACK_RESIZE,
-                                  _resize_item, obj);
+                                  _resize_item, it);
+   wd->prio.dirty = EINA_TRUE;
    if ((!wd->items) && (wd->select_mode == ELM_OBJECT_SELECT_MODE_ALWAYS))
      _item_select(it);
    return it;
@@ -1438,7 +1677,7 @@ _item_label_set(Elm_Toolbar_Item *item, const char *label, const char *sig)
      }
    else
      _elm_toolbar_item_label_update(item);
-   _resize(WIDGET(item), NULL, NULL, NULL);
+   _items_changed(WIDGET(item));
 }
 
 static void
@@ -1544,7 +1783,7 @@ _elm_toolbar_item_icon_obj_set(Evas_Object *obj, Elm_Toolbar_Item *item, Evas_Ob
      }
    else
      _elm_toolbar_item_icon_update(item);
-   _resize(obj, NULL, NULL, NULL);
+   _items_changed(obj);
 }
 
 static void
@@ -1802,9 +2041,26 @@ elm_toolbar_item_priority_set(Elm_Object_Item *it, int priority)
 {
    ELM_OBJ_ITEM_CHECK_OR_RETURN(it);
    Elm_Toolbar_Item *item = (Elm_Toolbar_Item *)it;
+   Elm_Toolbar_Item *next;
+   Widget_Data *wd = elm_widget_data_get(WIDGET(item));
+   if (!wd) return;
    if (item->prio.priority == priority) return;
-   item->prio.priority = priority;
-   _resize(WIDGET(item), NULL, NULL, NULL);
+   /* a separator follows the item before it anyway */
+   if ((wd->prio.dirty) ||
+       ((item->separator) && (EINA_INLIST_GET(item)->prev)))
+     {
+        item->prio.priority = priority;
+        wd->prio.dirty = EINA_TRUE;
+     }
+   else
+     {
+        _prio_item_slot(wd, item, priority);
+        next = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(item)->next);
+        for (; (next) && (next->separator);
+             next = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(next)->next))
+          _prio_item_slot(wd, next, priority);
+     }
+   _items_changed(WIDGET(item));
 }
 
 EAPI int
@@ -2002,9 +2258,11 @@ elm_toolbar_item_separator_set(Elm_Object_Item *it, Eina_Bool separator)
    double scale;
    if (item->separator == separator) return;
    item->separator = separator;
+   wd->prio.dirty = EINA_TRUE;
    scale = (elm_widget_scale_get(obj) * _elm_config->scale);
    _theme_hook_item(obj, item, scale, wd->icon_size);
    evas_object_size_hint_min_set(VIEW(item), -1, -1);
+   _items_changed(obj);
 }
 
 EAPI Eina_Bool
@@ -2023,6 +2281,7 @@ elm_toolbar_shrink_mode_set(Evas_Object *obj, Elm_Toolbar_Shrink_Mode shrink_mod
 
    if (!wd) return;
    wd->shrink_mode = shrink_mode;
+   wd->layout_dirty = EINA_TRUE;
    bounce = (_elm_config->thumbscroll_bounce_enable) &&
       (shrink_mode == ELM_TOOLBAR_SHRINK_SCROLL);
    elm_smart_scroller_bounce_allow_set(wd->scr, bounce, EINA_FALSE);
@@ -2156,6 +2415,7 @@ elm_toolbar_item_menu_set(Elm_Object_Item *it, Eina_Bool menu)
    if (item->menu == menu) return;
    if (menu) _item_menu_create(wd, item);
    else _item_menu_destroy(item);
+   wd->layout_dirty = EINA_TRUE;
 }
 
 EAPI Evas_Object *
@@ -2402,6 +2662,8 @@ elm_toolbar_horizontal_set(Evas_Object *obj, Eina_Bool horizontal)
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
    wd->vertical = !horizontal;
+   wd->prio.sums_dirty = EINA_TRUE;
+   wd->layout_dirty = EINA_TRUE;
    if (wd->vertical)
      evas_object_size_hint_align_set(wd->bx, 0.5, wd->align);
    else
@@ -2434,7 +2696,8 @@ elm_toolbar_standard_priority_set(Evas_Object *obj, int priority)
    Widget_Data *wd = elm_widget_data_get(obj);
    if (!wd) return;
    wd->standard_priority = priority;
-   _resize(obj, NULL, NULL, NULL);
+   wd->prio.sums_dirty = EINA_TRUE;
+   _items_changed(obj);
 }
 
 EAPI int
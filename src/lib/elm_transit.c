@@ -19,18 +19,32 @@
 
 
 #define _TRANSIT_FOCAL 2000
+#define _TRANSIT_TWEEN_TABLE_SIZE 128
 
 struct _Elm_Transit
 {
+   EINA_INLIST; /* running transits, see _transits_animate_cb() */
 #define ELM_TRANSIT_MAGIC 0xd27f190a
    EINA_MAGIC;
 
-   Ecore_Animator *animator;
    Eina_Inlist *effect_list;
    Eina_List *objs;
+   struct
+     {
+        Evas_Object **data;
+        unsigned int count;
+        Eina_Bool dirty : 1;
+     } objs_array; /* transit->objs, for indexed access */
    Elm_Transit *prev_chain_transit;
    Eina_List *next_chain_transits;
    Elm_Transit_Tween_Mode tween_mode;
+   struct
+     {
+        double v[4]; /* bezier control points, or spring decay and bounces */
+        double *table; /* _TRANSIT_TWEEN_TABLE_SIZE + 1 samples when baked */
+        Eina_Bool bake : 1;
+        Eina_Bool dirty : 1;
+     } tween;
    struct
      {
         Elm_Transit_Del_Cb func;
@@ -52,12 +66,14 @@ struct _Elm_Transit
      } repeat;
    double progress;
    unsigned int effects_pending_del;
+   unsigned int seq; /* creation order, see _transit_target_cmp() */
    int walking;
    Eina_Bool auto_reverse : 1;
    Eina_Bool event_enabled : 1;
    Eina_Bool deleted : 1;
    Eina_Bool state_keep : 1;
    Eina_Bool finished : 1;
+   Eina_Bool running : 1;
 };
 
 struct _Elm_Transit_Effect_Module
@@ -81,7 +97,12 @@ struct _Elm_Transit_Obj_State
 struct _Elm_Transit_Obj_Data
 {
    struct _Elm_Transit_Obj_State *state;
+   Evas_Map *map; /* reused by the map effects on every frame */
+   Evas_Coord x, y, w, h;
    Eina_Bool freeze_events : 1;
+   Eina_Bool geometry_valid : 1;
+   Eina_Bool map_dirty : 1; /* touched by an effect in this frame */
+   Eina_Bool map_perspective : 1;
 };
 
 typedef struct _Elm_Transit_Effect_Module Elm_Transit_Effect_Module;
@@ -92,23 +113,74 @@ static void _transit_obj_data_update(Elm_Transit *transit, Evas_Object *obj);
 static void _transit_obj_data_recover(Elm_Transit *transit, Evas_Object *obj);
 static void _transit_obj_states_save(Evas_Object *obj, Elm_Transit_Obj_Data *obj_data);
 static void _transit_obj_remove_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, void *event_info __UNUSED__);
+static void _transit_obj_geometry_changed_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__);
+static Elm_Transit_Obj_Data *_transit_obj_data_new(Evas_Object *obj);
+static void _transit_obj_data_free(Evas_Object *obj, Elm_Transit_Obj_Data *obj_data);
 static void _transit_obj_remove(Elm_Transit *transit, Evas_Object *obj);
+static Eina_Bool _recover_image_uv(Evas_Object *obj, Evas_Map *map, Eina_Bool revert, Eina_Bool by_x);
 static void _transit_effect_del(Elm_Transit *transit, Elm_Transit_Effect_Module *effect_module);
 static void _transit_remove_dead_effects(Elm_Transit *transit);
 static void _transit_chain_go(Elm_Transit *transit);
 static void _transit_del(Elm_Transit *transit);
 static Eina_Bool _transit_animate_op(Elm_Transit *transit, double progress);
-static Eina_Bool _transit_animate_cb(void *data);
+static Eina_Bool _transit_animate(Elm_Transit *transit, double now);
+static Eina_Bool _transits_animate_cb(void *data);
 
 static char *_transit_key= "_elm_transit_key";
 
+/* All the running transits are advanced by one animator, in one pass */
+static Ecore_Animator *_transits_animator = NULL;
+static Eina_Inlist *_transits_running = NULL;
+static Elm_Transit **_transits_frame = NULL;
+static unsigned int _transits_frame_size = 0;
+static Eina_Bool _transits_walking = EINA_FALSE;
+static unsigned int _transits_seq = 0;
+static struct
+{
+   unsigned int transits;
+   double time;
+} _transits_frame_stats = { 0, 0.0 };
+
+static void
+_transit_run(Elm_Transit *transit)
+{
+   if (transit->running) return;
+   transit->running = EINA_TRUE;
+   _transits_running = eina_inlist_append(_transits_running,
+                                          EINA_INLIST_GET(transit));
+   if (!_transits_animator)
+     _transits_animator = ecore_animator_add(_transits_animate_cb, NULL);
+}
+
+static void
+_transit_stop(Elm_Transit *transit)
+{
+   if (!transit->running) return;
+   transit->running = EINA_FALSE;
+   _transits_running = eina_inlist_remove(_transits_running,
+                                          EINA_INLIST_GET(transit));
+   //the frame callback cleans up itself
+   if ((_transits_running) || (_transits_walking)) return;
+   if (_transits_animator)
+     {
+        ecore_animator_del(_transits_animator);
+        _transits_animator = NULL;
+     }
+   free(_transits_frame);
+   _transits_frame = NULL;
+   _transits_frame_size = 0;
+}
+
 static void
 _transit_obj_data_update(Elm_Transit *transit, Evas_Object *obj)
 {
    Elm_Transit_Obj_Data *obj_data = evas_object_data_get(obj, _transit_key);
 
    if (!obj_data)
-     obj_data = ELM_NEW(Elm_Transit_Obj_Data);
+     {
+        obj_data = _transit_obj_data_new(obj);
+        if (!obj_data) return;
+     }
 
    obj_data->freeze_events = evas_object_freeze_events_get(obj);
 
@@ -143,6 +215,210 @@ _transit_obj_states_save(Evas_Object *obj, Elm_Transit_Obj_Data *obj_data)
    obj_data->state = state;
 }
 
+static void
+_transit_obj_geometry_changed_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Elm_Transit_Obj_Data *obj_data = data;
+   obj_data->geometry_valid = EINA_FALSE;
+}
+
+static Elm_Transit_Obj_Data *
+_transit_obj_data_new(Evas_Object *obj)
+{
+   Elm_Transit_Obj_Data *obj_data = ELM_NEW(Elm_Transit_Obj_Data);
+
+   if (!obj_data) return NULL;
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_MOVE,
+                                  _transit_obj_geometry_changed_cb, obj_data);
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_RESIZE,
+                                  _transit_obj_geometry_changed_cb, obj_data);
+   return obj_data;
+}
+
+static void
+_transit_obj_data_free(Evas_Object *obj, Elm_Transit_Obj_Data *obj_data)
+{
+   evas_object_event_callback_del_full(obj, EVAS_CALLBACK_MOVE,
+                                       _transit_obj_geometry_changed_cb,
+                                       obj_data);
+   evas_object_event_callback_del_full(obj, EVAS_CALLBACK_RESIZE,
+                                       _transit_obj_geometry_changed_cb,
+                                       obj_data);
+   if (obj_data->map) evas_map_free(obj_data->map);
+   free(obj_data);
+}
+
+static void
+_transit_obj_geometry_get(Evas_Object *obj, Elm_Transit_Obj_Data *obj_data, Evas_Coord *x, Evas_Coord *y, Evas_Coord *w, Evas_Coord *h)
+{
+   if (!obj_data->geometry_valid)
+     {
+        evas_object_geometry_get(obj, &obj_data->x, &obj_data->y,
+                                 &obj_data->w, &obj_data->h);
+        obj_data->geometry_valid = EINA_TRUE;
+     }
+   if (x) *x = obj_data->x;
+   if (y) *y = obj_data->y;
+   if (w) *w = obj_data->w;
+   if (h) *h = obj_data->h;
+}
+
+//Get the map of the object for this frame. The first map effect of the
+//frame gets it populated from the object geometry, the following ones
+//transform it further, so that the effects compose. The map is set to the
+//object once per frame by _transit_obj_maps_flush().
+static Evas_Map *
+_transit_obj_map_get(Evas_Object *obj, Elm_Transit_Obj_Data **obj_data_ret)
+{
+   Elm_Transit_Obj_Data *obj_data = evas_object_data_get(obj, _transit_key);
+   Evas_Coord x, y, w, h;
+
+   //the object data may have been recovered by another transit
+   if (!obj_data) return NULL;
+   if (!obj_data->map)
+     {
+        obj_data->map = evas_map_new(4);
+        if (!obj_data->map) return NULL;
+     }
+   if (!obj_data->map_dirty)
+     {
+        _transit_obj_geometry_get(obj, obj_data, &x, &y, &w, &h);
+        evas_map_util_points_populate_from_geometry(obj_data->map,
+                                                    x, y, w, h, 0);
+        _recover_image_uv(obj, obj_data->map, EINA_FALSE, EINA_FALSE);
+        obj_data->map_dirty = EINA_TRUE;
+        obj_data->map_perspective = EINA_FALSE;
+     }
+   if (obj_data_ret) *obj_data_ret = obj_data;
+   return obj_data->map;
+}
+
+//Center of the map as transformed so far, effects transform around it
+static void
+_transit_map_center_get(const Evas_Map *map, Evas_Coord *cx, Evas_Coord *cy, Evas_Coord *cz)
+{
+   Evas_Coord x, y, z, sx = 0, sy = 0, sz = 0;
+   int i;
+
+   for (i = 0; i < 4; i++)
+     {
+        evas_map_point_coord_get(map, i, &x, &y, &z);
+        sx += x;
+        sy += y;
+        sz += z;
+     }
+   if (cx) *cx = sx / 4;
+   if (cy) *cy = sy / 4;
+   if (cz) *cz = sz / 4;
+}
+
+static void
+_transit_map_move(Evas_Map *map, Evas_Coord dx, Evas_Coord dy, Evas_Coord dz)
+{
+   Evas_Coord x, y, z;
+   int i;
+
+   for (i = 0; i < 4; i++)
+     {
+        evas_map_point_coord_get(map, i, &x, &y, &z);
+        evas_map_point_coord_set(map, i, x + dx, y + dy, z + dz);
+     }
+}
+
+static double
+_transit_bilerp(const double v[4], double u, double t)
+{
+   return ((1.0 - t) * (((1.0 - u) * v[0]) + (u * v[1]))) +
+          (t * (((1.0 - u) * v[3]) + (u * v[2])));
+}
+
+//Crop the map to the part from (u0, v0) to (u1, v1) of what it shows now,
+//given as fractions of its width and height. The map points come from an
+//affine transform of a rectangle so far, interpolating them is the same as
+//transforming the cropped rectangle.
+static void
+_transit_map_crop(Evas_Map *map, double u0, double v0, double u1, double v1)
+{
+   double px[4], py[4], pz[4], pu[4], pv[4], u, v;
+   Evas_Coord x, y, z;
+   int i;
+
+   for (i = 0; i < 4; i++)
+     {
+        evas_map_point_coord_get(map, i, &x, &y, &z);
+        px[i] = x;
+        py[i] = y;
+        pz[i] = z;
+        evas_map_point_image_uv_get(map, i, &pu[i], &pv[i]);
+     }
+   for (i = 0; i < 4; i++)
+     {
+        u = ((i == 1) || (i == 2)) ? u1 : u0;
+        v = (i >= 2) ? v1 : v0;
+        evas_map_point_coord_set(map, i,
+                                 lround(_transit_bilerp(px, u, v)),
+                                 lround(_transit_bilerp(py, u, v)),
+                                 lround(_transit_bilerp(pz, u, v)));
+        evas_map_point_image_uv_set(map, i, _transit_bilerp(pu, u, v),
+                                    _transit_bilerp(pv, u, v));
+     }
+}
+
+static Evas_Object **
+_transit_objs_array_get(Elm_Transit *transit, unsigned int *count)
+{
+   Evas_Object **data, *obj;
+   Eina_List *elist;
+   unsigned int i = 0;
+
+   if (transit->objs_array.dirty)
+     {
+        transit->objs_array.dirty = EINA_FALSE;
+        transit->objs_array.count = 0;
+        data = realloc(transit->objs_array.data, sizeof(Evas_Object *) *
+                       eina_list_count(transit->objs));
+        if ((!data) && (transit->objs))
+          {
+             free(transit->objs_array.data);
+             transit->objs_array.data = NULL;
+             transit->objs_array.dirty = EINA_TRUE;
+             *count = 0;
+             return NULL;
+          }
+        transit->objs_array.data = data;
+        EINA_LIST_FOREACH(transit->objs, elist, obj)
+          data[i++] = obj;
+        transit->objs_array.count = i;
+     }
+   *count = transit->objs_array.count;
+   return transit->objs_array.data;
+}
+
+static void
+_transit_obj_maps_flush(Elm_Transit *transit)
+{
+   Elm_Transit_Obj_Data *obj_data;
+   Evas_Object **objs;
+   unsigned int count, i;
+   Evas_Coord cx, cy;
+
+   objs = _transit_objs_array_get(transit, &count);
+   for (i = 0; i < count; i++)
+     {
+        obj_data = evas_object_data_get(objs[i], _transit_key);
+        if ((!obj_data) || (!obj_data->map_dirty)) continue;
+        obj_data->map_dirty = EINA_FALSE;
+        if (obj_data->map_perspective)
+          {
+             _transit_map_center_get(obj_data->map, &cx, &cy, NULL);
+             evas_map_util_3d_perspective(obj_data->map, cx, cy, 0,
+                                          _TRANSIT_FOCAL);
+          }
+        evas_object_map_set(objs[i], obj_data->map);
+        evas_object_map_enable_set(objs[i], EINA_TRUE);
+     }
+}
+
 static void
 _remove_obj_from_list(Elm_Transit *transit, Evas_Object *obj)
 {
@@ -153,6 +429,7 @@ _remove_obj_from_list(Elm_Transit *transit, Evas_Object *obj)
         if (!eina_list_data_find_list(transit->objs, obj))
           break;
         transit->objs = eina_list_remove(transit->objs, obj);
+        transit->objs_array.dirty = EINA_TRUE;
         evas_object_event_callback_del_full(obj, EVAS_CALLBACK_DEL,
                                        _transit_obj_remove_cb,
                                        transit);
@@ -168,7 +445,7 @@ _transit_obj_remove_cb(void *data, Evas *e __UNUSED__, Evas_Object *obj, void *e
      {
         if (obj_data->state)
           free(obj_data->state);
-        free(obj_data);
+        _transit_obj_data_free(obj, obj_data);
      }
    _remove_obj_from_list(transit, obj);
    if (!transit->objs) elm_transit_del(transit);
@@ -200,7 +477,7 @@ _transit_obj_data_recover(Elm_Transit *transit, Evas_Object *obj)
           }
         free(state);
      }
-   free(obj_data);
+   _transit_obj_data_free(obj, obj_data);
 }
 
 static void
@@ -239,7 +516,13 @@ _transit_chain_go(Elm_Transit *transit)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
    elm_transit_go(transit);
-   _transit_animate_cb(transit);
+   //the first frame is drawn in the frame the previous transit ended.
+   transit->walking++;
+   _transit_animate(transit, ecore_loop_time_get());
+   transit->walking--;
+   if (transit->walking) return;
+   if (transit->deleted) _transit_del(transit);
+   else if (transit->effects_pending_del) _transit_remove_dead_effects(transit);
 }
 
 static void
@@ -249,8 +532,7 @@ _transit_del(Elm_Transit *transit)
    Elm_Transit *chain_transit;
    Eina_List *elist, *elist_next;
 
-   if (transit->animator)
-     ecore_animator_del(transit->animator);
+   _transit_stop(transit);
 
    //remove effects
    while (transit->effect_list)
@@ -286,6 +568,8 @@ _transit_del(Elm_Transit *transit)
      }
 
    eina_list_free(transit->next_chain_transits);
+   free(transit->objs_array.data);
+   free(transit->tween.table);
 
    EINA_MAGIC_SET(transit, EINA_MAGIC_NONE);
    free(transit);
@@ -306,6 +590,9 @@ _transit_animate_op(Elm_Transit *transit, double progress)
      }
    transit->walking--;
 
+   //one map update per object, whatever the number of map effects
+   if (!transit->deleted) _transit_obj_maps_flush(transit);
+
    if (transit->walking) return EINA_TRUE;
 
    if (transit->deleted)
@@ -319,44 +606,129 @@ _transit_animate_op(Elm_Transit *transit, double progress)
    return EINA_TRUE;
 }
 
-static Eina_Bool
-_transit_animate_cb(void *data)
+//Solve the x of a cubic bezier for t, then get y. p0 is (0, 0), p3 (1, 1).
+static double
+_transit_bezier_value_get(const double *v, double x)
 {
-   Elm_Transit *transit = data;
-   double elapsed_time, duration;
+   double ax, bx, cx, ay, by, cy, t, lo = 0.0, hi = 1.0, cur, slope;
+   int i;
 
-   transit->time.current = ecore_loop_time_get();
-   elapsed_time = transit->time.current - transit->time.begin;
-   duration = transit->time.duration + transit->time.delayed;
+   cx = 3.0 * v[0];
+   bx = (3.0 * (v[2] - v[0])) - cx;
+   ax = 1.0 - cx - bx;
+   cy = 3.0 * v[1];
+   by = (3.0 * (v[3] - v[1])) - cy;
+   ay = 1.0 - cy - by;
 
-   if (elapsed_time > duration)
-     elapsed_time = duration;
+   //newton-raphson first, it converges in a few steps on sane curves
+   t = x;
+   for (i = 0; i < 8; i++)
+     {
+        cur = (((ax * t) + bx) * t + cx) * t - x;
+        if (fabs(cur) < 1e-6) goto done;
+        slope = ((3.0 * ax * t) + (2.0 * bx)) * t + cx;
+        if (fabs(slope) < 1e-6) break;
+        t -= cur / slope;
+     }
+   //fall back to bisection
+   t = x;
+   while (lo < hi)
+     {
+        cur = (((ax * t) + bx) * t + cx) * t;
+        if (fabs(cur - x) < 1e-6) break;
+        if (x > cur) lo = t;
+        else hi = t;
+        if ((hi - lo) < 1e-9) break;
+        t = (lo + hi) / 2.0;
+     }
+done:
+   return (((ay * t) + by) * t + cy) * t;
+}
 
-   transit->progress = elapsed_time / duration;
+static double
+_transit_tween_value_get(const Elm_Transit *transit, double progress)
+{
    switch (transit->tween_mode)
      {
       case ELM_TRANSIT_TWEEN_MODE_LINEAR:
-         transit->progress = ecore_animator_pos_map(transit->progress,
-                                                    ECORE_POS_MAP_LINEAR,
-                                                    0, 0);
+         return progress;
       case ELM_TRANSIT_TWEEN_MODE_ACCELERATE:
-         transit->progress = ecore_animator_pos_map(transit->progress,
-                                                    ECORE_POS_MAP_ACCELERATE,
-                                                    0, 0);
-         break;
+         return ecore_animator_pos_map(progress, ECORE_POS_MAP_ACCELERATE,
+                                       0, 0);
       case ELM_TRANSIT_TWEEN_MODE_DECELERATE:
-         transit->progress = ecore_animator_pos_map(transit->progress,
-                                                    ECORE_POS_MAP_DECELERATE,
-                                                    0, 0);
-         break;
+         return ecore_animator_pos_map(progress, ECORE_POS_MAP_DECELERATE,
+                                       0, 0);
       case ELM_TRANSIT_TWEEN_MODE_SINUSOIDAL:
-         transit->progress = ecore_animator_pos_map(transit->progress,
-                                                    ECORE_POS_MAP_SINUSOIDAL,
-                                                    0, 0);
-         break;
+         return ecore_animator_pos_map(progress, ECORE_POS_MAP_SINUSOIDAL,
+                                       0, 0);
+      case ELM_TRANSIT_TWEEN_MODE_BEZIER_CURVE:
+         if (progress <= 0.0) return 0.0;
+         if (progress >= 1.0) return 1.0;
+         return _transit_bezier_value_get(transit->tween.v, progress);
+      case ELM_TRANSIT_TWEEN_MODE_SPRING:
+         return ecore_animator_pos_map(progress, ECORE_POS_MAP_SPRING,
+                                       transit->tween.v[0],
+                                       transit->tween.v[1]);
       default:
-         break;
+         return progress;
      }
+}
+
+static void
+_transit_tween_table_build(Elm_Transit *transit)
+{
+   int i;
+
+   transit->tween.dirty = EINA_FALSE;
+   if (!transit->tween.table)
+     {
+        transit->tween.table = malloc(sizeof(double) *
+                                      (_TRANSIT_TWEEN_TABLE_SIZE + 1));
+        if (!transit->tween.table) return;
+     }
+   for (i = 0; i <= _TRANSIT_TWEEN_TABLE_SIZE; i++)
+     transit->tween.table[i] =
+        _transit_tween_value_get(transit,
+                                 (double)i / _TRANSIT_TWEEN_TABLE_SIZE);
+}
+
+static double
+_transit_tween_map(Elm_Transit *transit, double progress)
+{
+   const double *table;
+   double pos;
+   int i;
+
+   if ((!transit->tween.bake) ||
+       (transit->tween_mode == ELM_TRANSIT_TWEEN_MODE_LINEAR))
+     return _transit_tween_value_get(transit, progress);
+
+   if ((transit->tween.dirty) || (!transit->tween.table))
+     _transit_tween_table_build(transit);
+   table = transit->tween.table;
+   if (!table) return _transit_tween_value_get(transit, progress);
+
+   if (progress <= 0.0) return table[0];
+   if (progress >= 1.0) return table[_TRANSIT_TWEEN_TABLE_SIZE];
+   pos = progress * _TRANSIT_TWEEN_TABLE_SIZE;
+   i = (int)pos;
+   return table[i] + ((table[i + 1] - table[i]) * (pos - i));
+}
+
+//If the transit is done then EINA_FALSE is returned.
+static Eina_Bool
+_transit_animate(Elm_Transit *transit, double now)
+{
+   double elapsed_time, duration;
+
+   transit->time.current = now;
+   elapsed_time = transit->time.current - transit->time.begin;
+   duration = transit->time.duration + transit->time.delayed;
+
+   if (elapsed_time > duration)
+     elapsed_time = duration;
+
+   transit->progress = _transit_tween_map(transit, elapsed_time / duration);
 
    /* Reverse? */
    if (transit->repeat.reverse) transit->progress = 1 - transit->progress;
@@ -364,11 +736,12 @@ _transit_animate_cb(void *data)
    if (transit->time.duration > 0)
      {
         if (!_transit_animate_op(transit, transit->progress))
-          return ECORE_CALLBACK_CANCEL;
+          return EINA_FALSE;
+        if (transit->deleted) return EINA_FALSE;
      }
 
    /* Not end. Keep going. */
-   if (elapsed_time < duration) return ECORE_CALLBACK_RENEW;
+   if (elapsed_time < duration) return EINA_TRUE;
 
    /* Repeat and reverse and time done! */
    if ((transit->repeat.count >= 0) &&
@@ -377,7 +750,7 @@ _transit_animate_cb(void *data)
      {
         transit->finished = EINA_TRUE;
         elm_transit_del(transit);
-        return ECORE_CALLBACK_CANCEL;
+        return EINA_FALSE;
      }
 
    /* Repeat Case */
@@ -388,9 +761,92 @@ _transit_animate_cb(void *data)
      }
    else transit->repeat.reverse = EINA_TRUE;
 
-   transit->time.begin = ecore_loop_time_get();
+   transit->time.begin = now;
+
+   return EINA_TRUE;
+}
+
+static const void *
+_transit_target_get(const Elm_Transit *transit)
+{
+   return eina_list_data_get(transit->objs);
+}
+
+static int
+_transit_target_cmp(const void *data1, const void *data2)
+{
+   const Elm_Transit *transit1 = *(Elm_Transit * const *)data1;
+   const Elm_Transit *transit2 = *(Elm_Transit * const *)data2;
+   const void *t1 = _transit_target_get(transit1);
+   const void *t2 = _transit_target_get(transit2);
 
-   return ECORE_CALLBACK_RENEW;
+   if (t1 < t2) return -1;
+   if (t1 > t2) return 1;
+   //qsort is not stable, keep the transits of an object in the order
+   //they were created
+   if (transit1->seq < transit2->seq) return -1;
+   if (transit1->seq > transit2->seq) return 1;
+   return 0;
+}
+
+static Eina_Bool
+_transits_animate_cb(void *data __UNUSED__)
+{
+   Elm_Transit *transit, **frame;
+   unsigned int count = 0, i;
+   double now, start;
+
+   start = ecore_time_get();
+   now = ecore_loop_time_get();
+
+   //take the transits running at the beginning of the frame. Those
+   //started in the frame (chains) are already drawn by their starter.
+   EINA_INLIST_FOREACH(_transits_running, transit)
+     {
+        if (transit->time.paused > 0) continue;
+        if (count == _transits_frame_size)
+          {
+             frame = realloc(_transits_frame, sizeof(Elm_Transit *) *
+                             (_transits_frame_size + 32));
+             if (!frame) break;
+             _transits_frame = frame;
+             _transits_frame_size += 32;
+          }
+        _transits_frame[count++] = transit;
+        //keep it alive while the frame is walked
+        transit->walking++;
+     }
+   if (!count) goto end;
+
+   //transits of the same object are evaluated back to back
+   if (count > 1)
+     qsort(_transits_frame, count, sizeof(Elm_Transit *), _transit_target_cmp);
+
+   _transits_walking = EINA_TRUE;
+   for (i = 0; i < count; i++)
+     {
+        transit = _transits_frame[i];
+        if ((!transit->deleted) && (transit->running) &&
+            (transit->time.paused == 0))
+          _transit_animate(transit, now);
+        transit->walking--;
+        if (transit->walking) continue;
+        if (transit->deleted) _transit_del(transit);
+        else if (transit->effects_pending_del)
+          _transit_remove_dead_effects(transit);
+     }
+   _transits_walking = EINA_FALSE;
+
+end:
+   _transits_frame_stats.transits = count;
+   _transits_frame_stats.time = ecore_time_get() - start;
+
+   if (_transits_running) return ECORE_CALLBACK_RENEW;
+   _transits_animator = NULL;
+   free(_transits_frame);
+   _transits_frame = NULL;
+   _transits_frame_size = 0;
+   return ECORE_CALLBACK_CANCEL;
 }
 
 static void
@@ -450,6 +906,7 @@ elm_transit_add(void)
      }
 
    EINA_MAGIC_SET(transit, ELM_TRANSIT_MAGIC);
+   transit->seq = _transits_seq++;
 
    elm_transit_tween_mode_set(transit, ELM_TRANSIT_TWEEN_MODE_LINEAR);
 
@@ -525,7 +982,7 @@ elm_transit_object_add(Elm_Transit *transit, Evas_Object *obj)
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
    EINA_SAFETY_ON_NULL_RETURN(obj);
 
-   if (transit->animator)
+   if (transit->running)
      {
         if (!evas_object_data_get(obj, _transit_key))
           {
@@ -539,6 +996,7 @@ elm_transit_object_add(Elm_Transit *transit, Evas_Object *obj)
                                   transit);
 
    transit->objs = eina_list_append(transit->objs, obj);
+   transit->objs_array.dirty = EINA_TRUE;
 }
 
 EAPI void
@@ -568,7 +1026,7 @@ elm_transit_event_enabled_set(Elm_Transit *transit, Eina_Bool enabled)
 
    if (transit->event_enabled == enabled) return;
    transit->event_enabled = !!enabled;
-   if (!transit->animator) return;
+   if (!transit->running) return;
 
    EINA_LIST_FOREACH(transit->objs, list, obj)
      evas_object_freeze_events_set(obj, enabled);
@@ -623,6 +1081,7 @@ elm_transit_tween_mode_set(Elm_Transit *transit, Elm_Transit_Tween_Mode tween_mo
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
    transit->tween_mode = tween_mode;
+   transit->tween.dirty = EINA_TRUE;
 }
 
 EAPI Elm_Transit_Tween_Mode
@@ -632,11 +1091,59 @@ elm_transit_tween_mode_get(const Elm_Transit *transit)
    return transit->tween_mode;
 }
 
+EAPI void
+elm_transit_tween_mode_bezier_set(Elm_Transit *transit, double x1, double y1, double x2, double y2)
+{
+   ELM_TRANSIT_CHECK_OR_RETURN(transit);
+   //the curve must stay a function of time
+   if (x1 < 0.0) x1 = 0.0;
+   else if (x1 > 1.0) x1 = 1.0;
+   if (x2 < 0.0) x2 = 0.0;
+   else if (x2 > 1.0) x2 = 1.0;
+   transit->tween.v[0] = x1;
+   transit->tween.v[1] = y1;
+   transit->tween.v[2] = x2;
+   transit->tween.v[3] = y2;
+   elm_transit_tween_mode_set(transit, ELM_TRANSIT_TWEEN_MODE_BEZIER_CURVE);
+}
+
+EAPI void
+elm_transit_tween_mode_spring_set(Elm_Transit *transit, double decay, int bounces)
+{
+   ELM_TRANSIT_CHECK_OR_RETURN(transit);
+   transit->tween.v[0] = decay;
+   transit->tween.v[1] = bounces;
+   elm_transit_tween_mode_set(transit, ELM_TRANSIT_TWEEN_MODE_SPRING);
+}
+
+EAPI void
+elm_transit_tween_table_bake_set(Elm_Transit *transit, Eina_Bool bake)
+{
+   ELM_TRANSIT_CHECK_OR_RETURN(transit);
+   bake = !!bake;
+   if (transit->tween.bake == bake) return;
+   transit->tween.bake = bake;
+   if (bake)
+     transit->tween.dirty = EINA_TRUE;
+   else
+     {
+        free(transit->tween.table);
+        transit->tween.table = NULL;
+     }
+}
+
+EAPI Eina_Bool
+elm_transit_tween_table_bake_get(const Elm_Transit *transit)
+{
+   ELM_TRANSIT_CHECK_OR_RETURN(transit, EINA_FALSE);
+   return transit->tween.bake;
+}
+
 EAPI void
 elm_transit_duration_set(Elm_Transit *transit, double duration)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
-   if (transit->animator)
+   if (transit->running)
      {
         WRN("elm_transit does not allow to set the duration time in operating! : transit=%p", transit);
         return;
@@ -659,9 +1166,6 @@ elm_transit_go(Elm_Transit *transit)
    Eina_List *elist;
    Evas_Object *obj;
 
-   if (transit->animator)
-     ecore_animator_del(transit->animator);
-
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      _transit_obj_data_update(transit, obj);
 
@@ -671,10 +1175,13 @@ elm_transit_go(Elm_Transit *transit)
           evas_object_freeze_events_set(obj, EINA_TRUE);
      }
 
+   if ((transit->tween.bake) && (transit->tween.dirty))
+     _transit_tween_table_build(transit);
+
    transit->time.paused = 0;
    transit->time.delayed = 0;
    transit->time.begin = ecore_loop_time_get();
-   transit->animator = ecore_animator_add(_transit_animate_cb, transit);
+   _transit_run(transit);
 }
 
 EAPI void
@@ -682,20 +1189,18 @@ elm_transit_paused_set(Elm_Transit *transit, Eina_Bool paused)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
 
-   if (!transit->animator) return;
+   if (!transit->running) return;
 
    if (paused)
      {
         if (transit->time.paused > 0)
           return;
-        ecore_animator_freeze(transit->animator);
         transit->time.paused = ecore_loop_time_get();
      }
    else
      {
         if (transit->time.paused == 0)
           return;
-        ecore_animator_thaw(transit->animator);
         transit->time.delayed += (ecore_loop_time_get() - transit->time.paused);
         transit->time.paused = 0;
      }
@@ -726,7 +1231,7 @@ elm_transit_objects_final_state_keep_set(Elm_Transit *transit, Eina_Bool state_k
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
 
    if (transit->state_keep == state_keep) return;
-   if (transit->animator)
+   if (transit->running)
      {
         WRN("elm_transit does not allow to change final state keep mode in operating! : transit=%p", transit);
         return;
@@ -785,6 +1290,13 @@ elm_transit_chain_transits_get(const Elm_Transit * transit)
    return transit->next_chain_transits;
 }
 
+EAPI void
+elm_transit_frame_stats_get(unsigned int *transits, double *time)
+{
+   if (transits) *transits = _transits_frame_stats.transits;
+   if (time) *time = _transits_frame_stats.time;
+}
+
 ///////////////////////////////////////////////////////////////////////////
 //Resizing Effect
 ///////////////////////////////////////////////////////////////////////////
@@ -941,9 +1453,10 @@ _transit_effect_translation_op(Elm_Transit_Effect *effect, Elm_Transit *transit,
 {
    EINA_SAFETY_ON_NULL_RETURN(effect);
    EINA_SAFETY_ON_NULL_RETURN(transit);
-   Evas_Coord x, y;
+   Evas_Coord x, y, ox, oy;
    Elm_Transit_Effect_Translation *translation = effect;
    Elm_Transit_Effect_Translation_Node *translation_node;
+   Elm_Transit_Obj_Data *obj_data;
    Eina_List *elist;
 
    if (!translation->nodes)
@@ -955,6 +1468,14 @@ _transit_effect_translation_op(Elm_Transit_Effect *effect, Elm_Transit *transit,
            + (translation->to.dx * progress);
         y = translation_node->y + translation->from.dy
            + (translation->to.dy * progress);
+        //a map of this frame is in canvas coordinates, move it along
+        obj_data = evas_object_data_get(translation_node->obj, _transit_key);
+        if ((obj_data) && (obj_data->map_dirty))
+          {
+             _transit_obj_geometry_get(translation_node->obj, obj_data,
+                                       &ox, &oy, NULL, NULL);
+             _transit_map_move(obj_data->map, x - ox, y - oy, 0);
+          }
         evas_object_move(translation_node->obj, x, y);
      }
 }
@@ -1017,24 +1538,17 @@ _transit_effect_zoom_op(Elm_Transit_Effect *effect, Elm_Transit *transit , doubl
    Evas_Object *obj;
    Eina_List *elist;
    Elm_Transit_Effect_Zoom *zoom = effect;
+   Elm_Transit_Obj_Data *obj_data;
    Evas_Map *map;
-   Evas_Coord x, y, w, h;
-
-   map = evas_map_new(4);
-   if (!map) return;
 
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      {
-        evas_object_geometry_get(obj, &x, &y, &w, &h);
-        evas_map_util_points_populate_from_object_full(map, obj, zoom->from +
-                                                       (progress * zoom->to));
-        _recover_image_uv(obj, map, EINA_FALSE, EINA_FALSE);
-        evas_map_util_3d_perspective(map, x + (w / 2), y + (h / 2), 0,
-                                     _TRANSIT_FOCAL);
-        evas_object_map_set(obj, map);
-        evas_object_map_enable_set(obj, EINA_TRUE);
+        map = _transit_obj_map_get(obj, &obj_data);
+        if (!map) continue;
+        //zoom by depth, the perspective is applied when the map is set
+        _transit_map_move(map, 0, 0, zoom->from + (progress * zoom->to));
+        obj_data->map_perspective = EINA_TRUE;
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1085,16 +1599,14 @@ _transit_effect_flip_context_free(Elm_Transit_Effect *effect, Elm_Transit *trans
    EINA_SAFETY_ON_NULL_RETURN(effect);
    EINA_SAFETY_ON_NULL_RETURN(transit);
    Elm_Transit_Effect_Flip *flip = effect;
-   Evas_Object *front, *back;
-   int i;
-   int count = eina_list_count(transit->objs);
+   Evas_Object **objs;
+   unsigned int i, count;
 
-   for (i = 0; i < (count - 1); i += 2)
+   objs = _transit_objs_array_get(transit, &count);
+   for (i = 0; (i + 1) < count; i += 2)
      {
-        front = eina_list_nth(transit->objs, i);
-        back = eina_list_nth(transit->objs, i+1);
-        evas_object_map_enable_set(front, EINA_FALSE);
-        evas_object_map_enable_set(back, EINA_FALSE);
+        evas_object_map_enable_set(objs[i], EINA_FALSE);
+        evas_object_map_enable_set(objs[i + 1], EINA_FALSE);
      }
    free(flip);
 }
@@ -1104,27 +1616,23 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
 {
    EINA_SAFETY_ON_NULL_RETURN(effect);
    EINA_SAFETY_ON_NULL_RETURN(transit);
-   Evas_Object *obj, *front, *back;
-   int count, i;
+   Evas_Object **objs, *obj, *front, *back;
+   unsigned int count, i;
    Elm_Transit_Effect_Flip *flip = effect;
+   Elm_Transit_Obj_Data *obj_data;
    Evas_Map *map;
    float degree;
-   Evas_Coord x, y, w, h;
-
-   map = evas_map_new(4);
-   if (!map) return;
+   Evas_Coord w, h, cx, cy, cz;
 
    if (flip->cw) degree = (float)(progress * 180);
    else degree = (float)(progress * -180);
 
-   count = eina_list_count(transit->objs);
+   objs = _transit_objs_array_get(transit, &count);
 
-   for (i = 0; i < (count - 1); i += 2)
+   for (i = 0; (i + 1) < count; i += 2)
      {
-        Evas_Coord half_w, half_h;
-
-        front = eina_list_nth(transit->objs, i);
-        back = eina_list_nth(transit->objs, i+1);
+        front = objs[i];
+        back = objs[i + 1];
 
         if ((degree < 90) && (degree > -90))
           {
@@ -1145,10 +1653,10 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
                }
           }
 
-        evas_map_util_points_populate_from_object_full(map, obj, 0);
-        evas_object_geometry_get(obj, &x, &y, &w, &h);
-        half_w = (w / 2);
-        half_h = (h / 2);
+        map = _transit_obj_map_get(obj, &obj_data);
+        if (!map) continue;
+        _transit_obj_geometry_get(obj, obj_data, NULL, NULL, &w, &h);
+        _transit_map_center_get(map, &cx, &cy, &cz);
 
         if (flip->axis == ELM_TRANSIT_EFFECT_FLIP_AXIS_Y)
           {
@@ -1164,8 +1672,7 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
                }
              else
                _recover_image_uv(obj, map, EINA_FALSE, EINA_FALSE);
-             evas_map_util_3d_rotate(map, 0, degree,
-                                     0, x + half_w, y + half_h, 0);
+             evas_map_util_3d_rotate(map, 0, degree, 0, cx, cy, cz);
           }
         else
           {
@@ -1181,15 +1688,12 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
                }
              else
                _recover_image_uv(obj, map, EINA_FALSE, EINA_FALSE);
-             evas_map_util_3d_rotate(map, degree,
-                                     0, 0, x + half_w, y + half_h, 0);
+             evas_map_util_3d_rotate(map, degree, 0, 0, cx, cy, cz);
           }
-        evas_map_util_3d_perspective(map, x + half_w, y + half_h, 0, _TRANSIT_FOCAL);
+        obj_data->map_perspective = EINA_TRUE;
         evas_object_map_enable_set(front, EINA_TRUE);
         evas_object_map_enable_set(back, EINA_TRUE);
-        evas_object_map_set(obj, map);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1276,10 +1780,11 @@ _resizable_flip_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_ResizableFl
    Eina_List *data_list = NULL;
    Evas_Coord front_x, front_y, front_w, front_h;
    Evas_Coord back_x, back_y, back_w, back_h;
-   int i, count;
+   Evas_Object **objs;
+   unsigned int i, count;
 
-   count = eina_list_count(transit->objs);
-   for (i = 0; i < (count - 1); i += 2)
+   objs = _transit_objs_array_get(transit, &count);
+   for (i = 0; (i + 1) < count; i += 2)
      {
         resizable_flip_node = ELM_NEW(Elm_Transit_Effect_ResizableFlip_Node);
         if (!resizable_flip_node)
@@ -1288,8 +1793,8 @@ _resizable_flip_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_ResizableFl
              return NULL;
           }
 
-        resizable_flip_node->front = eina_list_nth(transit->objs, i);
-        resizable_flip_node->back = eina_list_nth(transit->objs, i+1);
+        resizable_flip_node->front = objs[i];
+        resizable_flip_node->back = objs[i + 1];
 
         evas_object_geometry_get(resizable_flip_node->front,
                                  &front_x, &front_y, &front_w, &front_h);
@@ -1398,18 +1903,16 @@ void
 _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit __UNUSED__, double progress)
 {
    EINA_SAFETY_ON_NULL_RETURN(effect);
+   Elm_Transit_Obj_Data *obj_data;
    Evas_Map *map;
    Evas_Object *obj;
    float x, y, w, h;
    float degree;
-   Evas_Coord half_w, half_h;
+   Evas_Coord ox, oy, ow, oh, cx, cy, cz;
    Elm_Transit_Effect_ResizableFlip *resizable_flip = effect;
    Elm_Transit_Effect_ResizableFlip_Node *resizable_flip_node;
    Eina_List *elist;
 
-   map = evas_map_new(4);
-   if (!map) return;
-
    if (resizable_flip->cw) degree = (float)(progress * 180);
    else degree = (float)(progress * -180);
 
@@ -1438,6 +1941,9 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
                }
           }
 
+        map = _transit_obj_map_get(obj, &obj_data);
+        if (!map) continue;
+
         x = resizable_flip_node->from_pos.x +
            (resizable_flip_node->to_pos.x * progress);
         y = resizable_flip_node->from_pos.y +
@@ -1446,13 +1952,12 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
            (resizable_flip_node->to_size.x * progress);
         h = resizable_flip_node->from_size.y +
            (resizable_flip_node->to_size.y * progress);
-        evas_map_point_coord_set(map, 0, x, y, 0);
-        evas_map_point_coord_set(map, 1, x + w, y, 0);
-        evas_map_point_coord_set(map, 2, x + w, y + h, 0);
-        evas_map_point_coord_set(map, 3, x, y + h, 0);
-
-        half_w = (Evas_Coord)(w / 2);
-        half_h = (Evas_Coord)(h / 2);
+        //scale and move the object geometry onto the interpolated one
+        _transit_obj_geometry_get(obj, obj_data, &ox, &oy, &ow, &oh);
+        if ((ow > 0) && (oh > 0))
+          evas_map_util_zoom(map, w / ow, h / oh, ox, oy);
+        _transit_map_move(map, x - ox, y - oy, 0);
+        _transit_map_center_get(map, &cx, &cy, &cz);
 
         if (resizable_flip->axis == ELM_TRANSIT_EFFECT_FLIP_AXIS_Y)
           {
@@ -1468,8 +1973,7 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
                     _set_image_uv_by_axis_y(map, resizable_flip_node,
                                             EINA_FALSE);
                }
-             evas_map_util_3d_rotate(map, 0, degree,
-                                     0, x + half_w, y + half_h, 0);
+             evas_map_util_3d_rotate(map, 0, degree, 0, cx, cy, cz);
           }
         else
           {
@@ -1485,17 +1989,13 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
                      _set_image_uv_by_axis_x(map, resizable_flip_node,
                                              EINA_FALSE);
                }
-             evas_map_util_3d_rotate(map, degree, 0,
-                                     0, x + half_w, y + half_h, 0);
+             evas_map_util_3d_rotate(map, degree, 0, 0, cx, cy, cz);
           }
 
-        evas_map_util_3d_perspective(map, x + half_w, y + half_h, 0,
-                                     _TRANSIT_FOCAL);
+        obj_data->map_perspective = EINA_TRUE;
         evas_object_map_enable_set(resizable_flip_node->front, EINA_TRUE);
         evas_object_map_enable_set(resizable_flip_node->back, EINA_TRUE);
-        evas_object_map_set(obj, map);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1541,125 +2041,47 @@ struct _Elm_Transit_Effect_Wipe
 };
 
 static void
-_elm_fx_wipe_hide(Evas_Map * map, Elm_Transit_Effect_Wipe_Dir dir, float x, float y, float w, float h, float progress)
+_elm_fx_wipe_hide(Evas_Map *map, Elm_Transit_Effect_Wipe_Dir dir, double progress)
 {
-   float w2, h2;
-
    switch (dir)
      {
       case ELM_TRANSIT_EFFECT_WIPE_DIR_LEFT:
-         w2 = w - (w * progress);
-         h2 = (y + h);
-         evas_map_point_image_uv_set(map, 0, 0, 0);
-         evas_map_point_image_uv_set(map, 1, w2, 0);
-         evas_map_point_image_uv_set(map, 2, w2, h);
-         evas_map_point_image_uv_set(map, 3, 0, h);
-         evas_map_point_coord_set(map, 0, x, y, 0);
-         evas_map_point_coord_set(map, 1, x + w2, y, 0);
-         evas_map_point_coord_set(map, 2, x + w2, h2, 0);
-         evas_map_point_coord_set(map, 3, x, h2, 0);
+         _transit_map_crop(map, 0.0, 0.0, 1.0 - progress, 1.0);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_RIGHT:
-         w2 = (w * progress);
-         h2 = (y + h);
-         evas_map_point_image_uv_set(map, 0, w2, 0);
-         evas_map_point_image_uv_set(map, 1, w, 0);
-         evas_map_point_image_uv_set(map, 2, w, h);
-         evas_map_point_image_uv_set(map, 3, w2, h);
-         evas_map_point_coord_set(map, 0, x + w2, y, 0);
-         evas_map_point_coord_set(map, 1, x + w, y, 0);
-         evas_map_point_coord_set(map, 2, x + w, h2, 0);
-         evas_map_point_coord_set(map, 3, x + w2, h2, 0);
+         _transit_map_crop(map, progress, 0.0, 1.0, 1.0);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_UP:
-         w2 = (x + w);
-         h2 = h - (h * progress);
-         evas_map_point_image_uv_set(map, 0, 0, 0);
-         evas_map_point_image_uv_set(map, 1, w, 0);
-         evas_map_point_image_uv_set(map, 2, w, h2);
-         evas_map_point_image_uv_set(map, 3, 0, h2);
-         evas_map_point_coord_set(map, 0, x, y, 0);
-         evas_map_point_coord_set(map, 1, w2, y, 0);
-         evas_map_point_coord_set(map, 2, w2, y+h2, 0);
-         evas_map_point_coord_set(map, 3, x, y+h2, 0);
+         _transit_map_crop(map, 0.0, 0.0, 1.0, 1.0 - progress);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_DOWN:
-         w2 = (x + w);
-         h2 = (h * progress);
-         evas_map_point_image_uv_set(map, 0, 0, h2);
-         evas_map_point_image_uv_set(map, 1, w, h2);
-         evas_map_point_image_uv_set(map, 2, w, h);
-         evas_map_point_image_uv_set(map, 3, 0, h);
-         evas_map_point_coord_set(map, 0, x, y + h2, 0);
-         evas_map_point_coord_set(map, 1, w2, y + h2, 0);
-         evas_map_point_coord_set(map, 2, w2, y + h, 0);
-         evas_map_point_coord_set(map, 3, x, y + h, 0);
+         _transit_map_crop(map, 0.0, progress, 1.0, 1.0);
          break;
       default:
          break;
      }
-   evas_map_util_3d_perspective(map, x + (w / 2), y + (h / 2), 0, _TRANSIT_FOCAL);
 }
 
 static void
-_elm_fx_wipe_show(Evas_Map *map, Elm_Transit_Effect_Wipe_Dir dir, float x, float y, float w, float h, float progress)
+_elm_fx_wipe_show(Evas_Map *map, Elm_Transit_Effect_Wipe_Dir dir, double progress)
 {
-   float w2, h2;
-
    switch (dir)
      {
       case ELM_TRANSIT_EFFECT_WIPE_DIR_LEFT:
-         w2 = (w - (w * progress));
-         h2 = (y + h);
-         evas_map_point_image_uv_set(map, 0, w2, 0);
-         evas_map_point_image_uv_set(map, 1, w, 0);
-         evas_map_point_image_uv_set(map, 2, w, h);
-         evas_map_point_image_uv_set(map, 3, w2, h);
-         evas_map_point_coord_set(map, 0, x + w2, y, 0);
-         evas_map_point_coord_set(map, 1, w, y, 0);
-         evas_map_point_coord_set(map, 2, w, h2, 0);
-         evas_map_point_coord_set(map, 3, x + w2, h2, 0);
+         _transit_map_crop(map, 1.0 - progress, 0.0, 1.0, 1.0);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_RIGHT:
-         w2 = (w * progress);
-         h2 = (y + h);
-         evas_map_point_image_uv_set(map, 0, 0, 0);
-         evas_map_point_image_uv_set(map, 1, w2, 0);
-         evas_map_point_image_uv_set(map, 2, w2, h);
-         evas_map_point_image_uv_set(map, 3, 0, h);
-         evas_map_point_coord_set(map, 0, x, y, 0);
-         evas_map_point_coord_set(map, 1, x + w2, y, 0);
-         evas_map_point_coord_set(map, 2, x + w2, h2, 0);
-         evas_map_point_coord_set(map, 3, x, h2, 0);
+         _transit_map_crop(map, 0.0, 0.0, progress, 1.0);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_UP:
-         w2 = (x + w);
-         h2 = (h - (h * progress));
-         evas_map_point_image_uv_set(map, 0, 0, h2);
-         evas_map_point_image_uv_set(map, 1, w, h2);
-         evas_map_point_image_uv_set(map, 2, w, h);
-         evas_map_point_image_uv_set(map, 3, 0, h);
-         evas_map_point_coord_set(map, 0, x, y + h2, 0);
-         evas_map_point_coord_set(map, 1, w2, y + h2, 0);
-         evas_map_point_coord_set(map, 2, w2, y + h, 0);
-         evas_map_point_coord_set(map, 3, x, y + h, 0);
+         _transit_map_crop(map, 0.0, 1.0 - progress, 1.0, 1.0);
          break;
       case ELM_TRANSIT_EFFECT_WIPE_DIR_DOWN:
-         w2 = (x + w);
-         h2 = (h * progress);
-         evas_map_point_image_uv_set(map, 0, 0, 0);
-         evas_map_point_image_uv_set(map, 1, w, 0);
-         evas_map_point_image_uv_set(map, 2, w, h2);
-         evas_map_point_image_uv_set(map, 3, 0, h2);
-         evas_map_point_coord_set(map, 0, x, y, 0);
-         evas_map_point_coord_set(map, 1, w2, y, 0);
-         evas_map_point_coord_set(map, 2, w2, y + h2, 0);
-         evas_map_point_coord_set(map, 3, x, y + h2, 0);
+         _transit_map_crop(map, 0.0, 0.0, 1.0, progress);
          break;
       default:
          break;
      }
-   evas_map_util_3d_perspective(map, x + (w / 2), y + (h / 2), 0, _TRANSIT_FOCAL);
 }
 
 static void
@@ -1691,34 +2113,18 @@ _transit_effect_wipe_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
    EINA_SAFETY_ON_NULL_RETURN(transit);
    Elm_Transit_Effect_Wipe *wipe = effect;
    Evas_Map *map;
-   Evas_Coord _x, _y, _w, _h;
    Eina_List *elist;
    Evas_Object *obj;
-   const char *type;
-
-   map = evas_map_new(4);
-   if (!map) return;
 
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      {
-        type = evas_object_type_get(obj);
-        if ((!type) || (strcmp(type, "image")))
-          evas_object_geometry_get(obj, &_x, &_y, &_w, &_h);
-        else
-          {
-             evas_object_image_size_get(obj, &_w, &_h);
-             _x = 0;
-             _y = 0;
-          }
+        map = _transit_obj_map_get(obj, NULL);
+        if (!map) continue;
         if (wipe->type == ELM_TRANSIT_EFFECT_WIPE_TYPE_SHOW)
-          _elm_fx_wipe_show(map, wipe->dir, _x, _y, _w, _h, (float)progress);
+          _elm_fx_wipe_show(map, wipe->dir, progress);
         else
-          _elm_fx_wipe_hide(map, wipe->dir, _x, _y, _w, _h, (float)progress);
-
-        evas_object_map_enable_set(obj, EINA_TRUE);
-        evas_object_map_set(obj, map);
+          _elm_fx_wipe_hide(map, wipe->dir, progress);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1879,9 +2285,10 @@ _fade_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_Fade *fade_data)
 {
    Elm_Transit_Effect_Fade_Node *fade;
    Eina_List *data_list = NULL;
-   int i, count;
+   Evas_Object **objs;
+   unsigned int i, count;
 
-   count = eina_list_count(transit->objs);
+   objs = _transit_objs_array_get(transit, &count);
    for (i = 0; i < count; i += 2)
      {
         fade = ELM_NEW(Elm_Transit_Effect_Fade_Node);
@@ -1891,8 +2298,8 @@ _fade_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_Fade *fade_data)
              return NULL;
           }
 
-        fade->before = eina_list_nth(transit->objs, i);
-        fade->after = eina_list_nth(transit->objs, i+1);
+        fade->before = objs[i];
+        fade->after = ((i + 1) < count) ? objs[i + 1] : NULL;
 
         evas_object_color_get(fade->before,
                               &fade->before_color.r, &fade->before_color.g,
@@ -2070,10 +2477,11 @@ _blend_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_Blend *blend)
 {
    Elm_Transit_Effect_Blend_Node *blend_node;
    Eina_List *data_list = NULL;
-   int i, count;
+   Evas_Object **objs;
+   unsigned int i, count;
 
-   count = eina_list_count(transit->objs);
-   for (i = 0; i < (count - 1); i += 2)
+   objs = _transit_objs_array_get(transit, &count);
+   for (i = 0; (i + 1) < count; i += 2)
      {
         blend_node = ELM_NEW(Elm_Transit_Effect_Blend_Node);
         if (!blend_node)
@@ -2082,8 +2490,8 @@ _blend_nodes_build(Elm_Transit *transit, Elm_Transit_Effect_Blend *blend)
              return NULL;
           }
 
-        blend_node->before = eina_list_nth(transit->objs, i);
-        blend_node->after = eina_list_nth(transit->objs, i + 1);
+        blend_node->before = objs[i];
+        blend_node->after = objs[i + 1];
         evas_object_show(blend_node->before);
         evas_object_show(blend_node->after);
 
@@ -2213,32 +2621,22 @@ _transit_effect_rotation_op(Elm_Transit_Effect *effect, Elm_Transit *transit, do
    EINA_SAFETY_ON_NULL_RETURN(effect);
    EINA_SAFETY_ON_NULL_RETURN(transit);
    Elm_Transit_Effect_Rotation *rotation = effect;
+   Elm_Transit_Obj_Data *obj_data;
    Evas_Map *map;
-   Evas_Coord x, y, w, h;
+   Evas_Coord cx, cy;
    float degree;
-   float half_w, half_h;
    Eina_List *elist;
    Evas_Object *obj;
 
-   map = evas_map_new(4);
-   if (!map) return;
-
+   degree = rotation->from + (float)(progress * rotation->to);
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      {
-        evas_map_util_points_populate_from_object_full(map, obj, 0);
-        degree = rotation->from + (float)(progress * rotation->to);
-
-        evas_object_geometry_get(obj, &x, &y, &w, &h);
-
-        half_w = (float)w * 0.5;
-        half_h = (float)h * 0.5;
-
-        evas_map_util_rotate(map, degree, x + half_w, y + half_h);
-        evas_map_util_3d_perspective(map, x + half_w, y + half_h, 0, _TRANSIT_FOCAL);
-        evas_object_map_enable_set(obj, EINA_TRUE);
-        evas_object_map_set(obj, map);
+        map = _transit_obj_map_get(obj, &obj_data);
+        if (!map) continue;
+        _transit_map_center_get(map, &cx, &cy, NULL);
+        evas_map_util_rotate(map, degree, cx, cy);
+        obj_data->map_perspective = EINA_TRUE;
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -2355,3 +2753,131 @@ elm_transit_effect_image_animation_add(Elm_Transit *transit, Eina_List *images)
                           _transit_effect_image_animation_context_free);
    return effect;
 }
+
+///////////////////////////////////////////////////////////////////////////
+//Keyframe Effect
+///////////////////////////////////////////////////////////////////////////
+typedef struct _Elm_Transit_Effect_Keyframe Elm_Transit_Effect_Keyframe;
+
+struct _Elm_Transit_Effect_Keyframe
+{
+   Elm_Transit_Keyframe *keys;
+   unsigned int count;
+   unsigned int cur; /* segment of the last frame, progress is mostly monotonic */
+};
+
+static int
+_keyframe_cmp(const void *data1, const void *data2)
+{
+   const Elm_Transit_Keyframe *k1 = data1, *k2 = data2;
+
+   if (k1->pos < k2->pos) return -1;
+   if (k1->pos > k2->pos) return 1;
+   return 0;
+}
+
+static void
+_transit_effect_keyframe_context_free(Elm_Transit_Effect *effect, Elm_Transit *transit)
+{
+   EINA_SAFETY_ON_NULL_RETURN(effect);
+   EINA_SAFETY_ON_NULL_RETURN(transit);
+   Elm_Transit_Effect_Keyframe *keyframe = effect;
+   Eina_List *elist;
+   Evas_Object *obj;
+
+   EINA_LIST_FOREACH(transit->objs, elist, obj)
+     evas_object_map_enable_set(obj, EINA_FALSE);
+   free(keyframe->keys);
+   free(keyframe);
+}
+
+static void
+_transit_effect_keyframe_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double progress)
+{
+   EINA_SAFETY_ON_NULL_RETURN(effect);
+   EINA_SAFETY_ON_NULL_RETURN(transit);
+   Elm_Transit_Effect_Keyframe *keyframe = effect;
+   const Elm_Transit_Keyframe *k1, *k2;
+   Elm_Transit_Obj_Data *obj_data;
+   Evas_Map *map;
+   Evas_Coord cx, cy;
+   double t, dx, dy, zoom, degree;
+   unsigned int cur = keyframe->cur;
+   Eina_List *elist;
+   Evas_Object *obj;
+
+   //find the segment holding the progress, starting from the last one
+   while ((cur > 0) && (progress < keyframe->keys[cur].pos)) cur--;
+   while (((cur + 2) < keyframe->count) &&
+          (progress >= keyframe->keys[cur + 1].pos))
+     cur++;
+   keyframe->cur = cur;
+
+   k1 = &keyframe->keys[cur];
+   k2 = &keyframe->keys[cur + 1];
+   if (k2->pos > k1->pos) t = (progress - k1->pos) / (k2->pos - k1->pos);
+   else t = 1.0;
+   if (t < 0.0) t = 0.0;
+   else if (t > 1.0) t = 1.0;
+
+   dx = k1->dx + ((k2->dx - k1->dx) * t);
+   dy = k1->dy + ((k2->dy - k1->dy) * t);
+   zoom = k1->zoom + ((k2->zoom - k1->zoom) * t);
+   degree = k1->degree + ((k2->degree - k1->degree) * t);
+
+   EINA_LIST_FOREACH(transit->objs, elist, obj)
+     {
+        map = _transit_obj_map_get(obj, &obj_data);
+        if (!map) continue;
+        _transit_map_move(map, (Evas_Coord)dx, (Evas_Coord)dy, 0);
+        _transit_map_center_get(map, &cx, &cy, NULL);
+        evas_map_util_zoom(map, zoom, zoom, cx, cy);
+        evas_map_util_rotate(map, degree, cx, cy);
+        obj_data->map_perspective = EINA_TRUE;
+     }
+}
+
+static Elm_Transit_Effect *
+_transit_effect_keyframe_context_new(const Elm_Transit_Keyframe *keyframes, unsigned int count)
+{
+   Elm_Transit_Effect_Keyframe *keyframe;
+
+   keyframe = ELM_NEW(Elm_Transit_Effect_Keyframe);
+   if (!keyframe) return NULL;
+
+   keyframe->keys = malloc(sizeof(Elm_Transit_Keyframe) * count);
+   if (!keyframe->keys)
+     {
+        free(keyframe);
+        return NULL;
+     }
+   memcpy(keyframe->keys, keyframes, sizeof(Elm_Transit_Keyframe) * count);
+   qsort(keyframe->keys, count, sizeof(Elm_Transit_Keyframe), _keyframe_cmp);
+   keyframe->count = count;
+
+   return keyframe;
+}
+
+EAPI Elm_Transit_Effect *
+elm_transit_effect_keyframe_add(Elm_Transit *transit, const Elm_Transit_Keyframe *keyframes, unsigned int count)
+{
+   ELM_TRANSIT_CHECK_OR_RETURN(transit, NULL);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(keyframes, NULL);
+   Elm_Transit_Effect *effect;
+
+   if (count < 2)
+     {
+        ERR("The keyframe effect needs 2 keyframes at least! : transit=%p", transit);
+        return NULL;
+     }
+   effect = _transit_effect_keyframe_context_new(keyframes, count);
+   if (!effect)
+     {
+        ERR("Failed to allocate keyframe effect! : transit=%p", transit);
+        return NULL;
+     }
+   elm_transit_effect_add(transit,
+                          _transit_effect_keyframe_op, effect,
+                          _transit_effect_keyframe_context_free);
+   return effect;
+}
@@ -29,6 +29,7 @@
  * @li @ref elm_transit_effect_wipe_add
  * @li @ref elm_transit_effect_zoom_add
  * @li @ref elm_transit_effect_resizing_add
+ * @li @ref elm_transit_effect_keyframe_add
  *
  * Other transition effects are used to make one object disappear and another
  * object appear on its place. These effects are:
@@ -67,8 +68,12 @@ typedef enum
                                          and stop slowly */
    ELM_TRANSIT_TWEEN_MODE_DECELERATE, /**< Starts fast and decrease
                                          speed over time */
-   ELM_TRANSIT_TWEEN_MODE_ACCELERATE /**< Starts slow and increase speed
+   ELM_TRANSIT_TWEEN_MODE_ACCELERATE, /**< Starts slow and increase speed
                                         over time */
+   ELM_TRANSIT_TWEEN_MODE_BEZIER_CURVE, /**< Follows a cubic bezier curve,
+                                           see elm_transit_tween_mode_bezier_set() */
+   ELM_TRANSIT_TWEEN_MODE_SPRING /**< Overshoots and oscillates before
+                                    stopping, see elm_transit_tween_mode_spring_set() */
 } Elm_Transit_Tween_Mode;
 
 /**
@@ -118,6 +123,21 @@ typedef enum
 typedef struct _Elm_Transit Elm_Transit;
 typedef void                Elm_Transit_Effect;
 
+/**
+ * @typedef Elm_Transit_Keyframe
+ *
+ * A key state of the keyframe effect, see elm_transit_effect_keyframe_add().
+ */
+typedef struct _Elm_Transit_Keyframe Elm_Transit_Keyframe;
+
+struct _Elm_Transit_Keyframe
+{
+   double     pos; /**< Progress of the transit at this key, from 0.0 to 1.0 */
+   Evas_Coord dx, dy; /**< Translation from the object's position */
+   double     zoom; /**< Scale of the object, 1.0 being its size */
+   double     degree; /**< Rotation of the object, clockwise */
+};
+
 /**
  * @typedef Elm_Transit_Effect_Transition_Cb
  *
@@ -435,6 +455,74 @@ EAPI void                   elm_transit_tween_mode_set(Elm_Transit *transit, Elm
  */
 EAPI Elm_Transit_Tween_Mode elm_transit_tween_mode_get(const Elm_Transit *transit);
 
+/**
+ * Set a cubic bezier curve as the transit animation acceleration.
+ *
+ * The curve goes from (0, 0) to (1, 1) with the control points
+ * (@p x1, @p y1) and (@p x2, @p y2), like the CSS cubic-bezier()
+ * timing functions. The tween mode becomes
+ * ELM_TRANSIT_TWEEN_MODE_BEZIER_CURVE.
+ *
+ * @note @p transit can not be NULL
+ *
+ * @param transit The transit object.
+ * @param x1 Time of the first control point, between 0.0 and 1.0.
+ * @param y1 Progress of the first control point.
+ * @param x2 Time of the second control point, between 0.0 and 1.0.
+ * @param y2 Progress of the second control point.
+ *
+ * @ingroup Transit
+ */
+EAPI void                   elm_transit_tween_mode_bezier_set(Elm_Transit *transit, double x1, double y1, double x2, double y2);
+
+/**
+ * Set a spring as the transit animation acceleration.
+ *
+ * The tween mode becomes ELM_TRANSIT_TWEEN_MODE_SPRING.
+ *
+ * @note @p transit can not be NULL
+ *
+ * @param transit The transit object.
+ * @param decay How fast the oscillations fade out, 1.0 being a
+ * linear decay and bigger values a faster one.
+ * @param bounces The number of oscillations.
+ *
+ * @ingroup Transit
+ */
+EAPI void                   elm_transit_tween_mode_spring_set(Elm_Transit *transit, double decay, int bounces);
+
+/**
+ * Bake the tween mode of the transit into a lookup table.
+ *
+ * When enabled, the acceleration curve is sampled once when the
+ * transit starts, and every frame only looks the progress up in the
+ * table. This is worth it for the bezier and spring modes, which are
+ * otherwise solved on every frame.
+ *
+ * @note @p transit can not be NULL
+ *
+ * @param transit The transit object.
+ * @param bake EINA_TRUE to use a lookup table. Default is EINA_FALSE.
+ *
+ * @ingroup Transit
+ */
+EAPI void                   elm_transit_tween_table_bake_set(Elm_Transit *transit, Eina_Bool bake);
+
+/**
+ * Get whether the tween mode of the transit is baked into a lookup table.
+ *
+ * @see elm_transit_tween_table_bake_set()
+ *
+ * @note @p transit can not be NULL
+ *
+ * @param transit The transit object.
+ * @return EINA_TRUE if a lookup table is used. If @p transit is NULL
+ * EINA_FALSE is returned.
+ *
+ * @ingroup Transit
+ */
+EAPI Eina_Bool              elm_transit_tween_table_bake_get(const Elm_Transit *transit);
+
 /**
  * Set the transit animation time
  *
@@ -564,6 +652,20 @@ EAPI void                   elm_transit_chain_transit_del(Elm_Transit *transit,
  */
 EAPI Eina_List             *elm_transit_chain_transits_get(const Elm_Transit *transit);
 
+/**
+ * Get the cost of the last animation frame of the transits.
+ *
+ * All the running transits are advanced together, once per animator
+ * tick. This reports how many transits were advanced in the last tick
+ * and how long it took, in seconds.
+ *
+ * @param transits Where to store the number of transits advanced, or @c NULL
+ * @param time Where to store the time spent, or @c NULL
+ *
+ * @ingroup Transit
+ */
+EAPI void                   elm_transit_frame_stats_get(unsigned int *transits, double *time);
+
 /**
  * Add the Resizing Effect to Elm_Transit.
  *
@@ -819,6 +921,41 @@ EAPI Elm_Transit_Effect    *elm_transit_effect_rotation_add(Elm_Transit *transit
  * @ingroup Transit
  */
 EAPI Elm_Transit_Effect    *elm_transit_effect_image_animation_add(Elm_Transit *transit, Eina_List *images);
+
+/**
+ * Add the Keyframe Effect to Elm_Transit.
+ *
+ * @note This API is one of the facades. It creates keyframe effect context
+ * and add it's required APIs to elm_transit_effect_add.
+ *
+ * The objects are translated, zoomed and rotated through the given key
+ * states, interpolating linearly between two consecutive keys. This
+ * makes multi-step animations possible without chaining transits.
+ *
+ * Example:
+ * @code
+ * Elm_Transit_Keyframe keys[] = {
+ *    { 0.0,   0,  0, 1.0,   0 },
+ *    { 0.5, 100,  0, 1.5,  90 },
+ *    { 1.0, 100, 80, 1.0, 180 }
+ * };
+ * elm_transit_effect_keyframe_add(transit, keys, 3);
+ * @endcode
+ *
+ * @see elm_transit_effect_add()
+ *
+ * @param transit Transit object.
+ * @param keyframes The key states. They are copied, and sorted by position.
+ * @param count The number of key states, at least 2.
+ * @return Keyframe effect context data.
+ *
+ * @ingroup Transit
+ * @warning It is highly recommended just create a transit with this effect when
+ * the window that the objects of the transit belongs has already been created.
+ * This is because this effect needs the geometry information about the objects,
+ * and if the window was not created yet, it can get a wrong information.
+ */
+EAPI Elm_Transit_Effect    *elm_transit_effect_keyframe_add(Elm_Transit *transit, const Elm_Transit_Keyframe *keyframes, unsigned int count);
 /**
  * @}
  */
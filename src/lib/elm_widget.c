@@ -20,6 +20,7 @@ typedef struct _Smart_Data        Smart_Data;
 typedef struct _Edje_Signal_Data  Edje_Signal_Data;
 typedef struct _Elm_Event_Cb_Data Elm_Event_Cb_Data;
 typedef struct _Elm_Translate_String_Data Elm_Translate_String_Data;
+typedef struct _Elm_Focus_Node    Elm_Focus_Node;
 
 struct _Smart_Data
 {
@@ -115,9 +116,13 @@ struct _Smart_Data
    Eina_Bool    is_mirrored : 1;
    Eina_Bool    mirrored_auto_mode : 1;   /* This is TRUE by default */
    Eina_Bool    still_in : 1;
+   Eina_Bool    theme_deferred : 1;
 
+   Eina_List   *theme_node, *cache_node;
    Eina_List   *focus_chain;
    Eina_List   *event_cb;
+   Elm_Focus_Node *focus_first, *focus_last;
+   Eina_Bool    focus_list_dirty : 1;
 };
 
 struct _Edje_Signal_Data
@@ -142,6 +147,26 @@ struct _Elm_Translate_String_Data
    const char *string;
 };
 
+/* Flattened focus order of a top widget, a list of nodes in ELM_FOCUS_NEXT
+ * order. Each widget taking part owns a span of it: one LEAF node if it is
+ * focusable itself and has no focus next hook, or BEGIN and END markers
+ * around the spans its hook walks through otherwise. */
+enum
+{
+   FOCUS_NODE_LEAF,
+   FOCUS_NODE_BEGIN,
+   FOCUS_NODE_END
+};
+
+struct _Elm_Focus_Node
+{
+   Elm_Focus_Node *prev, *next;
+   Evas_Object    *obj;
+   unsigned char   type;
+   Eina_Bool       dirty : 1; /* BEGIN only: hook has to be walked again */
+   Eina_Bool       reuse : 1; /* span kept aside while its parent is patched */
+};
+
 /* local subsystem functions */
 static void _smart_reconfigure(Smart_Data *sd);
 static void _smart_add(Evas_Object *obj);
@@ -179,6 +204,41 @@ static Eina_List  *widtypes = NULL;
 
 static unsigned int focus_order = 0;
 
+/* widget item pools, see _elm_widget_item_new() */
+#define ITEM_POOL_MAX 256
+
+typedef struct _Item_Pool_View Item_Pool_View;
+
+struct _Elm_Widget_Item_Pool
+{
+   const char                *type;
+   size_t                     size;
+   Eina_Trash                *items;
+   Eina_List                 *views;
+   unsigned int               max;
+   Elm_Widget_Item_Pool_Stats stats;
+};
+
+struct _Item_Pool_View
+{
+   Elm_Widget_Item_Pool *pool;
+   Evas_Object          *obj;
+   Evas                 *evas;
+   Elm_Theme            *theme;
+   const char           *group;
+};
+
+static Eina_Hash *item_pools = NULL;
+
+/* staged retheme/recache, see _elm_widget_theme_job_add() */
+static struct
+{
+   Eina_List      *widgets; /* children before their parents */
+   Eina_List      *caches; /* windows whose evas caches need a flush */
+   Ecore_Animator *animator;
+   unsigned int    total, done;
+} theme_job = { NULL, NULL, NULL, 0, 0 };
+
 // internal funcs
 static inline Eina_Bool
 _elm_widget_is(const Evas_Object *obj)
@@ -216,6 +276,323 @@ _focus_parents(Evas_Object *obj)
      }
 }
 
+/* set while a focus next hook is walked to collect its part of the focus
+ * order, see _focus_list_hook_walk() */
+static const Evas_Object *_focus_collect_obj = NULL;
+static Elm_Focus_Node *_focus_collect_tail = NULL;
+
+static void _focus_list_collect(Evas_Object *obj);
+
+static Elm_Focus_Node *
+_focus_node_add(Evas_Object  *obj,
+                unsigned char type)
+{
+   Elm_Focus_Node *node;
+
+   node = calloc(1, sizeof(Elm_Focus_Node));
+   if (!node) return NULL;
+   node->obj = obj;
+   node->type = type;
+   if (_focus_collect_tail)
+     {
+        node->prev = _focus_collect_tail;
+        node->next = _focus_collect_tail->next;
+        if (node->next) node->next->prev = node;
+        _focus_collect_tail->next = node;
+     }
+   _focus_collect_tail = node;
+   return node;
+}
+
+static void
+_focus_nodes_unlink(Elm_Focus_Node *first,
+                    Elm_Focus_Node *last)
+{
+   if (first->prev) first->prev->next = last->next;
+   if (last->next) last->next->prev = first->prev;
+   first->prev = NULL;
+   last->next = NULL;
+}
+
+static void
+_focus_nodes_link(Elm_Focus_Node *first,
+                  Elm_Focus_Node *last)
+{
+   first->prev = _focus_collect_tail;
+   last->next = _focus_collect_tail->next;
+   if (last->next) last->next->prev = last;
+   _focus_collect_tail->next = first;
+   _focus_collect_tail = last;
+}
+
+static void
+_focus_nodes_free(Elm_Focus_Node *first)
+{
+   Elm_Focus_Node *node;
+   Smart_Data *sd;
+
+   while ((node = first))
+     {
+        first = node->next;
+        sd = evas_object_smart_data_get(node->obj);
+        if ((sd) && (sd->focus_first == node))
+          {
+             sd->focus_first = NULL;
+             sd->focus_last = NULL;
+          }
+        free(node);
+     }
+}
+
+/* drops the span of obj (and so of its whole sub tree) from the focus
+ * order, for widgets that can no longer get focus */
+static void
+_focus_list_remove(Evas_Object *obj)
+{
+   Smart_Data *sd = evas_object_smart_data_get(obj);
+   Elm_Focus_Node *first;
+
+   if ((!sd) || (!sd->focus_first)) return;
+   first = sd->focus_first;
+   _focus_nodes_unlink(first, sd->focus_last);
+   _focus_nodes_free(first);
+}
+
+/* marks the nearest span with a hook walk containing obj as to be walked
+ * again, for widgets that may have to be added or moved */
+static void
+_focus_list_dirty(Evas_Object *obj)
+{
+   Elm_Focus_Node *node = NULL;
+   Smart_Data *sd;
+
+   while ((obj) && (_elm_widget_is(obj)))
+     {
+        sd = evas_object_smart_data_get(obj);
+        if (!sd) return;
+        if ((!node) && (sd->focus_first) &&
+            (sd->focus_first->type == FOCUS_NODE_BEGIN))
+          node = sd->focus_first;
+        if (!sd->parent_obj)
+          {
+             if ((node) && (sd->focus_first))
+               {
+                  node->dirty = EINA_TRUE;
+                  sd->focus_list_dirty = EINA_TRUE;
+               }
+             return;
+          }
+        obj = sd->parent_obj;
+     }
+}
+
+/* the way obj itself takes part in the focus order changed */
+static void
+_focus_list_reset(Evas_Object *obj)
+{
+   Smart_Data *sd = evas_object_smart_data_get(obj);
+
+   if (!sd) return;
+   if (!sd->focus_next_func) _focus_list_remove(obj);
+   _focus_list_dirty(obj);
+}
+
+/* Walks the focus next hook of obj in ELM_FOCUS_NEXT direction with no
+ * focus anywhere, appending the spans of everything it reaches through
+ * elm_widget_focus_next_get() instead of descending into them. */
+static void
+_focus_list_hook_walk(Evas_Object *obj,
+                      Smart_Data  *sd)
+{
+   const Evas_Object *owner = _focus_collect_obj;
+   Elm_Focus_Node *begin = _focus_collect_tail;
+   Evas_Object *next = NULL;
+
+   _focus_collect_obj = obj;
+   sd->focus_next_func(obj, ELM_FOCUS_NEXT, &next);
+   _focus_collect_obj = owner;
+   /* windows return themselves when nothing else was found */
+   if (next == obj)
+     {
+        if (_focus_collect_tail == begin)
+          _focus_node_add(obj, FOCUS_NODE_LEAF);
+     }
+   else if (next)
+     _focus_list_collect(next);
+}
+
+/* appends the span of obj to the one being collected */
+static void
+_focus_list_collect(Evas_Object *obj)
+{
+   Elm_Focus_Node *first, *node;
+   Smart_Data *sd;
+
+   if (!_elm_widget_is(obj)) return;
+   sd = evas_object_smart_data_get(obj);
+   if ((!sd) || (!evas_object_visible_get(obj)) || (sd->disabled) ||
+       (sd->tree_unfocusable))
+     return;
+   if ((first = sd->focus_first))
+     {
+        /* reached twice in one walk */
+        if (!first->reuse) return;
+        /* unchanged sub tree, move its span back in */
+        first->reuse = EINA_FALSE;
+        _focus_nodes_unlink(first, sd->focus_last);
+        _focus_nodes_link(first, sd->focus_last);
+        return;
+     }
+   if (sd->focus_next_func)
+     {
+        first = _focus_node_add(obj, FOCUS_NODE_BEGIN);
+        if (!first) return;
+        sd->focus_first = first;
+        _focus_list_hook_walk(obj, sd);
+        sd->focus_last = _focus_node_add(obj, FOCUS_NODE_END);
+        if (!sd->focus_last)
+          {
+             node = _focus_collect_tail;
+             _focus_collect_tail = first->prev;
+             _focus_nodes_unlink(first, node);
+             _focus_nodes_free(first);
+          }
+     }
+   else if (sd->can_focus)
+     {
+        sd->focus_first = _focus_node_add(obj, FOCUS_NODE_LEAF);
+        sd->focus_last = sd->focus_first;
+     }
+}
+
+/* walks the hook of a dirty span again, keeping the spans of its direct
+ * children that are still reached */
+static void
+_focus_list_patch(Evas_Object *obj,
+                  Smart_Data  *sd)
+{
+   Elm_Focus_Node hold, *node, *tail = _focus_collect_tail;
+   Smart_Data *sd2;
+
+   memset(&hold, 0, sizeof(hold));
+   sd->focus_first->dirty = EINA_FALSE;
+   if (sd->focus_first->next != sd->focus_last)
+     {
+        node = sd->focus_first->next;
+        _focus_nodes_unlink(node, sd->focus_last->prev);
+        hold.next = node;
+        node->prev = &hold;
+        for (; node; node = node->next)
+          {
+             node->reuse = EINA_TRUE;
+             if (node->type != FOCUS_NODE_BEGIN) continue;
+             sd2 = evas_object_smart_data_get(node->obj);
+             if ((sd2) && (sd2->focus_last)) node = sd2->focus_last;
+          }
+     }
+   _focus_collect_tail = sd->focus_first;
+   _focus_list_hook_walk(obj, sd);
+   _focus_collect_tail = tail;
+   if (hold.next)
+     {
+        hold.next->prev = NULL;
+        _focus_nodes_free(hold.next);
+     }
+}
+
+/* brings the focus order of top widget obj up to date, only the dirty
+ * spans are walked again */
+static Eina_Bool
+_focus_list_update(Evas_Object *obj,
+                   Smart_Data  *sd)
+{
+   Elm_Focus_Node *node;
+   Smart_Data *sd2;
+
+   if (!sd->focus_next_func) return EINA_FALSE;
+   if (!sd->focus_first)
+     {
+        _focus_collect_tail = NULL;
+        node = _focus_node_add(obj, FOCUS_NODE_BEGIN);
+        if (!node) return EINA_FALSE;
+        sd->focus_last = _focus_node_add(obj, FOCUS_NODE_END);
+        _focus_collect_tail = NULL;
+        if (!sd->focus_last)
+          {
+             free(node);
+             return EINA_FALSE;
+          }
+        sd->focus_first = node;
+        sd->focus_first->dirty = EINA_TRUE;
+        sd->focus_list_dirty = EINA_TRUE;
+     }
+   if (!sd->focus_list_dirty) return EINA_TRUE;
+   sd->focus_list_dirty = EINA_FALSE;
+   /* patched spans are scanned too, reused ones may hold dirty spans */
+   for (node = sd->focus_first; node; node = node->next)
+     {
+        if ((node->type != FOCUS_NODE_BEGIN) || (!node->dirty)) continue;
+        sd2 = evas_object_smart_data_get(node->obj);
+        if (sd2) _focus_list_patch(node->obj, sd2);
+     }
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_focus_target_valid(const Evas_Object *top,
+                    const Evas_Object *target)
+{
+   Smart_Data *sd;
+   const Evas_Object *o;
+
+   if (!elm_widget_can_focus_get(target)) return EINA_FALSE;
+   for (o = target; o; o = sd->parent_obj)
+     {
+        if (!_elm_widget_is(o)) return EINA_FALSE;
+        sd = evas_object_smart_data_get(o);
+        if (!sd) return EINA_FALSE;
+        if ((!evas_object_visible_get(o)) || (sd->disabled) ||
+            (sd->tree_unfocusable))
+          return EINA_FALSE;
+        if (o == top) return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
+/* next focus target of top widget obj from its focus order, NULL if the
+ * focused object is not in it */
+static Evas_Object *
+_focus_list_next_get(Evas_Object        *obj,
+                     Smart_Data         *sd,
+                     Elm_Focus_Direction dir)
+{
+   Evas_Object *focused;
+   Elm_Focus_Node *start, *node;
+   Smart_Data *sd2;
+
+   focused = elm_widget_focused_object_get(obj);
+   if (!focused) return NULL;
+   sd2 = evas_object_smart_data_get(focused);
+   if ((!sd2) || (!(start = sd2->focus_first))) return NULL;
+   if (start->type == FOCUS_NODE_BEGIN) start = start->next;
+   if ((start->type != FOCUS_NODE_LEAF) || (start->obj != focused))
+     return NULL;
+
+   node = start;
+   do
+     {
+        if (dir == ELM_FOCUS_NEXT)
+          node = node->next ? node->next : sd->focus_first;
+        else
+          node = node->prev ? node->prev : sd->focus_last;
+     }
+   while ((node->type != FOCUS_NODE_LEAF) && (node != start));
+
+   /* hooks may depend on state the order is not told about */
+   if (!_focus_target_valid(obj, node->obj)) return NULL;
+   return node->obj;
+}
+
 static void
 _sub_obj_del(void        *data,
              Evas        *e __UNUSED__,
@@ -402,9 +779,156 @@ _elm_object_focus_chain_del_cb(void        *data,
    Smart_Data *sd = data;
 
    sd->focus_chain = eina_list_remove(sd->focus_chain, obj);
+   _focus_list_dirty(sd->obj);
+}
+
+static void
+_item_pool_view_del(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Item_Pool_View *pv = data;
+
+   pv->pool->views = eina_list_remove(pv->pool->views, pv);
+   pv->pool->stats.views--;
+   eina_stringshare_del(pv->group);
+   free(pv);
+}
+
+static void
+_item_pool_views_flush(Elm_Widget_Item_Pool *pool)
+{
+   Item_Pool_View *pv;
+
+   while (pool->views)
+     {
+        pv = eina_list_data_get(pool->views);
+        evas_object_del(pv->obj);
+     }
+}
+
+static void
+_item_pool_items_flush(Elm_Widget_Item_Pool *pool)
+{
+   void *item;
+
+   EINA_TRASH_CLEAN(&pool->items, item) free(item);
+   pool->stats.items = 0;
+}
+
+static void
+_item_pool_free(void *data)
+{
+   Elm_Widget_Item_Pool *pool = data;
+
+   _item_pool_views_flush(pool);
+   _item_pool_items_flush(pool);
+   eina_stringshare_del(pool->type);
+   free(pool);
+}
+
+static Elm_Widget_Item_Pool *
+_item_pool_get(const char *type, Eina_Bool create)
+{
+   Elm_Widget_Item_Pool *pool;
+
+   if (!type) return NULL;
+   if (!item_pools)
+     {
+        if (!create) return NULL;
+        item_pools = eina_hash_string_superfast_new(_item_pool_free);
+     }
+   pool = eina_hash_find(item_pools, type);
+   if ((pool) || (!create)) return pool;
+   pool = calloc(1, sizeof(Elm_Widget_Item_Pool));
+   if (!pool) return NULL;
+   pool->type = eina_stringshare_add(type);
+   pool->max = ITEM_POOL_MAX;
+   eina_hash_add(item_pools, type, pool);
+   return pool;
+}
+
+/* Park the base view of @p item in its pool. The widget has already
+ * taken it out of its containers and dropped its own callbacks. */
+static Eina_Bool
+_item_pool_view_put(Elm_Widget_Item *item)
+{
+   Elm_Widget_Item_Pool *pool = item->pool;
+   Item_Pool_View *pv;
+   Evas_Object *parent;
+   const char *group = NULL;
+
+   if (!pool) return EINA_FALSE;
+   if (pool->stats.views >= pool->max)
+     {
+        pool->stats.dropped++;
+        return EINA_FALSE;
+     }
+   edje_object_file_get(item->view, NULL, &group);
+   if (!group) return EINA_FALSE;
+   pv = calloc(1, sizeof(Item_Pool_View));
+   if (!pv) return EINA_FALSE;
+   pv->pool = pool;
+   pv->obj = item->view;
+   pv->evas = evas_object_evas_get(item->view);
+   pv->theme = elm_widget_theme_get(item->widget);
+   pv->group = eina_stringshare_add(group);
+   /* views packed in an internal elm_box belong to the box, not the
+    * widget, and must leave its subobjs before they get reused */
+   parent = evas_object_data_get(item->view, "elm-parent");
+   if ((parent) && (_elm_widget_is(parent)))
+     elm_widget_sub_object_del(parent, item->view);
+   evas_object_hide(item->view);
+   evas_object_move(item->view, -9999, -9999);
+   evas_object_event_callback_add(item->view, EVAS_CALLBACK_DEL,
+                                  _item_pool_view_del, pv);
+   pool->views = eina_list_prepend(pool->views, pv);
+   pool->stats.views++;
+   item->view = NULL;
+   return EINA_TRUE;
+}
+
+static Evas_Object *
+_item_pool_view_take(Elm_Widget_Item_Pool *pool, Evas *e, Elm_Theme *th, const char *group)
+{
+   const Eina_List *l;
+   Item_Pool_View *pv;
+   Evas_Object *view;
+
+   EINA_LIST_FOREACH(pool->views, l, pv)
+     {
+        if ((pv->evas != e) || (pv->theme != th) || (strcmp(pv->group, group)))
+          continue;
+        view = pv->obj;
+        evas_object_event_callback_del_full(view, EVAS_CALLBACK_DEL,
+                                            _item_pool_view_del, pv);
+        _item_pool_view_del(pv, NULL, NULL, NULL);
+        return view;
+     }
+   return NULL;
+}
+
+static Eina_Bool
+_item_pool_views_flush_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   _item_pool_views_flush(data);
+   return EINA_TRUE;
 }
 
 // exposed util funcs to elm
+void
+_elm_widget_item_pool_views_flush(void)
+{
+   if (!item_pools) return;
+   eina_hash_foreach(item_pools, _item_pool_views_flush_cb, NULL);
+}
+
+void
+_elm_widget_item_pool_shutdown(void)
+{
+   if (!item_pools) return;
+   eina_hash_free(item_pools);
+   item_pools = NULL;
+}
+
 void
 _elm_widget_type_clear(void)
 {
@@ -646,23 +1170,63 @@ elm_widget_signal_callback_del_hook_set(Evas_Object *obj,
    sd->callback_del_func = func;
 }
 
+static void
+_theme_apply(Smart_Data *sd)
+{
+   const Eina_List *l;
+   Elm_Tooltip *tt;
+   Elm_Cursor *cur;
+   ELM_PERF_SPAN_BEGIN(t0);
+
+   EINA_LIST_FOREACH(sd->tooltips, l, tt) elm_tooltip_theme(tt);
+   EINA_LIST_FOREACH(sd->cursors, l, cur) elm_cursor_theme(cur);
+   if (sd->theme_func) sd->theme_func(sd->obj);
+   ELM_PERF_SPAN_END(t0, sd->type, ELM_PERF_SITE_THEME);
+}
+
+static void
+_theme_job_forget(Smart_Data *sd)
+{
+   sd->theme_deferred = EINA_FALSE;
+   if (!sd->theme_node) return;
+   theme_job.widgets = eina_list_remove_list(theme_job.widgets, sd->theme_node);
+   sd->theme_node = NULL;
+   theme_job.done++;
+}
+
+static Eina_Bool
+_theme_forced(Smart_Data *sd, Elm_Theme *th)
+{
+   Elm_Theme *th2, *thdef;
+
+   thdef = elm_theme_default_get();
+   if (!th) th = thdef;
+   th2 = sd->theme;
+   if (!th2) th2 = thdef;
+   while (th2)
+     {
+        if (th2 == th) return EINA_TRUE;
+        if (th2 == thdef) break;
+        th2 = th2->ref_theme;
+        if (!th2) th2 = thdef;
+     }
+   return EINA_FALSE;
+}
+
 EAPI Eina_Bool
 elm_widget_theme(Evas_Object *obj)
 {
    const Eina_List *l;
    Evas_Object *child;
-   Elm_Tooltip *tt;
-   Elm_Cursor *cur;
    Eina_Bool ret = EINA_TRUE;
 
    API_ENTRY return EINA_FALSE;
+   _theme_job_forget(sd);
    EINA_LIST_FOREACH(sd->subobjs, l, child) ret &= elm_widget_theme(child);
    if (sd->resize_obj && _elm_widget_is(sd->resize_obj))
      ret &= elm_widget_theme(sd->resize_obj);
    if (sd->hover_obj) ret &= elm_widget_theme(sd->hover_obj);
-   EINA_LIST_FOREACH(sd->tooltips, l, tt) elm_tooltip_theme(tt);
-   EINA_LIST_FOREACH(sd->cursors, l, cur) elm_cursor_theme(cur);
-   if (sd->theme_func) sd->theme_func(obj);
+   _theme_apply(sd);
 
    return ret;
 }
@@ -674,37 +1238,186 @@ elm_widget_theme_specific(Evas_Object *obj,
 {
    const Eina_List *l;
    Evas_Object *child;
-   Elm_Tooltip *tt;
-   Elm_Cursor *cur;
-   Elm_Theme *th2, *thdef;
 
    API_ENTRY return;
-   thdef = elm_theme_default_get();
-   if (!th) th = thdef;
-   if (!force)
-     {
-        th2 = sd->theme;
-        if (!th2) th2 = thdef;
-        while (th2)
-          {
-             if (th2 == th)
-               {
-                  force = EINA_TRUE;
-                  break;
-               }
-             if (th2 == thdef) break;
-             th2 = th2->ref_theme;
-             if (!th2) th2 = thdef;
-          }
-     }
+   if (!th) th = elm_theme_default_get();
+   if (!force) force = _theme_forced(sd, th);
    if (!force) return;
+   _theme_job_forget(sd);
    EINA_LIST_FOREACH(sd->subobjs, l, child)
      elm_widget_theme_specific(child, th, force);
    if (sd->resize_obj) elm_widget_theme(sd->resize_obj);
    if (sd->hover_obj) elm_widget_theme(sd->hover_obj);
-   EINA_LIST_FOREACH(sd->tooltips, l, tt) elm_tooltip_theme(tt);
-   EINA_LIST_FOREACH(sd->cursors, l, cur) elm_cursor_theme(cur);
-   if (sd->theme_func) sd->theme_func(obj);
+   _theme_apply(sd);
+}
+
+static void
+_theme_job_queue(Evas_Object *obj, Elm_Theme *th, Eina_Bool force)
+{
+   const Eina_List *l;
+   Evas_Object *child;
+
+   API_ENTRY return;
+   if ((!force) && (th)) force = _theme_forced(sd, th);
+   if ((!force) && (th)) return;
+   if ((sd->theme_node) || (sd->theme_deferred)) return;
+   /* hidden subtrees are themed when they get shown again */
+   if (!evas_object_visible_get(obj))
+     {
+        sd->theme_deferred = EINA_TRUE;
+        return;
+     }
+   EINA_LIST_FOREACH(sd->subobjs, l, child)
+     _theme_job_queue(child, th, force);
+   if (sd->resize_obj && _elm_widget_is(sd->resize_obj))
+     _theme_job_queue(sd->resize_obj, NULL, EINA_TRUE);
+   if (sd->hover_obj) _theme_job_queue(sd->hover_obj, NULL, EINA_TRUE);
+   theme_job.widgets = eina_list_append(theme_job.widgets, obj);
+   sd->theme_node = eina_list_last(theme_job.widgets);
+   theme_job.total++;
+}
+
+static Eina_Bool
+_theme_job_step(void)
+{
+   Evas_Object *obj;
+   Smart_Data *sd;
+
+   if (theme_job.caches)
+     {
+        obj = eina_list_data_get(theme_job.caches);
+        sd = evas_object_smart_data_get(obj);
+        theme_job.caches = eina_list_remove_list(theme_job.caches,
+                                                 theme_job.caches);
+        sd->cache_node = NULL;
+        theme_job.done++;
+        _elm_recache_win(obj);
+        return EINA_TRUE;
+     }
+   if (theme_job.widgets)
+     {
+        obj = eina_list_data_get(theme_job.widgets);
+        sd = evas_object_smart_data_get(obj);
+        theme_job.widgets = eina_list_remove_list(theme_job.widgets,
+                                                  theme_job.widgets);
+        sd->theme_node = NULL;
+        theme_job.done++;
+        _theme_apply(sd);
+        return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
+static void
+_theme_job_end(void)
+{
+   theme_job.total = theme_job.done = 0;
+   _elm_theme_job_done();
+}
+
+static Eina_Bool
+_theme_job_cb(void *data __UNUSED__)
+{
+   double t0, budget;
+
+   /* keep at least half of each frame for rendering and input */
+   budget = ecore_animator_frametime_get() / 2.0;
+   t0 = ecore_time_get();
+   do
+     {
+        if (!_theme_job_step())
+          {
+             theme_job.animator = NULL;
+             _theme_job_end();
+             return ECORE_CALLBACK_CANCEL;
+          }
+     }
+   while ((ecore_time_get() - t0) < budget);
+   return ECORE_CALLBACK_RENEW;
+}
+
+static void
+_theme_job_start(void)
+{
+   if (theme_job.animator) return;
+   if ((!theme_job.widgets) && (!theme_job.caches)) return;
+   theme_job.animator = ecore_animator_add(_theme_job_cb, NULL);
+}
+
+/* Queue a retheme of the visible part of @p obj's tree, or of the part
+ * using @p th only when it is not NULL, to be applied over the next frames
+ * within a time budget. */
+void
+_elm_widget_theme_job_add(Evas_Object *obj, Elm_Theme *th)
+{
+   if (!_elm_widget_is(obj)) return;
+   _theme_job_queue(obj, th, EINA_FALSE);
+   _theme_job_start();
+}
+
+/* Queue a flush of the evas caches of the window @p obj, visible windows
+ * first. */
+void
+_elm_widget_cache_job_add(Evas_Object *obj)
+{
+   API_ENTRY return;
+   if (sd->cache_node) return;
+   if (evas_object_visible_get(obj))
+     {
+        theme_job.caches = eina_list_prepend(theme_job.caches, obj);
+        sd->cache_node = theme_job.caches;
+     }
+   else
+     {
+        theme_job.caches = eina_list_append(theme_job.caches, obj);
+        sd->cache_node = eina_list_last(theme_job.caches);
+     }
+   theme_job.total++;
+   _theme_job_start();
+}
+
+void
+_elm_widget_theme_job_finish(void)
+{
+   if (theme_job.animator)
+     {
+        ecore_animator_del(theme_job.animator);
+        theme_job.animator = NULL;
+     }
+   else if (!theme_job.total) return;
+   while (_theme_job_step());
+   _theme_job_end();
+}
+
+double
+_elm_widget_theme_job_progress_get(void)
+{
+   if (!theme_job.total) return 1.0;
+   return (double)theme_job.done / (double)theme_job.total;
+}
+
+void
+_elm_widget_theme_job_shutdown(void)
+{
+   Evas_Object *obj;
+   Smart_Data *sd;
+
+   if (theme_job.animator)
+     {
+        ecore_animator_del(theme_job.animator);
+        theme_job.animator = NULL;
+     }
+   EINA_LIST_FREE(theme_job.widgets, obj)
+     {
+        sd = evas_object_smart_data_get(obj);
+        sd->theme_node = NULL;
+     }
+   EINA_LIST_FREE(theme_job.caches, obj)
+     {
+        sd = evas_object_smart_data_get(obj);
+        sd->cache_node = NULL;
+     }
+   theme_job.total = theme_job.done = 0;
 }
 
 /**
@@ -724,7 +1437,9 @@ elm_widget_focus_next_hook_set(Evas_Object *obj,
                                                    Evas_Object       **next))
 {
    API_ENTRY return;
+   _focus_list_remove(obj);
    sd->focus_next_func = func;
+   _focus_list_dirty(obj);
 }
 
 /**
@@ -943,6 +1658,7 @@ elm_widget_sub_object_add(Evas_Object *obj,
              if (sd2->parent_obj)
                elm_widget_sub_object_del(sd2->parent_obj, sobj);
              sd2->parent_obj = obj;
+             _focus_list_remove(sobj);
              _elm_widget_top_win_focused_set(sobj, sd->top_win_focused);
              if (!sd->child_can_focus && (_is_focusable(sobj)))
                sd->child_can_focus = EINA_TRUE;
@@ -962,7 +1678,10 @@ elm_widget_sub_object_add(Evas_Object *obj,
    evas_object_data_set(sobj, "elm-parent", obj);
    evas_object_event_callback_add(sobj, EVAS_CALLBACK_DEL, _sub_obj_del, sd);
    if (_elm_widget_is(sobj))
-     evas_object_event_callback_add(sobj, EVAS_CALLBACK_HIDE, _sub_obj_hide, sd);
+     {
+        evas_object_event_callback_add(sobj, EVAS_CALLBACK_HIDE, _sub_obj_hide, sd);
+        _focus_list_dirty(obj);
+     }
    evas_object_smart_callback_call(obj, "sub-object-add", sobj);
    scale = elm_widget_scale_get(sobj);
    th = elm_widget_theme_get(sobj);
@@ -1032,8 +1751,11 @@ elm_widget_sub_object_del(Evas_Object *obj,
    evas_object_event_callback_del_full(sobj, EVAS_CALLBACK_DEL,
                                        _sub_obj_del, sd);
    if (_elm_widget_is(sobj))
-     evas_object_event_callback_del_full(sobj, EVAS_CALLBACK_HIDE,
-                                         _sub_obj_hide, sd);
+     {
+        evas_object_event_callback_del_full(sobj, EVAS_CALLBACK_HIDE,
+                                            _sub_obj_hide, sd);
+        _focus_list_remove(sobj);
+     }
    evas_object_smart_callback_call(obj, "sub-object-del", sobj);
 }
 
@@ -1166,6 +1888,7 @@ elm_widget_can_focus_set(Evas_Object *obj,
 
    if (sd->can_focus == can_focus) return;
    sd->can_focus = can_focus;
+   _focus_list_reset(obj);
    if (sd->can_focus)
      {
         evas_object_event_callback_add(obj, EVAS_CALLBACK_KEY_DOWN,
@@ -1227,6 +1950,8 @@ elm_widget_tree_unfocusable_set(Evas_Object *obj,
    tree_unfocusable = !!tree_unfocusable;
    if (sd->tree_unfocusable == tree_unfocusable) return;
    sd->tree_unfocusable = tree_unfocusable;
+   if (tree_unfocusable) _focus_list_remove(obj);
+   else _focus_list_dirty(obj);
    elm_widget_focus_tree_unfocusable_handle(obj);
 }
 
@@ -1323,6 +2048,8 @@ EAPI Eina_Bool
 elm_widget_focus_get(const Evas_Object *obj)
 {
    API_ENTRY return EINA_FALSE;
+   /* the focus order is collected as if nothing had focus */
+   if (_focus_collect_obj) return EINA_FALSE;
    return sd->focused;
 }
 
@@ -1503,6 +2230,7 @@ elm_widget_focus_custom_chain_set(Evas_Object *obj,
      }
 
    sd->focus_chain = objs;
+   _focus_list_dirty(obj);
 }
 
 /**
@@ -1541,6 +2269,7 @@ elm_widget_focus_custom_chain_unset(Evas_Object *obj)
                                             _elm_object_focus_chain_del_cb, sd);
         sd->focus_chain = eina_list_remove_list(sd->focus_chain, l);
      }
+   _focus_list_dirty(obj);
 }
 
 /**
@@ -1575,6 +2304,7 @@ elm_widget_focus_custom_chain_append(Evas_Object *obj,
    else
      sd->focus_chain = eina_list_append_relative(sd->focus_chain,
                                                  child, relative_child);
+   _focus_list_dirty(obj);
 }
 
 /**
@@ -1610,6 +2340,7 @@ elm_widget_focus_custom_chain_prepend(Evas_Object *obj,
    else
      sd->focus_chain = eina_list_prepend_relative(sd->focus_chain,
                                                   child, relative_child);
+   _focus_list_dirty(obj);
 }
 
 /**
@@ -1621,6 +2352,14 @@ elm_widget_focus_custom_chain_prepend(Evas_Object *obj,
  * If the last object of chain already have focus, the focus will go to the
  * first object of chain.
  *
+ * When @p obj is a top widget (a window), the next object is taken from
+ * its flattened focus order. Hiding, disabling or deleting a widget drops
+ * its part of that order; adding or showing one, or changing a custom
+ * chain, walks the focus next hook of the nearest parent again, keeping
+ * the parts of its children that did not change. The full walk is only
+ * done when the focused object is not in the order (e.g. it is inside a
+ * scroller, whose hook only descends while focused).
+ *
  * @param obj The widget root of sub-tree
  * @param dir Direction to cycle the focus
  *
@@ -1631,8 +2370,22 @@ elm_widget_focus_cycle(Evas_Object        *obj,
                        Elm_Focus_Direction dir)
 {
    Evas_Object *target = NULL;
+   Smart_Data *sd;
+
    if (!_elm_widget_is(obj))
      return;
+   sd = evas_object_smart_data_get(obj);
+   if ((sd) && (!sd->parent_obj) &&
+       ((dir == ELM_FOCUS_PREVIOUS) || (dir == ELM_FOCUS_NEXT)) &&
+       (_focus_list_update(obj, sd)))
+     {
+        target = _focus_list_next_get(obj, sd, dir);
+        if (target)
+          {
+             elm_widget_focus_steal(target);
+             return;
+          }
+     }
    elm_widget_focus_next_get(obj, dir, &target);
    if (target)
      elm_widget_focus_steal(target);
@@ -1691,6 +2444,13 @@ elm_widget_focus_next_get(const Evas_Object  *obj,
 
    API_ENTRY return EINA_FALSE;
 
+   /* Collecting the focus order, see _focus_list_hook_walk() */
+   if ((_focus_collect_obj) && (obj != _focus_collect_obj))
+     {
+        _focus_list_collect((Evas_Object *)obj);
+        return EINA_FALSE;
+     }
+
    /* Ignore if disabled */
    if ((!evas_object_visible_get(obj))
        || (elm_widget_disabled_get(obj))
@@ -1822,7 +2582,9 @@ elm_widget_signal_emit(Evas_Object *obj,
 {
    API_ENTRY return;
    if (!sd->signal_func) return;
+   ELM_PERF_SPAN_BEGIN(t0);
    sd->signal_func(obj, emission, source);
+   ELM_PERF_SPAN_END(t0, sd->type, ELM_PERF_SITE_SIGNAL_EMIT);
 }
 
 static void
@@ -2104,6 +2866,8 @@ elm_widget_disabled_set(Evas_Object *obj,
 
    if (sd->disabled == disabled) return;
    sd->disabled = !!disabled;
+   if (sd->disabled) _focus_list_remove(obj);
+   else _focus_list_dirty(obj);
    elm_widget_focus_disabled_handle(obj);
    if (sd->disable_func) sd->disable_func(obj);
 }
@@ -2833,21 +3597,40 @@ _elm_widget_item_new(Evas_Object *widget,
      return NULL;
 
    Elm_Widget_Item *item;
+   Elm_Widget_Item_Pool *pool;
 
    EINA_SAFETY_ON_TRUE_RETURN_VAL(alloc_size < sizeof(Elm_Widget_Item), NULL);
    EINA_SAFETY_ON_TRUE_RETURN_VAL(!_elm_widget_is(widget), NULL);
 
-   item = calloc(1, alloc_size);
-   EINA_SAFETY_ON_NULL_RETURN_VAL(item, NULL);
+   pool = _item_pool_get(elm_widget_type_get(widget), EINA_TRUE);
+   if ((pool) && (!pool->size)) pool->size = alloc_size;
+   /* a widget allocating items of several sizes only pools the first */
+   if ((pool) && (pool->size != alloc_size)) pool = NULL;
+   if ((pool) && (pool->items))
+     {
+        item = eina_trash_pop(&pool->items);
+        memset(item, 0, alloc_size);
+        pool->stats.items--;
+        pool->stats.item_hits++;
+     }
+   else
+     {
+        item = calloc(1, alloc_size);
+        EINA_SAFETY_ON_NULL_RETURN_VAL(item, NULL);
+        if (pool) pool->stats.item_misses++;
+     }
 
    EINA_MAGIC_SET(item, ELM_WIDGET_ITEM_MAGIC);
    item->widget = widget;
+   item->pool = pool;
    return item;
 }
 
 EAPI void
 _elm_widget_item_free(Elm_Widget_Item *item)
 {
+   Elm_Widget_Item_Pool *pool;
+
    ELM_WIDGET_ITEM_CHECK_OR_RETURN(item);
 
    _elm_access_item_unregister(item);
@@ -2855,8 +3638,7 @@ _elm_widget_item_free(Elm_Widget_Item *item)
    if (item->del_func)
      item->del_func((void *)item->data, item->widget, item);
 
-   if (item->view)
-     evas_object_del(item->view);
+   _elm_widget_item_view_release(item);
 
    if (item->access)
      {
@@ -2868,9 +3650,201 @@ _elm_widget_item_free(Elm_Widget_Item *item)
      eina_stringshare_del(item->access_info);
 
    EINA_MAGIC_SET(item, EINA_MAGIC_NONE);
+   pool = item->pool;
+   if ((pool) && (pool->stats.items < pool->max))
+     {
+        eina_trash_push(&pool->items, item);
+        pool->stats.items++;
+        return;
+     }
+   if (pool) pool->stats.dropped++;
    free(item);
 }
 
+/**
+ * @internal
+ *
+ * Get the base view of a widget item, reusing one a released item of
+ * the same widget type left in the pool when possible.
+ *
+ * The view is an edje object themed with @p clas, @p group and the style
+ * of the item's widget, and becomes Elm_Widget_Item::view. When the item
+ * is freed, or when the widget calls _elm_widget_item_view_release(), the
+ * view goes back to the pool instead of being deleted, so the widget must
+ * have taken it out of its containers, removed the callbacks it added on
+ * it and sent it back to its default states by then. A reused view keeps
+ * the text it last had: the widget sets it again.
+ *
+ * @param item a valid #Elm_Widget_Item without a view.
+ * @param clas the theme class, as given to _elm_theme_object_set().
+ * @param group the theme group, as given to _elm_theme_object_set().
+ * @return the view, or NULL on errors.
+ *
+ * @see elm_widget_item_view_get() convenience macro.
+ * @ingroup Widget
+ */
+EAPI Evas_Object *
+_elm_widget_item_view_get(Elm_Widget_Item *item,
+                          const char      *clas,
+                          const char      *group)
+{
+   Evas_Object *view = NULL;
+   const char *style;
+   char buf[1024];
+   Evas *e;
+
+   ELM_WIDGET_ITEM_CHECK_OR_RETURN(item, NULL);
+   EINA_SAFETY_ON_TRUE_RETURN_VAL(item->view != NULL, NULL);
+
+   e = evas_object_evas_get(item->widget);
+   style = elm_widget_style_get(item->widget);
+   if (item->pool)
+     {
+        snprintf(buf, sizeof(buf), "elm/%s/%s/%s", clas, group, style);
+        view = _item_pool_view_take(item->pool, e,
+                                    elm_widget_theme_get(item->widget), buf);
+        if (view) item->pool->stats.view_hits++;
+        else item->pool->stats.view_misses++;
+     }
+   if (view)
+     edje_object_scale_set(view, elm_widget_scale_get(item->widget) *
+                           _elm_config->scale);
+   else
+     {
+        view = edje_object_add(e);
+        _elm_theme_object_set(item->widget, view, clas, group, style);
+     }
+   edje_object_mirrored_set(view, elm_widget_mirrored_get(item->widget));
+   item->view = view;
+   item->view_pooled = !!item->pool;
+   return view;
+}
+
+/**
+ * @internal
+ *
+ * Release the base view of a widget item that stays alive, for widgets
+ * that only keep views for the items they show. A view got with
+ * _elm_widget_item_view_get() goes back to the pool, any other view is
+ * deleted. The same rules as when the item is freed apply.
+ *
+ * @param item a valid #Elm_Widget_Item.
+ *
+ * @see elm_widget_item_view_release() convenience macro.
+ * @ingroup Widget
+ */
+EAPI void
+_elm_widget_item_view_release(Elm_Widget_Item *item)
+{
+   ELM_WIDGET_ITEM_CHECK_OR_RETURN(item);
+
+   if (!item->view) return;
+   if ((!item->view_pooled) || (!_item_pool_view_put(item)))
+     evas_object_del(item->view);
+   item->view = NULL;
+   item->view_pooled = EINA_FALSE;
+}
+
+/**
+ * @internal
+ *
+ * Set how many released items, and how many base views, the pool of a
+ * widget type keeps for reuse. 0 disables pooling for @p type.
+ *
+ * @param type the widget type, as returned by elm_widget_type_get().
+ * @param max the limit, 256 by default.
+ * @ingroup Widget
+ */
+EAPI void
+elm_widget_item_pool_max_set(const char   *type,
+                             unsigned int  max)
+{
+   Elm_Widget_Item_Pool *pool;
+   Item_Pool_View *pv;
+   void *item;
+
+   pool = _item_pool_get(type, EINA_TRUE);
+   if (!pool) return;
+   pool->max = max;
+   while (pool->stats.views > max)
+     {
+        pv = eina_list_data_get(eina_list_last(pool->views));
+        evas_object_del(pv->obj);
+     }
+   while (pool->stats.items > max)
+     {
+        item = eina_trash_pop(&pool->items);
+        free(item);
+        pool->stats.items--;
+     }
+}
+
+EAPI unsigned int
+elm_widget_item_pool_max_get(const char *type)
+{
+   Elm_Widget_Item_Pool *pool = _item_pool_get(type, EINA_FALSE);
+
+   if (!pool) return ITEM_POOL_MAX;
+   return pool->max;
+}
+
+/**
+ * @internal
+ *
+ * Get the counters of the item pool of a widget type.
+ *
+ * @param type the widget type, as returned by elm_widget_type_get().
+ * @param stats where to store the counters.
+ * @return EINA_FALSE if no item of @p type was ever allocated.
+ * @ingroup Widget
+ */
+EAPI Eina_Bool
+elm_widget_item_pool_stats_get(const char                 *type,
+                               Elm_Widget_Item_Pool_Stats *stats)
+{
+   Elm_Widget_Item_Pool *pool = _item_pool_get(type, EINA_FALSE);
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(stats, EINA_FALSE);
+   if (!pool)
+     {
+        memset(stats, 0, sizeof(Elm_Widget_Item_Pool_Stats));
+        return EINA_FALSE;
+     }
+   *stats = pool->stats;
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_item_pool_flush_cb(const Eina_Hash *hash __UNUSED__, const void *key __UNUSED__, void *data, void *fdata __UNUSED__)
+{
+   _item_pool_views_flush(data);
+   _item_pool_items_flush(data);
+   return EINA_TRUE;
+}
+
+/**
+ * @internal
+ *
+ * Release what the item pool of a widget type keeps, or of every type if
+ * @p type is NULL. Views are flushed on theme changes as well.
+ *
+ * @ingroup Widget
+ */
+EAPI void
+elm_widget_item_pool_flush(const char *type)
+{
+   Elm_Widget_Item_Pool *pool;
+
+   if (!item_pools) return;
+   if (!type)
+     {
+        eina_hash_foreach(item_pools, _item_pool_flush_cb, NULL);
+        return;
+     }
+   pool = _item_pool_get(type, EINA_FALSE);
+   if (pool) _item_pool_flush_cb(NULL, NULL, pool, NULL);
+}
+
 /**
  * @internal
  *
@@ -3618,6 +4592,14 @@ _smart_del(Evas_Object *obj)
 
    INTERNAL_ENTRY;
 
+   _theme_job_forget(sd);
+   if (sd->cache_node)
+     {
+        theme_job.caches = eina_list_remove_list(theme_job.caches,
+                                                 sd->cache_node);
+        sd->cache_node = NULL;
+        theme_job.done++;
+     }
    if (sd->del_pre_func) sd->del_pre_func(obj);
    if (sd->resize_obj)
      {
@@ -3666,6 +4648,7 @@ _smart_del(Evas_Object *obj)
    sd->data = NULL;
    _if_focused_revert(obj, EINA_TRUE);
    if (sd->access_info) eina_stringshare_del(sd->access_info);
+   _focus_list_remove(obj);
    free(sd);
    evas_object_smart_data_set(obj, NULL);
 }
@@ -3698,6 +4681,8 @@ _smart_show(Evas_Object *obj)
    Eina_List *list;
    Evas_Object *o;
    INTERNAL_ENTRY;
+   _focus_list_dirty(obj);
+   if (sd->theme_deferred) elm_widget_theme(obj);
    if ((list = evas_object_smart_members_get(obj)))
      {
         EINA_LIST_FREE(list, o)
@@ -3715,6 +4700,7 @@ _smart_hide(Evas_Object *obj)
    Evas_Object *o;
    INTERNAL_ENTRY;
 
+   _focus_list_remove(obj);
    list = evas_object_smart_members_get(obj);
    EINA_LIST_FREE(list, o)
      {
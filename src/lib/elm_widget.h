@@ -186,7 +186,7 @@
 #warning "for any number of child Elementary widgets"
 //#error "ERROR. Compile aborted."
 #endif
-#define ELM_INTERNAL_API_VERSION 7000
+#define ELM_INTERNAL_API_VERSION 7001
 
 typedef struct _Elm_Tooltip     Elm_Tooltip;
 typedef struct _Elm_Cursor      Elm_Cursor;
@@ -194,6 +194,12 @@ typedef struct _Elm_Cursor      Elm_Cursor;
 /**< base structure for all widget items that are not Elm_Widget themselves */
 typedef struct _Elm_Widget_Item Elm_Widget_Item;
 
+/**< released items and base views kept for reuse, one per widget type */
+typedef struct _Elm_Widget_Item_Pool Elm_Widget_Item_Pool;
+
+/**< counters of a widget item pool */
+typedef struct _Elm_Widget_Item_Pool_Stats Elm_Widget_Item_Pool_Stats;
+
 /**< accessibility information to be able to set and get from the access API */
 typedef struct _Elm_Access_Info Elm_Access_Info;
 
@@ -280,8 +286,23 @@ struct _Elm_Widget_Item
    Elm_Widget_Disable_Cb          disable_func;
    Elm_Access_Info               *access;
    const char                    *access_info;
+   /**< pool the item returns to when freed, if any */
+   Elm_Widget_Item_Pool          *pool;
 
    Eina_Bool                      disabled : 1;
+   /**< view comes from _elm_widget_item_view_get() */
+   Eina_Bool                      view_pooled : 1;
+};
+
+struct _Elm_Widget_Item_Pool_Stats
+{
+   unsigned int items;       /**< item structures kept for reuse */
+   unsigned int views;       /**< base views kept for reuse */
+   unsigned int item_hits;   /**< items taken from the pool */
+   unsigned int item_misses; /**< items allocated */
+   unsigned int view_hits;   /**< views taken from the pool */
+   unsigned int view_misses; /**< views created */
+   unsigned int dropped;     /**< items and views released over the limit */
 };
 
 struct _Elm_Object_Item
@@ -443,6 +464,12 @@ EAPI const char      *elm_widget_access_info_get(const Evas_Object *obj);
 EAPI Elm_Widget_Item *_elm_widget_item_new(Evas_Object *parent, size_t alloc_size);
 EAPI void             _elm_widget_item_free(Elm_Widget_Item *item);
 EAPI void             _elm_widget_item_del(Elm_Widget_Item *item);
+EAPI Evas_Object     *_elm_widget_item_view_get(Elm_Widget_Item *item, const char *clas, const char *group);
+EAPI void             _elm_widget_item_view_release(Elm_Widget_Item *item);
+EAPI void             elm_widget_item_pool_max_set(const char *type, unsigned int max);
+EAPI unsigned int     elm_widget_item_pool_max_get(const char *type);
+EAPI Eina_Bool        elm_widget_item_pool_stats_get(const char *type, Elm_Widget_Item_Pool_Stats *stats);
+EAPI void             elm_widget_item_pool_flush(const char *type);
 EAPI void             _elm_widget_item_pre_notify_del(Elm_Widget_Item *item);
 EAPI void             _elm_widget_item_del_cb_set(Elm_Widget_Item *item, Evas_Smart_Cb del_cb);
 EAPI void             _elm_widget_item_data_set(Elm_Widget_Item *item, const void *data);
@@ -507,6 +534,20 @@ EAPI void             elm_widget_tree_dot_dump(const Evas_Object *top, FILE *out
  */
 #define elm_widget_item_del(item) \
   _elm_widget_item_del((Elm_Widget_Item *)item)
+/**
+ * Convenience macro to get a pooled base view for a widget item, doing
+ * casts for you.
+ * @see _elm_widget_item_view_get()
+ */
+#define elm_widget_item_view_get(item, clas, group) \
+  _elm_widget_item_view_get((Elm_Widget_Item *)item, clas, group)
+/**
+ * Convenience macro to release the base view of a widget item, doing
+ * casts for you.
+ * @see _elm_widget_item_view_release()
+ */
+#define elm_widget_item_view_release(item) \
+  _elm_widget_item_view_release((Elm_Widget_Item *)item)
 /**
  * Convenience macro to notify deletion of widget item, doing casts for you.
  * @see _elm_widget_item_pre_notify_del()
@@ -27,6 +27,7 @@ struct _Elm_Win
         Ecore_Timer *timer;
         int repeat_count;
         int shot_counter;
+        Eina_Bool manual : 1;
      } shot;
    int resize_location;
    int *autodel_clear, rot;
@@ -260,6 +261,20 @@ _shot_repeat_count_get(Elm_Win *win)
    return 0;
 }
 
+static Eina_Bool
+_shot_manual_get(Elm_Win *win)
+{
+   const char *p;
+
+   for (p = win->shot.info; *p; p++)
+     {
+        if (((p == win->shot.info) || (p[-1] == ':')) &&
+            (!strncmp(p, "manual", 6)) && ((!p[6]) || (p[6] == ':')))
+          return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
 static char *
 _shot_key_get(Elm_Win *win __UNUSED__)
 {
@@ -272,22 +287,21 @@ _shot_flags_get(Elm_Win *win __UNUSED__)
    return NULL;
 }
 
-static void
-_shot_do(Elm_Win *win)
+/* Saves the last rendered frame */
+static Eina_Bool
+_shot_save(Elm_Win *win, const char *file)
 {
    Ecore_Evas *ee;
    Evas_Object *o;
    unsigned int *pixels;
    int w, h;
-   char *file, *key, *flags;
+   char *key, *flags;
+   Eina_Bool ret;
 
-   ecore_evas_manual_render(win->ee);
    pixels = (void *)ecore_evas_buffer_pixels_get(win->ee);
-   if (!pixels) return;
+   if (!pixels) return EINA_FALSE;
    ecore_evas_geometry_get(win->ee, NULL, NULL, &w, &h);
-   if ((w < 1) || (h < 1)) return;
-   file = _shot_file_get(win);
-   if (!file) return;
+   if ((w < 1) || (h < 1)) return EINA_FALSE;
    key = _shot_key_get(win);
    flags = _shot_flags_get(win);
    ee = ecore_evas_buffer_new(1, 1);
@@ -295,15 +309,32 @@ _shot_do(Elm_Win *win)
    evas_object_image_alpha_set(o, ecore_evas_alpha_get(win->ee));
    evas_object_image_size_set(o, w, h);
    evas_object_image_data_set(o, pixels);
-   if (!evas_object_image_save(o, file, key, flags))
+   ret = evas_object_image_save(o, file, key, flags);
+   if (!ret)
      {
         ERR("Cannot save window to '%s' (key '%s', flags '%s')",
             file, key, flags);
      }
-   free(file);
    if (key) free(key);
    if (flags) free(flags);
    ecore_evas_free(ee);
+   return ret;
+}
+
+static void
+_shot_do(Elm_Win *win)
+{
+   char *file;
+
+   ecore_evas_manual_render(win->ee);
+   file = _shot_file_get(win);
+   if (!file) return;
+   if (!_shot_save(win, file))
+     {
+        free(file);
+        return;
+     }
+   free(file);
    if (win->shot.repeat_count) win->shot.shot_counter++;
 }
 
@@ -328,12 +359,15 @@ _shot_init(Elm_Win *win)
    if (!win->shot.info) return;
    win->shot.repeat_count = _shot_repeat_count_get(win);
    win->shot.shot_counter = 0;
+   win->shot.manual = _shot_manual_get(win);
 }
 
 static void
 _shot_handle(Elm_Win *win)
 {
    if (!win->shot.info) return;
+   /* frames are rendered by elm_win_shot_render() only */
+   if (win->shot.manual) return;
    win->shot.timer = ecore_timer_add(_shot_delay_get(win), _shot_delay, win);
 }
 
@@ -1236,16 +1270,13 @@ _elm_win_rescale(Elm_Theme *th, Eina_Bool use_theme)
    const Eina_List *l;
    Evas_Object *obj;
 
-   if (!use_theme)
-     {
-        EINA_LIST_FOREACH(_elm_win_list, l, obj)
-          elm_widget_theme(obj);
-     }
-   else
-     {
-        EINA_LIST_FOREACH(_elm_win_list, l, obj)
-          elm_widget_theme_specific(obj, th, EINA_FALSE);
-     }
+   if (!use_theme) th = NULL;
+   else if (!th) th = elm_theme_default_get();
+   /* visible windows first, hidden ones are themed when shown */
+   EINA_LIST_FOREACH(_elm_win_list, l, obj)
+     if (evas_object_visible_get(obj)) _elm_widget_theme_job_add(obj, th);
+   EINA_LIST_FOREACH(_elm_win_list, l, obj)
+     if (!evas_object_visible_get(obj)) _elm_widget_theme_job_add(obj, th);
 }
 
 void
@@ -3671,3 +3702,17 @@ elm_win_floating_mode_get(const Evas_Object *obj)
    return win->floating;
 }
 
+EAPI Eina_Bool
+elm_win_shot_render(Evas_Object *obj, const char *file)
+{
+   Elm_Win *win;
+   ELM_CHECK_WIDTYPE(obj, widtype) EINA_FALSE;
+   win = elm_widget_data_get(obj);
+   if (!win) return EINA_FALSE;
+   if (!win->shot.info) return EINA_FALSE;
+
+   ecore_evas_manual_render(win->ee);
+   if (file) return _shot_save(win, file);
+   return EINA_TRUE;
+}
+
@@ -45,7 +45,7 @@
  * screenshot and how long to delay in the engine string. The engine string
  * is encoded in the following way:
  *
- *   "shot:[delay=XX][:][repeat=DDD][:][file=XX]"
+ *   "shot:[delay=XX][:][repeat=DDD][:][manual][:][file=XX]"
  *
  * Where options are separated by a ":" char if more than one option is
  * given, with delay, if provided being the first option and file the last
@@ -55,12 +55,16 @@
  * If no delay is given, the default is 0.5 seconds. If no file is given the
  * default output file is "out.png". Repeat option is for continuous
  * capturing screenshots. Repeat range is from 1 to 999 and filename is
- * fixed to "out001.png" Some examples of using the shot engine:
+ * fixed to "out001.png". The manual option disables the delayed shot
+ * and the exit: frames are then only rendered, and saved if asked to,
+ * by elm_win_shot_render(), which is what headless tools driving the
+ * windows themselves want. Some examples of using the shot engine:
  *
  *   ELM_ENGINE="shot:delay=1.0:repeat=5:file=elm_test.png" elementary_test
  *   ELM_ENGINE="shot:delay=1.0:file=elm_test.png" elementary_test
  *   ELM_ENGINE="shot:file=elm_test2.png" elementary_test
  *   ELM_ENGINE="shot:delay=2.0" elementary_test
+ *   ELM_ENGINE="shot:manual" elementary_bench
  *   ELM_ENGINE="shot:" elementary_test
  *
  * Signals that you can add callbacks for are:
@@ -1417,6 +1421,21 @@ EAPI void                  elm_win_floating_mode_set(Evas_Object *obj, Eina_Bool
  */
 EAPI Eina_Bool             elm_win_floating_mode_get(const Evas_Object *obj);
 
+/**
+ * Render a frame of a window using the "shot" engine.
+ *
+ * @param obj The window object
+ * @param file The file to save the frame to, or @c NULL to only render it
+ * @return @c EINA_TRUE if the frame was rendered (and saved when asked
+ * to), @c EINA_FALSE otherwise, e.g. if the window uses another engine
+ *
+ * This is meant for windows of the "shot:manual" engine, whose frames
+ * are only rendered on request.
+ *
+ * @ingroup Win
+ */
+EAPI Eina_Bool             elm_win_shot_render(Evas_Object *obj, const char *file);
+
 
 /**
  * @}
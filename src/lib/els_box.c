@@ -2,6 +2,271 @@
 #include "elm_priv.h"
 #include "els_box.h"
 
+/* Non homogeneous boxes keep a snapshot of the hints of their children,
+ * refreshed only for the children whose hints changed, along with
+ * running sums of what the extents are made of. A layout then places the
+ * children from the first one that changed onwards, unless something
+ * the whole box depends on (geometry, expansion, ...) changed too. */
+
+typedef struct _Els_Box_Item Els_Box_Item;
+typedef struct _Els_Box_Cache Els_Box_Cache;
+
+struct _Els_Box_Item
+{
+   Evas_Object *obj;
+   Els_Box_Cache *cache;
+   Evas_Coord mnw, mnh, mxw, mxh;
+   double wx, wy, ax, ay;
+   Evas_Coord next; /* where the next child starts on the main axis */
+   unsigned int index, gen;
+   Eina_Bool dirty : 1;
+   Eina_Bool counted : 1;
+};
+
+struct _Els_Box_Cache
+{
+   Els_Box_Item **items, **spare;
+   unsigned int count, size, gen;
+   Eina_Hash *lookup;
+   Evas_Coord main_sum, cross_max;
+   double expand;
+   unsigned int expand_count;
+   /* what the last layout depended on */
+   Evas_Coord x, y, w, h, pad, extra;
+   double expand_last;
+   int horizontal, rtl;
+   Eina_Bool valid : 1;
+   Eina_Bool cross_rescan : 1;
+};
+
+static const char _cache_key[] = "_els_box_cache";
+
+static void
+_item_hints_changed(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Els_Box_Item *it = data;
+   it->dirty = EINA_TRUE;
+}
+
+static void
+_item_obj_del(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Els_Box_Item *it = data;
+   eina_hash_del_by_key(it->cache->lookup, &it->obj);
+   it->obj = NULL;
+}
+
+static Els_Box_Item *
+_item_new(Els_Box_Cache *cache, Evas_Object *obj)
+{
+   Els_Box_Item *it;
+
+   it = calloc(1, sizeof(Els_Box_Item));
+   if (!it) return NULL;
+   it->obj = obj;
+   it->cache = cache;
+   it->index = (unsigned int)-1;
+   it->dirty = EINA_TRUE;
+   if (!eina_hash_add(cache->lookup, &obj, it))
+     {
+        free(it);
+        return NULL;
+     }
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                  _item_hints_changed, it);
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_DEL, _item_obj_del, it);
+   return it;
+}
+
+static void
+_item_free(Els_Box_Item *it)
+{
+   if (it->obj)
+     {
+        evas_object_event_callback_del_full(it->obj,
+                                            EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+                                            _item_hints_changed, it);
+        evas_object_event_callback_del_full(it->obj, EVAS_CALLBACK_DEL,
+                                            _item_obj_del, it);
+        eina_hash_del_by_key(it->cache->lookup, &it->obj);
+     }
+   free(it);
+}
+
+static void
+_item_account(Els_Box_Cache *cache, Els_Box_Item *it, int sign)
+{
+   Evas_Coord main, cross;
+   double weight;
+
+   if (cache->horizontal)
+     {
+        main = it->mnw;
+        cross = it->mnh;
+        weight = it->wx;
+     }
+   else
+     {
+        main = it->mnh;
+        cross = it->mnw;
+        weight = it->wy;
+     }
+   cache->main_sum += sign * main;
+   if (weight > 0.0)
+     {
+        cache->expand += sign * weight;
+        cache->expand_count += sign;
+     }
+   if (sign > 0)
+     {
+        if (cross > cache->cross_max) cache->cross_max = cross;
+     }
+   else if (cross >= cache->cross_max)
+     cache->cross_rescan = EINA_TRUE;
+   it->counted = (sign > 0);
+}
+
+static void
+_cache_invalidate(Els_Box_Cache *cache)
+{
+   unsigned int i;
+
+   for (i = 0; i < cache->count; i++)
+     {
+        cache->items[i]->counted = EINA_FALSE;
+        cache->items[i]->dirty = EINA_TRUE;
+     }
+   cache->main_sum = 0;
+   cache->cross_max = 0;
+   cache->expand = 0.0;
+   cache->expand_count = 0;
+   cache->valid = EINA_FALSE;
+}
+
+static void
+_cache_free(void *data, Evas *e __UNUSED__, Evas_Object *obj __UNUSED__, void *event_info __UNUSED__)
+{
+   Els_Box_Cache *cache = data;
+   unsigned int i;
+
+   for (i = 0; i < cache->count; i++)
+     _item_free(cache->items[i]);
+   eina_hash_free(cache->lookup);
+   free(cache->items);
+   free(cache->spare);
+   free(cache);
+}
+
+static Els_Box_Cache *
+_cache_get(Evas_Object *o)
+{
+   Els_Box_Cache *cache;
+
+   cache = evas_object_data_get(o, _cache_key);
+   if (cache) return cache;
+   cache = calloc(1, sizeof(Els_Box_Cache));
+   if (!cache) return NULL;
+   cache->lookup = eina_hash_pointer_new(NULL);
+   if (!cache->lookup)
+     {
+        free(cache);
+        return NULL;
+     }
+   evas_object_data_set(o, _cache_key, cache);
+   evas_object_event_callback_add(o, EVAS_CALLBACK_DEL, _cache_free, cache);
+   return cache;
+}
+
+static Eina_Bool
+_cache_reserve(Els_Box_Cache *cache, unsigned int count)
+{
+   Els_Box_Item **items, **spare;
+
+   if (count <= cache->size) return EINA_TRUE;
+   items = realloc(cache->items, count * sizeof(Els_Box_Item *));
+   if (!items) return EINA_FALSE;
+   cache->items = items;
+   spare = realloc(cache->spare, count * sizeof(Els_Box_Item *));
+   if (!spare) return EINA_FALSE;
+   cache->spare = spare;
+   cache->size = count;
+   return EINA_TRUE;
+}
+
+/* bring the snapshot in line with the children list, returns the index
+ * of the first child whose hints or position in the list changed */
+static int
+_cache_update(Els_Box_Cache *cache, Evas_Object_Box_Data *priv)
+{
+   const Eina_List *l;
+   Evas_Object_Box_Option *opt;
+   Els_Box_Item *it, **tmp;
+   unsigned int i, j, first, count;
+
+   count = eina_list_count(priv->children);
+   if (!_cache_reserve(cache, count)) return -1;
+   first = count;
+   cache->gen++;
+   i = 0;
+   EINA_LIST_FOREACH(priv->children, l, opt)
+     {
+        if ((i < cache->count) && (cache->items[i]->obj == opt->obj))
+          it = cache->items[i];
+        else
+          {
+             it = eina_hash_find(cache->lookup, &opt->obj);
+             if (!it) it = _item_new(cache, opt->obj);
+             if (!it) return -1;
+          }
+        if (it->index != i)
+          {
+             it->index = i;
+             if (i < first) first = i;
+          }
+        if (it->dirty)
+          {
+             if (it->counted) _item_account(cache, it, -1);
+             evas_object_size_hint_min_get(it->obj, &it->mnw, &it->mnh);
+             evas_object_size_hint_max_get(it->obj, &it->mxw, &it->mxh);
+             evas_object_size_hint_weight_get(it->obj, &it->wx, &it->wy);
+             evas_object_size_hint_align_get(it->obj, &it->ax, &it->ay);
+             _item_account(cache, it, 1);
+             it->dirty = EINA_FALSE;
+             if (i < first) first = i;
+          }
+        it->gen = cache->gen;
+        cache->spare[i++] = it;
+     }
+   /* what was not seen is gone */
+   for (j = 0; j < cache->count; j++)
+     {
+        it = cache->items[j];
+        if (it->gen == cache->gen) continue;
+        if (it->counted) _item_account(cache, it, -1);
+        _item_free(it);
+     }
+   tmp = cache->items;
+   cache->items = cache->spare;
+   cache->spare = tmp;
+   cache->count = i;
+
+   if (cache->cross_rescan)
+     {
+        cache->cross_max = 0;
+        for (j = 0; j < cache->count; j++)
+          {
+             Evas_Coord cross;
+
+             it = cache->items[j];
+             cross = cache->horizontal ? it->mnh : it->mnw;
+             if (cross > cache->cross_max) cache->cross_max = cross;
+          }
+        cache->cross_rescan = EINA_FALSE;
+     }
+   if (!cache->expand_count) cache->expand = 0.0;
+   return first;
+}
+
 static void
 _smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, int horizontal, int homogeneous)
 {
@@ -103,8 +368,8 @@ _smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, int horiz
    evas_object_size_hint_max_set(box, maxw, maxh);
 }
 
-void
-_els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, int horizontal, int homogeneous, int rtl)
+static void
+_box_layout_full(Evas_Object *o, Evas_Object_Box_Data *priv, int horizontal, int homogeneous, int rtl)
 {
    Evas_Coord x, y, w, h, xx, yy;
    const Eina_List *l;
@@ -250,3 +515,166 @@ _els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, int horizontal, int
      }
 }
 
+
+static Eina_Bool
+_box_layout_incremental(Evas_Object *o, Evas_Object_Box_Data *priv, int horizontal, int rtl)
+{
+   Els_Box_Cache *cache;
+   Els_Box_Item *it;
+   Evas_Coord x, y, w, h, xx, yy, minw, minh, pad, extra;
+   unsigned int i;
+   double expand, ax, ay;
+   int first, c;
+
+   cache = _cache_get(o);
+   if (!cache) return EINA_FALSE;
+   if (cache->horizontal != horizontal)
+     {
+        cache->horizontal = horizontal;
+        _cache_invalidate(cache);
+     }
+   first = _cache_update(cache, priv);
+   if (first < 0)
+     {
+        _cache_invalidate(cache);
+        return EINA_FALSE;
+     }
+
+   pad = horizontal ? priv->pad.h : priv->pad.v;
+   c = (int)cache->count - 1;
+   if (horizontal)
+     {
+        minw = cache->main_sum;
+        minh = cache->cross_max;
+        if (c > 0) minw += pad * c;
+     }
+   else
+     {
+        minw = cache->cross_max;
+        minh = cache->main_sum;
+        if (c > 0) minh += pad * c;
+     }
+   evas_object_size_hint_min_set(o, minw, minh);
+   evas_object_size_hint_max_set(o, -1, -1);
+
+   evas_object_geometry_get(o, &x, &y, &w, &h);
+   /* children changed above are not placed, the next pass places all */
+   if ((w < minw) || (h < minh))
+     {
+        cache->valid = EINA_FALSE;
+        return EINA_TRUE;
+     }
+
+   expand = cache->expand;
+   if (!expand)
+     {
+        evas_object_size_hint_align_get(o, &ax, &ay);
+        if (rtl) ax = 1.0 - ax;
+        if (horizontal)
+          {
+             x += (double)(w - minw) * ax;
+             w = minw;
+          }
+        else
+          {
+             y += (double)(h - minh) * ay;
+             h = minh;
+          }
+        extra = 0;
+     }
+   else
+     extra = horizontal ? (w - minw) : (h - minh);
+
+   /* the children before the first changed one keep their place, as long
+    * as nothing they all depend on moved */
+   if ((!cache->valid) || (cache->x != x) || (cache->y != y) ||
+       (cache->pad != pad) || (cache->rtl != rtl) ||
+       (cache->extra != extra) || (cache->expand_last != expand) ||
+       (horizontal && ((cache->h != h) || (rtl && (cache->w != w)))) ||
+       (!horizontal && (cache->w != w)))
+     first = 0;
+   cache->x = x;
+   cache->y = y;
+   cache->w = w;
+   cache->h = h;
+   cache->pad = pad;
+   cache->rtl = rtl;
+   cache->extra = extra;
+   cache->expand_last = expand;
+   cache->valid = EINA_TRUE;
+
+   xx = x;
+   yy = y;
+   if (first > 0)
+     {
+        if (horizontal) xx = cache->items[first - 1]->next;
+        else yy = cache->items[first - 1]->next;
+     }
+   for (i = first; i < cache->count; i++)
+     {
+        Evas_Coord ww, hh, ow, oh;
+        int fw = 0, fh = 0;
+
+        it = cache->items[i];
+        ax = it->ax;
+        ay = it->ay;
+        if (ax == -1.0) {fw = 1; ax = 0.5;}
+        if (ay == -1.0) {fh = 1; ay = 0.5;}
+        if (rtl) ax = 1.0 - ax;
+        if (horizontal)
+          {
+             ww = it->mnw;
+             if ((expand > 0) && (it->wx > 0.0))
+               ww += ((w - minw) * it->wx) / expand;
+             hh = h;
+             ow = it->mnw;
+             if (fw) ow = ww;
+             if ((it->mxw >= 0) && (it->mxw < ow)) ow = it->mxw;
+             oh = it->mnh;
+             if (fh) oh = hh;
+             if ((it->mxh >= 0) && (it->mxh < oh)) oh = it->mxh;
+             evas_object_move(it->obj,
+                              ((!rtl) ? (xx) : (x + (w - (xx - x) - ww)))
+                              + (Evas_Coord)(((double)(ww - ow)) * ax),
+                              yy + (Evas_Coord)(((double)(hh - oh)) * ay));
+             evas_object_resize(it->obj, ow, oh);
+             xx += ww;
+             xx += pad;
+             it->next = xx;
+          }
+        else
+          {
+             hh = it->mnh;
+             if ((expand > 0) && (it->wy > 0.0))
+               hh += ((h - minh) * it->wy) / expand;
+             ww = w;
+             ow = it->mnw;
+             if (fw) ow = ww;
+             if ((it->mxw >= 0) && (it->mxw < ow)) ow = it->mxw;
+             oh = it->mnh;
+             if (fh) oh = hh;
+             if ((it->mxh >= 0) && (it->mxh < oh)) oh = it->mxh;
+             evas_object_move(it->obj,
+                              xx + (Evas_Coord)(((double)(ww - ow)) * ax),
+                              yy + (Evas_Coord)(((double)(hh - oh)) * ay));
+             evas_object_resize(it->obj, ow, oh);
+             yy += hh;
+             yy += pad;
+             it->next = yy;
+          }
+     }
+   return EINA_TRUE;
+}
+
+void
+_els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, int horizontal, int homogeneous, int rtl)
+{
+   Els_Box_Cache *cache;
+
+   if ((!homogeneous) && (_box_layout_incremental(o, priv, horizontal, rtl)))
+     return;
+   /* the snapshot is stale after a full layout, start over next time */
+   cache = evas_object_data_get(o, _cache_key);
+   if (cache) _cache_invalidate(cache);
+   _box_layout_full(o, priv, horizontal, homogeneous, rtl);
+}
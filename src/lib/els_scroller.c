@@ -95,8 +95,13 @@ struct _Smart_Data
         void (*child_size_get) (Evas_Object *obj, Evas_Coord *x, Evas_Coord *y);
         void (*gravity_set) (Evas_Object *obj, double x, double y);
         void (*gravity_get) (Evas_Object *obj, double *x, double *y);
+        void (*fraction_set) (Evas_Object *obj, double fx, double fy);
+        Eina_Bool (*translate) (Evas_Object *obj, Evas_Coord x, Evas_Coord y);
      } pan_func;
 
+   /* Sub-pixel part of the position last set by smooth scrolling */
+   double frac_x, frac_y;
+
    struct
      {
         struct
@@ -238,6 +243,8 @@ elm_smart_scroller_child_set(Evas_Object *obj, Evas_Object *child)
    sd->pan_func.child_size_get = _elm_smart_pan_child_size_get;
    sd->pan_func.gravity_set = _elm_smart_pan_gravity_set;
    sd->pan_func.gravity_get = _elm_smart_pan_gravity_get;
+   sd->pan_func.fraction_set = NULL;
+   sd->pan_func.translate = NULL;
 
    evas_object_event_callback_add(child, EVAS_CALLBACK_DEL, _smart_child_del_hook, sd);
    _elm_smart_pan_child_set(sd->pan_obj, child);
@@ -295,12 +302,33 @@ elm_smart_scroller_extern_pan_set(Evas_Object *obj, Evas_Object *pan,
    sd->pan_func.child_size_get = pan_child_size_get;
    sd->pan_func.gravity_set = _elm_smart_pan_gravity_set;
    sd->pan_func.gravity_get = _elm_smart_pan_gravity_get;
+   sd->pan_func.fraction_set = NULL;
+   sd->pan_func.translate = NULL;
    sd->extern_pan = EINA_TRUE;
    evas_object_smart_callback_add(sd->pan_obj, "changed", _smart_pan_changed_hook, sd);
    edje_object_part_swallow(sd->edje_obj, "elm.swallow.content", sd->pan_obj);
    evas_object_show(sd->pan_obj);
 }
 
+/* Optional extern pan functions used by smooth scrolling.
+ * pan_fraction_set gets the sub-pixel part (-0.5 .. 0.5) of the position
+ * set right after it, for pans that can render content at it.
+ * pan_translate is tried before pan_set: if the pan can move its already
+ * realized content to the new position without recalculating it, it does
+ * so (updating its own position too) and returns EINA_TRUE. Otherwise it
+ * returns EINA_FALSE and the position is set with pan_set as usual. */
+void
+elm_smart_scroller_extern_pan_smooth_set(Evas_Object *obj,
+                                         void (*pan_fraction_set) (Evas_Object *obj, double fx, double fy),
+                                         Eina_Bool (*pan_translate) (Evas_Object *obj, Evas_Coord x, Evas_Coord y))
+{
+   API_ENTRY return;
+
+   if (!sd->extern_pan) return;
+   sd->pan_func.fraction_set = pan_fraction_set;
+   sd->pan_func.translate = pan_translate;
+}
+
 void
 elm_smart_scroller_custom_edje_file_set(Evas_Object *obj, char *file, char *group)
 {
@@ -825,11 +853,82 @@ can_scroll(Smart_Data *sd, int dir)
    return EINA_FALSE;
 }
 
+static Eina_Bool
+_smart_smooth_enabled(Smart_Data *sd)
+{
+   return ((_elm_config->scroll_smooth_enable) &&
+           (_elm_config->scroll_smooth_amount > 0.0) &&
+           (!sd->hold) && (!sd->freeze));
+}
+
+/* Least squares fit of a line to the pointer history of the last
+ * scroll_smooth_time_window seconds. Returns pointer velocity (px/sec)
+ * and the offset of the fitted pointer position at time t from the
+ * newest history entry. Fails if there are not enough samples. */
+static Eina_Bool
+_smart_velocity_fit(Smart_Data *sd, double t,
+                    double *vx, double *vy, double *ox, double *oy)
+{
+   double st = 0.0, stt = 0.0, sx = 0.0, sy = 0.0, stx = 0.0, sty = 0.0;
+   double n = 0.0, dt, dx, dy, d, bx, by;
+   int i;
+
+   for (i = 0; i < 60; i++)
+     {
+        dt = sd->down.history[i].timestamp - sd->down.history[0].timestamp;
+        if (-dt > _elm_config->scroll_smooth_time_window) break;
+        dx = sd->down.history[i].x - sd->down.history[0].x;
+        dy = sd->down.history[i].y - sd->down.history[0].y;
+        st += dt;
+        stt += dt * dt;
+        sx += dx;
+        sy += dy;
+        stx += dt * dx;
+        sty += dt * dy;
+        n += 1.0;
+     }
+   if (n < 2.0) return EINA_FALSE;
+   d = (n * stt) - (st * st);
+   if (d <= 0.0) return EINA_FALSE;
+
+   bx = ((n * stx) - (st * sx)) / d;
+   by = ((n * sty) - (st * sy)) / d;
+   dt = t - sd->down.history[0].timestamp;
+   if (vx) *vx = bx;
+   if (vy) *vy = by;
+   if (ox) *ox = ((sx - (bx * st)) / n) + (bx * dt);
+   if (oy) *oy = ((sy - (by * st)) / n) + (by * dt);
+   return EINA_TRUE;
+}
+
+/* Time of the next frame in the clock of history timestamps */
+static double
+_smart_smooth_time_get(Smart_Data *sd)
+{
+   double t = ecore_loop_time_get() + _elm_config->scroll_smooth_future_time;
+#ifdef EVTIME
+   t -= sd->down.hist.est_timestamp_diff;
+#endif
+   return t;
+}
+
+/* Set position with sub-pixel precision, the integer part goes to
+ * the pan as usual and the remainder to its fraction_set function */
+static void
+_smart_child_pos_set_smooth(Smart_Data *sd, double x, double y)
+{
+   Evas_Coord ix = lround(x), iy = lround(y);
+
+   sd->frac_x = x - ix;
+   sd->frac_y = y - iy;
+   elm_smart_scroller_child_pos_set(sd->smart_obj, ix, iy);
+}
+
 static Eina_Bool
 _smart_momentum_animator(void *data)
 {
    Smart_Data *sd;
-   double t, dt, p;
+   double t, dt, p, fdx, fdy, fx, fy;
    Evas_Coord x, y, dx, dy, px, py, maxx, maxy, minx, miny;
    Eina_Bool no_bounce_x_end = EINA_FALSE, no_bounce_y_end = EINA_FALSE;
 
@@ -858,26 +957,41 @@ _smart_momentum_animator(void *data)
         dt = dt / (_elm_config->thumbscroll_friction + sd->down.extra_time);
         if (dt > 1.0) dt = 1.0;
         p = 1.0 - ((1.0 - dt) * (1.0 - dt));
-        dx = (sd->down.dx * (_elm_config->thumbscroll_friction + sd->down.extra_time) * p);
-        dy = (sd->down.dy * (_elm_config->thumbscroll_friction + sd->down.extra_time) * p);
+        fdx = (sd->down.dx * (_elm_config->thumbscroll_friction + sd->down.extra_time) * p);
+        fdy = (sd->down.dy * (_elm_config->thumbscroll_friction + sd->down.extra_time) * p);
+        dx = fdx;
+        dy = fdy;
         sd->down.ax = dx;
         sd->down.ay = dy;
         x = sd->down.sx - dx;
         y = sd->down.sy - dy;
+        fx = sd->down.sx - fdx;
+        fy = sd->down.sy - fdy;
         elm_smart_scroller_child_pos_get(sd->smart_obj, &px, &py);
         if ((sd->down.bounce_x_animator) ||
             (sd->down.bounce_x_hold))
           {
              sd->down.bx = sd->down.bx0 - dx + sd->down.b0x;
              x = px;
+             fx = px;
           }
         if ((sd->down.bounce_y_animator) ||
             (sd->down.bounce_y_hold))
           {
              sd->down.by = sd->down.by0 - dy + sd->down.b0y;
              y = py;
+             fy = py;
           }
-        elm_smart_scroller_child_pos_set(sd->smart_obj, x, y);
+        if (_smart_smooth_enabled(sd))
+          {
+             /* round instead of truncating so steps stay even on slow
+              * flings, pan gets the remainder */
+             _smart_child_pos_set_smooth(sd, fx, fy);
+             x = lround(fx);
+             y = lround(fy);
+          }
+        else
+          elm_smart_scroller_child_pos_set(sd->smart_obj, x, y);
         _update_wanted_coordinates(sd, x, y);
         sd->pan_func.max_get(sd->pan_obj, &maxx, &maxy);
         sd->pan_func.min_get(sd->pan_obj, &minx, &miny);
@@ -1031,7 +1145,13 @@ elm_smart_scroller_child_pos_set(Evas_Object *obj, Evas_Coord x, Evas_Coord y)
         if (y - miny > my) y = my + miny;
      }
 
-   sd->pan_func.set(sd->pan_obj, x, y);
+   if (sd->pan_func.fraction_set)
+     sd->pan_func.fraction_set(sd->pan_obj, sd->frac_x, sd->frac_y);
+   sd->frac_x = 0.0;
+   sd->frac_y = 0.0;
+   if ((!sd->pan_func.translate) ||
+       (!sd->pan_func.translate(sd->pan_obj, x, y)))
+     sd->pan_func.set(sd->pan_obj, x, y);
    if ((px != x) || (py != y))
      edje_object_signal_emit(sd->edje_obj, "elm,action,scroll", "elm");
    if (!sd->down.bounce_x_animator)
@@ -1837,24 +1957,48 @@ _smart_hold_animator(void *data)
    Smart_Data *sd = data;
    Evas_Coord ox = 0, oy = 0, fx = 0, fy= 0;
 
+   double px = 0.0, py = 0.0, sx, sy;
+
    fx = sd->down.hold_x;
    fy = sd->down.hold_y;
+   if (_smart_smooth_enabled(sd))
+     {
+        /* Content follows where the pointer is predicted to be when
+         * this frame is shown, not where it was at the last event */
+        if (_smart_velocity_fit(sd, _smart_smooth_time_get(sd),
+                                NULL, NULL, &px, &py))
+          {
+             px *= _elm_config->scroll_smooth_amount;
+             py *= _elm_config->scroll_smooth_amount;
+          }
+     }
 
    elm_smart_scroller_child_pos_get(sd->smart_obj, &ox, &oy);
+   sx = ox;
+   sy = oy;
    if (sd->down.dir_x)
      {
         if ((!sd->widget) ||
             (!elm_widget_drag_child_locked_x_get(sd->widget)))
-          ox = fx;
+          {
+             ox = fx;
+             sx = fx - px;
+          }
      }
    if (sd->down.dir_y)
      {
         if ((!sd->widget) ||
             (!elm_widget_drag_child_locked_y_get(sd->widget)))
-          oy = fy;
+          {
+             oy = fy;
+             sy = fy - py;
+          }
      }
 
-   elm_smart_scroller_child_pos_set(sd->smart_obj, ox, oy);
+   if (_smart_smooth_enabled(sd))
+     _smart_child_pos_set_smooth(sd, sx, sy);
+   else
+     elm_smart_scroller_child_pos_set(sd->smart_obj, ox, oy);
    return ECORE_CALLBACK_RENEW;
 }
 
@@ -1907,9 +2051,9 @@ _smart_event_mouse_up(void *data, Evas *e, Evas_Object *obj __UNUSED__, void *ev
                   _smart_drag_stop(sd->smart_obj);
                   if ((!sd->hold) && (!sd->freeze))
                     {
-                       double t, at, dt;
+                       double t, at, dt, vx, vy, vel;
                        int i;
-                       Evas_Coord ax, ay, dx, dy, vel;
+                       Evas_Coord ax, ay, dx, dy;
 
 #ifdef EVTIME
                        t = ev->timestamp / 1000.0;
@@ -1942,14 +2086,24 @@ _smart_event_mouse_up(void *data, Evas *e, Evas_Object *obj __UNUSED__, void *ev
                        at /= _elm_config->thumbscroll_sensitivity_friction;
                        dx = ev->canvas.x - ax;
                        dy = ev->canvas.y - ay;
+                       vx = dx;
+                       vy = dy;
+                       if ((_smart_smooth_enabled(sd)) &&
+                           (_smart_velocity_fit(sd, t, &vx, &vy, NULL, NULL)))
+                         {
+                            /* Velocity of fitted line is less noisy than
+                             * the mean of integer positions, express it in
+                             * the same units as dx / at */
+                            at = 1.0 / _elm_config->thumbscroll_sensitivity_friction;
+                         }
                        if (at > 0)
                          {
-                            vel = sqrt((dx * dx) + (dy * dy)) / at;
+                            vel = sqrt((vx * vx) + (vy * vy)) / at;
                             if ((_elm_config->thumbscroll_friction > 0.0) &&
                                 (vel > _elm_config->thumbscroll_momentum_threshold))
                               {
-                                 sd->down.dx = ((double)dx / at);
-                                 sd->down.dy = ((double)dy / at);
+                                 sd->down.dx = (vx / at);
+                                 sd->down.dy = (vy / at);
                                  sd->down.extra_time = 0.0;
                                  sd->down.pdx = sd->down.dx;
                                  sd->down.pdy = sd->down.dy;
@@ -2222,6 +2376,9 @@ _smart_event_mouse_move(void *data, Evas *e, Evas_Object *obj __UNUSED__, void *
 #ifdef EVTIME
              sd->down.history[0].timestamp = ev->timestamp / 1000.0;
              sd->down.history[0].localtimestamp = ecore_loop_time_get();
+             sd->down.hist.est_timestamp_diff =
+                sd->down.history[0].localtimestamp -
+                sd->down.history[0].timestamp;
 #else
              sd->down.history[0].timestamp = ecore_loop_time_get();
 #endif
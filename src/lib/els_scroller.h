@@ -9,6 +9,7 @@ Elm_Smart_Scroller_Policy;
 Evas_Object *elm_smart_scroller_add(Evas *evas);
 void         elm_smart_scroller_child_set(Evas_Object *obj, Evas_Object *child);
 void         elm_smart_scroller_extern_pan_set(Evas_Object *obj, Evas_Object *pan, void (*pan_set)(Evas_Object *obj, Evas_Coord x, Evas_Coord y), void (*pan_get)(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y), void (*pan_max_get)(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y), void (*pan_min_get)(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y), void (*pan_child_size_get)(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y));
+void         elm_smart_scroller_extern_pan_smooth_set(Evas_Object *obj, void (*pan_fraction_set)(Evas_Object *obj, double fx, double fy), Eina_Bool (*pan_translate)(Evas_Object *obj, Evas_Coord x, Evas_Coord y));
 void         elm_smart_scroller_custom_edje_file_set(Evas_Object *obj, char *file, char *group);
 void         elm_smart_scroller_child_pos_set(Evas_Object *obj, Evas_Coord x, Evas_Coord y);
 void         elm_smart_scroller_child_pos_get(Evas_Object *obj, Evas_Coord *x, Evas_Coord *y);